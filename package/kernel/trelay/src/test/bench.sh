@@ -0,0 +1,98 @@
+#!/bin/sh
+# Relay throughput of trelay between two veth pairs, fed by pktgen:
+#
+#   tr_src: veth0a --- veth0b ==trelay== veth1b --- veth1a :tr_dst
+#
+# pktgen sends from veth0a and the frames counted on veth1a give the
+# relayed rate, once through dev_queue_xmit() (bulk 0) and once through
+# the per-cpu xmit_more queue (bulk 1).
+#
+# Needs root, debugfs, the pktgen module and trelay.ko (loaded, or given
+# with -m). Usage: bench.sh [-m trelay.ko] [-c count] [-s pkt_size]
+
+COUNT=5000000
+SIZE=60
+MODULE=
+DBG=/sys/kernel/debug/trelay
+RELAY=$DBG/bench
+
+while getopts "c:m:s:" opt; do
+	case "$opt" in
+		c) COUNT="$OPTARG";;
+		m) MODULE="$OPTARG";;
+		s) SIZE="$OPTARG";;
+		*) echo "usage: $0 [-m trelay.ko] [-c count] [-s pkt_size]" >&2; exit 1;;
+	esac
+done
+
+die() {
+	echo "$*" >&2
+	exit 1
+}
+
+pg() {
+	ip netns exec tr_src sh -c "echo '$2' > /proc/net/pktgen/$1" ||
+		die "pktgen: $1: $2 failed"
+}
+
+rx_packets() {
+	ip netns exec tr_dst cat /sys/class/net/veth1a/statistics/rx_packets
+}
+
+now_ns() {
+	date +%s%N
+}
+
+cleanup() {
+	[ -d "$RELAY" ] && echo > "$RELAY/remove"
+	ip netns del tr_src 2>/dev/null
+	ip netns del tr_dst 2>/dev/null
+	ip link del veth0b 2>/dev/null
+	ip link del veth1b 2>/dev/null
+}
+
+[ -n "$MODULE" ] && { insmod "$MODULE" || exit 1; }
+[ -d "$DBG" ] || mount -t debugfs none /sys/kernel/debug 2>/dev/null
+[ -f "$DBG/add" ] || die "trelay is not loaded"
+modprobe pktgen 2>/dev/null
+
+trap cleanup EXIT INT TERM
+cleanup
+
+ip netns add tr_src || exit 1
+ip netns add tr_dst || exit 1
+ip link add veth0a netns tr_src type veth peer name veth0b
+ip link add veth1a netns tr_dst type veth peer name veth1b
+ip netns exec tr_src ip link set veth0a up
+ip netns exec tr_dst ip link set veth1a up
+ip link set veth0b up
+ip link set veth1b up
+echo "bench,veth0b,veth1b" > "$DBG/add"
+
+ip netns exec tr_src test -d /proc/net/pktgen || die "pktgen is not available"
+
+DST_MAC=$(ip netns exec tr_dst cat /sys/class/net/veth1a/address)
+
+for bulk in 0 1; do
+	echo "$bulk" > "$RELAY/bulk"
+
+	pg kpktgend_0 "rem_device_all"
+	pg kpktgend_0 "add_device veth0a"
+	pg veth0a "count $COUNT"
+	pg veth0a "pkt_size $SIZE"
+	pg veth0a "clone_skb 0"
+	pg veth0a "delay 0"
+	pg veth0a "dst 10.0.0.2"
+	pg veth0a "dst_mac $DST_MAC"
+
+	rx=$(rx_packets)
+	t0=$(now_ns)
+	pg pgctrl "start"
+	t1=$(now_ns)
+	rx=$(($(rx_packets) - rx))
+
+	echo "bulk $bulk: $rx/$COUNT frames relayed, $((rx * 1000000000 / (t1 - t0))) pps"
+done
+
+echo
+cat "$RELAY/stats"
@@ -19,48 +19,305 @@
 #include <linux/netdevice.h>
 #include <linux/rtnetlink.h>
 #include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/interrupt.h>
+#include <linux/u64_stats_sync.h>
 
 #define trelay_log(loglevel, tr, fmt, ...) \
 	printk(loglevel "trelay: %s <-> %s: " fmt "\n", \
 		tr->dev1->name, tr->dev2->name, ##__VA_ARGS__);
 
+/* flush the per-cpu queue inline once this many frames are pending */
+#define TRELAY_BURST	64
+
+#define TRELAY_CB(skb)	((struct trelay_cb *)(skb)->cb)
+
 static LIST_HEAD(trelay_devs);
 static struct dentry *debugfs_dir;
 
+struct trelay_stats {
+	u64 rx_packets;
+	u64 tx_packets;
+	u64 tx_bytes;
+	u64 tx_dropped;
+	u64 tx_bursts;
+	struct u64_stats_sync syncp;
+};
+
+struct trelay_port {
+	struct trelay *tr;
+	struct net_device *dev;		/* device frames are relayed to */
+	struct trelay_stats __percpu *stats;
+};
+
 struct trelay {
 	struct list_head list;
 	struct net_device *dev1, *dev2;
+	struct trelay_port port[2];
 	struct dentry *debugfs;
+	bool bulk;
 	int to_remove;
 	char name[];
 };
 
+struct trelay_cb {
+	struct trelay_port *port;
+};
+
+/*
+ * Frames relayed in bulk mode are collected on a per-cpu queue and handed
+ * to the driver in runs, with xmit_more set for all but the last frame of
+ * a run. The tasklet flushes whatever is left at the end of the rx softirq.
+ * Frames the driver cannot take because its queue is stopped go through
+ * dev_queue_xmit instead, so the qdisc holds them until the queue wakes up.
+ * Bulk mode is off by default and enabled through the "bulk" debugfs file.
+ */
+struct trelay_pcpu {
+	struct sk_buff_head queue;
+	struct tasklet_struct tasklet;
+};
+
+static DEFINE_PER_CPU(struct trelay_pcpu, trelay_pcpu);
+
+static void trelay_flush(struct trelay_pcpu *pcpu)
+{
+	struct sk_buff_head list;
+	struct sk_buff *skb, *next;
+	struct trelay_stats *stats;
+	struct netdev_queue *txq;
+	struct net_device *dev;
+	u64 packets, bytes, dropped;
+	u16 queue;
+	int cpu = smp_processor_id();
+	unsigned int len;
+	bool more;
+	int ret;
+
+	__skb_queue_head_init(&list);
+	skb_queue_splice_init(&pcpu->queue, &list);
+
+	while ((skb = __skb_dequeue(&list)) != NULL) {
+		dev = skb->dev;
+		queue = skb_get_queue_mapping(skb);
+		txq = netdev_get_tx_queue(dev, queue);
+		stats = this_cpu_ptr(TRELAY_CB(skb)->port->stats);
+		packets = bytes = dropped = 0;
+
+		HARD_TX_LOCK(dev, txq, cpu);
+		do {
+			next = skb_peek(&list);
+			more = next && next->dev == dev &&
+			       skb_get_queue_mapping(next) == queue;
+
+			len = skb->len;
+			if (netif_xmit_frozen_or_drv_stopped(txq))
+				break;
+
+			ret = netdev_start_xmit(skb, dev, txq, more);
+			if (!dev_xmit_complete(ret))
+				break;
+
+			if (ret == NETDEV_TX_OK) {
+				packets++;
+				bytes += len;
+			} else {
+				dropped++;
+			}
+			skb = NULL;
+		} while (more && (skb = __skb_dequeue(&list)) != NULL);
+		HARD_TX_UNLOCK(dev, txq);
+
+		/* the queue is busy, leave the frame to the qdisc */
+		if (skb) {
+			if (net_xmit_eval(dev_queue_xmit(skb)) == 0) {
+				packets++;
+				bytes += len;
+			} else {
+				dropped++;
+			}
+		}
+
+		u64_stats_update_begin(&stats->syncp);
+		stats->tx_packets += packets;
+		stats->tx_bytes += bytes;
+		stats->tx_dropped += dropped;
+		stats->tx_bursts++;
+		u64_stats_update_end(&stats->syncp);
+	}
+}
+
+static void trelay_tasklet(unsigned long data)
+{
+	trelay_flush((struct trelay_pcpu *)data);
+}
+
+static u16 trelay_pick_tx(struct net_device *dev, struct sk_buff *skb)
+{
+	const struct net_device_ops *ops = dev->netdev_ops;
+	u16 queue;
+
+	if (dev->real_num_tx_queues == 1)
+		return 0;
+
+	if (ops->ndo_select_queue)
+		queue = ops->ndo_select_queue(dev, skb, NULL);
+	else
+		queue = netdev_pick_tx(dev, skb, NULL);
+
+	if (unlikely(queue >= dev->real_num_tx_queues))
+		queue = 0;
+
+	return queue;
+}
+
+static void trelay_queue(struct trelay_port *port, struct sk_buff *skb)
+{
+	struct trelay_pcpu *pcpu;
+	struct net_device *dev = port->dev;
+	struct trelay_stats *stats;
+	struct sk_buff *next;
+	bool again = false;
+
+	local_bh_disable();
+
+	pcpu = this_cpu_ptr(&trelay_pcpu);
+	skb_set_queue_mapping(skb, trelay_pick_tx(dev, skb));
+
+	/* segments and fixes up checksums/vlan tags the device cannot handle */
+	skb = validate_xmit_skb_list(skb, dev, &again);
+	if (!skb) {
+		stats = this_cpu_ptr(port->stats);
+		u64_stats_update_begin(&stats->syncp);
+		stats->tx_dropped++;
+		u64_stats_update_end(&stats->syncp);
+		goto out;
+	}
+
+	for (; skb; skb = next) {
+		next = skb->next;
+		skb_mark_not_on_list(skb);
+		TRELAY_CB(skb)->port = port;
+		__skb_queue_tail(&pcpu->queue, skb);
+	}
+
+	if (skb_queue_len(&pcpu->queue) >= TRELAY_BURST)
+		trelay_flush(pcpu);
+	else
+		tasklet_schedule(&pcpu->tasklet);
+
+out:
+	local_bh_enable();
+}
+
 rx_handler_result_t trelay_handle_frame(struct sk_buff **pskb)
 {
+	struct trelay_port *port;
+	struct trelay_stats *stats;
 	struct net_device *dev;
 	struct sk_buff *skb = *pskb;
+	int ret;
 
-	dev = rcu_dereference(skb->dev->rx_handler_data);
-	if (!dev)
+	port = rcu_dereference(skb->dev->rx_handler_data);
+	if (!port)
 		return RX_HANDLER_PASS;
 
 	if (skb->protocol == htons(ETH_P_PAE))
 		return RX_HANDLER_PASS;
 
+	dev = port->dev;
+	stats = this_cpu_ptr(port->stats);
+
+	u64_stats_update_begin(&stats->syncp);
+	stats->rx_packets++;
+	u64_stats_update_end(&stats->syncp);
+
 	skb_push(skb, ETH_HLEN);
 	skb->dev = dev;
 	skb_forward_csum(skb);
-	dev_queue_xmit(skb);
+
+	if (READ_ONCE(port->tr->bulk) && netif_running(dev)) {
+		trelay_queue(port, skb);
+		return RX_HANDLER_CONSUMED;
+	}
+
+	ret = dev_queue_xmit(skb);
+
+	u64_stats_update_begin(&stats->syncp);
+	if (net_xmit_eval(ret) == 0)
+		stats->tx_packets++;
+	else
+		stats->tx_dropped++;
+	u64_stats_update_end(&stats->syncp);
 
 	return RX_HANDLER_CONSUMED;
 }
 
+static void trelay_sync_queues(void)
+{
+	int cpu;
+
+	/* wait for frames still queued with a port to be flushed */
+	for_each_possible_cpu(cpu)
+		tasklet_kill(&per_cpu(trelay_pcpu, cpu).tasklet);
+}
+
 static int trelay_open(struct inode *inode, struct file *file)
 {
 	file->private_data = inode->i_private;
 	return 0;
 }
 
+static int trelay_stats_show(struct seq_file *s, void *unused)
+{
+	struct trelay *tr = s->private;
+	struct trelay_port *port;
+	int i, cpu;
+
+	for (i = 0; i < ARRAY_SIZE(tr->port); i++) {
+		u64 rx = 0, tx = 0, tx_bytes = 0, dropped = 0, bursts = 0;
+
+		port = &tr->port[i];
+		for_each_possible_cpu(cpu) {
+			const struct trelay_stats *st = per_cpu_ptr(port->stats, cpu);
+			u64 r, t, b, d, n;
+			unsigned int start;
+
+			do {
+				start = u64_stats_fetch_begin_irq(&st->syncp);
+				r = st->rx_packets;
+				t = st->tx_packets;
+				b = st->tx_bytes;
+				d = st->tx_dropped;
+				n = st->tx_bursts;
+			} while (u64_stats_fetch_retry_irq(&st->syncp, start));
+
+			rx += r;
+			tx += t;
+			tx_bytes += b;
+			dropped += d;
+			bursts += n;
+		}
+
+		seq_printf(s, "%s -> %s: rx %llu tx %llu tx_bytes %llu "
+			   "tx_dropped %llu tx_bursts %llu\n",
+			   i ? tr->dev2->name : tr->dev1->name, port->dev->name,
+			   rx, tx, tx_bytes, dropped, bursts);
+	}
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(trelay_stats);
+
+static void trelay_free(struct trelay *tr)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(tr->port); i++)
+		free_percpu(tr->port[i].stats);
+
+	kfree(tr);
+}
+
 static int trelay_do_remove(struct trelay *tr)
 {
 	list_del(&tr->list);
@@ -74,10 +331,11 @@ static int trelay_do_remove(struct trelay *tr)
 
 	netdev_rx_handler_unregister(tr->dev1);
 	netdev_rx_handler_unregister(tr->dev2);
+	trelay_sync_queues();
 
 	trelay_log(KERN_INFO, tr, "stopped");
 
-	kfree(tr);
+	trelay_free(tr);
 
 	return 0;
 }
@@ -150,12 +408,24 @@ static int trelay_do_add(char *name, char *devn1, char *devn2)
 {
 	struct net_device *dev1, *dev2;
 	struct trelay *tr, *tr1;
-	int ret;
+	int i, cpu, ret;
 
 	tr = kzalloc(sizeof(*tr) + strlen(name) + 1, GFP_KERNEL);
 	if (!tr)
 		return -ENOMEM;
 
+	for (i = 0; i < ARRAY_SIZE(tr->port); i++) {
+		tr->port[i].tr = tr;
+		tr->port[i].stats = alloc_percpu(struct trelay_stats);
+		if (!tr->port[i].stats) {
+			trelay_free(tr);
+			return -ENOMEM;
+		}
+
+		for_each_possible_cpu(cpu)
+			u64_stats_init(&per_cpu_ptr(tr->port[i].stats, cpu)->syncp);
+	}
+
 	rtnl_lock();
 	rcu_read_lock();
 
@@ -171,11 +441,14 @@ static int trelay_do_add(char *name, char *devn1, char *devn2)
 	if (!dev1 || !dev2)
 		goto out;
 
-	ret = netdev_rx_handler_register(dev1, trelay_handle_frame, dev2);
+	tr->port[0].dev = dev2;
+	tr->port[1].dev = dev1;
+
+	ret = netdev_rx_handler_register(dev1, trelay_handle_frame, &tr->port[0]);
 	if (ret < 0)
 		goto out;
 
-	ret = netdev_rx_handler_register(dev2, trelay_handle_frame, dev1);
+	ret = netdev_rx_handler_register(dev2, trelay_handle_frame, &tr->port[1]);
 	if (ret < 0) {
 		netdev_rx_handler_unregister(dev1);
 		goto out;
@@ -193,13 +466,15 @@ static int trelay_do_add(char *name, char *devn1, char *devn2)
 
 	tr->debugfs = debugfs_create_dir(name, debugfs_dir);
 	debugfs_create_file("remove", S_IWUSR, tr->debugfs, tr, &fops_remove);
+	debugfs_create_file("stats", S_IRUSR, tr->debugfs, tr, &trelay_stats_fops);
+	debugfs_create_bool("bulk", S_IRUSR | S_IWUSR, tr->debugfs, &tr->bulk);
 	ret = 0;
 
 out:
 	rcu_read_unlock();
 	rtnl_unlock();
 	if (ret < 0)
-		kfree(tr);
+		trelay_free(tr);
 
 	return ret;
 }
@@ -256,7 +531,14 @@ static struct notifier_block tr_dev_notifier = {
 
 static int __init trelay_init(void)
 {
-	int ret;
+	struct trelay_pcpu *pcpu;
+	int cpu, ret;
+
+	for_each_possible_cpu(cpu) {
+		pcpu = &per_cpu(trelay_pcpu, cpu);
+		__skb_queue_head_init(&pcpu->queue);
+		tasklet_init(&pcpu->tasklet, trelay_tasklet, (unsigned long)pcpu);
+	}
 
 	debugfs_dir = debugfs_create_dir("trelay", NULL);
 	if (!debugfs_dir)
@@ -286,6 +568,8 @@ static void __exit trelay_exit(void)
 		trelay_do_remove(tr);
 	rtnl_unlock();
 
+	trelay_sync_queues();
+
 	debugfs_remove_recursive(debugfs_dir);
 }
 
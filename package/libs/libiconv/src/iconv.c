@@ -70,22 +70,19 @@ static const unsigned char charsets[] =
 #define SHIFT_JIS   004
 #define BIG5        005
 #define GBK         006
-
-/* FIXME: these are not implemented yet
-// EUC:   A1-FE A1-FE
-// GBK:   81-FE 40-7E,80-FE
-// Big5:  A1-FE 40-7E,A1-FE
+#define EUC_JP      007
+#define GB18030     010
+
+/* double byte maps (EUC, EUC_JP, SHIFT_JIS, BIG5, GBK) are two level:
+// header:  type, first lead byte, last lead byte, first trail byte
+// index:   one 16 bit row number per lead byte, 0xFFFF if unused
+// rows:    one 16 bit code point per trail byte up to 0xFE, 0xFFFF if unmapped
+// GB18030 uses the GBK map plus its own runs for two byte sequences, EUC_TW
+// is not implemented
 */
 
-static const unsigned short maplen[] = {
-	[UCS2_8BIT] = 4+ 2* 128,
-	[UCS3_8BIT] = 4+ 3* 128,
-	[EUC]       = 4+ 2* 94*94,
-	[SHIFT_JIS] = 4+ 2* 94*94,
-	[BIG5]      = 4+ 2* 94*157,
-	[GBK]       = 4+ 2* 126*190,
-	[EUC_TW]    = 4+ 2* 2*94*94,
-};
+/* returned by the multibyte lookups, U+FFFF itself is valid in GB18030 */
+#define UNMAPPED    0x110000
 
 static int find_charmap(const char *name)
 {
@@ -253,6 +250,90 @@ static inline int utf8dec_wchar(wchar_t *c, unsigned char *in, size_t inb)
 	return -1;
 }
 
+#ifdef CJK_CHARSETS
+static inline wchar_t dbcs_get(const unsigned char *map, unsigned lead, unsigned trail)
+{
+	unsigned nlead = map[2] - map[1] + 1, ntrail = 0xff - map[3];
+	unsigned row;
+
+	wchar_t c;
+
+	if (lead - map[1] >= nlead || trail - map[3] >= ntrail)
+		return UNMAPPED;
+	row = get_16(map + 4 + 2*(lead - map[1]), 0);
+	if (row == 0xffff)
+		return UNMAPPED;
+	c = get_16(map + 4 + 2*nlead + 2*(row*ntrail + trail - map[3]), 0);
+	return c == 0xffff ? UNMAPPED : c;
+}
+
+static wchar_t gb18030_2byte_get(unsigned lead, unsigned trail)
+{
+	unsigned code = lead << 8 | trail, lo, hi, mid;
+	wchar_t c = dbcs_get(map_gbk, lead, trail);
+
+	if (c != UNMAPPED)
+		return c;
+
+	lo = 0;
+	hi = sizeof(gb18030_2byte) / sizeof(gb18030_2byte[0]);
+	while (hi - lo > 1) {
+		mid = (lo + hi) / 2;
+		if (gb18030_2byte[mid][0] <= code)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	if (code - gb18030_2byte[lo][0] >= gb18030_2byte[lo][2])
+		return UNMAPPED;
+	return gb18030_2byte[lo][1] + code - gb18030_2byte[lo][0];
+}
+
+static wchar_t gb18030_4byte(const unsigned char *s)
+{
+	unsigned idx, lo, hi, mid;
+
+	if (s[0] - 0x81u >= 126 || s[1] - 0x30u >= 10 ||
+	    s[2] - 0x81u >= 126 || s[3] - 0x30u >= 10)
+		return UNMAPPED;
+
+	idx = (((s[0]-0x81)*10 + (s[1]-0x30))*126 + (s[2]-0x81))*10 + (s[3]-0x30);
+
+	/* 90 30 81 30 and up map linearly to the supplementary planes */
+	if (idx >= 189000)
+		return idx - 189000 < 0x100000 ? idx - 189000 + 0x10000 : UNMAPPED;
+	if (idx >= 39420)
+		return UNMAPPED;
+
+	lo = 0;
+	hi = sizeof(gb18030_ranges) / sizeof(gb18030_ranges[0]);
+	while (hi - lo > 1) {
+		mid = (lo + hi) / 2;
+		if (gb18030_ranges[mid][0] <= idx)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	return gb18030_ranges[lo][1] + idx - gb18030_ranges[lo][0];
+}
+#endif
+
+/* length of the leading run of ASCII bytes, checked a word at a time */
+static inline size_t ascii_run(const unsigned char *s, size_t n)
+{
+	const size_t high = (size_t)-1 / 0xff * 0x80;
+	size_t i = 0, w;
+
+	for (; i + sizeof(w) <= n; i += sizeof(w)) {
+		memcpy(&w, s + i, sizeof(w));
+		if (w & high)
+			break;
+	}
+	while (i < n && s[i] < 0x80)
+		i++;
+	return i;
+}
+
 static inline wchar_t latin9_translit(wchar_t c)
 {
 	/* a number of trivial iso-8859-15 <> utf-8 transliterations */
@@ -278,10 +359,13 @@ size_t iconv(iconv_t cd, char **in, size_t *inb, char **out, size_t *outb)
 	char tmp[MB_LEN_MAX];
 	wchar_t c, d;
 	size_t k, l;
-	int err;
+	int err, ascii_out;
 
 	if (!in || !*in || !*inb) return 0;
 
+	/* ASCII runs are copied verbatim into these */
+	ascii_out = to == UTF_8 || to == US_ASCII || to == LATIN_1 || to == LATIN_9;
+
 	if (cd & 1)
 		map = charmaps[cd>>8].map;
 	else
@@ -290,7 +374,19 @@ size_t iconv(iconv_t cd, char **in, size_t *inb, char **out, size_t *outb)
 	for (; *inb; *in+=l, *inb-=l) {
 		c = *(unsigned char *)*in;
 		l = 1;
-		if (from >= UTF_8 && c < 0x80) goto charok;
+		if (from >= UTF_8 && c < 0x80) {
+			if (ascii_out) {
+				k = ascii_run(*(unsigned char **)in, *inb < *outb ? *inb : *outb);
+				if (k > 1) {
+					memcpy(*out, *in, k);
+					*out += k;
+					*outb -= k;
+					l = k;
+					continue;
+				}
+			}
+			goto charok;
+		}
 		switch (from) {
 		case WCHAR_T:
 			l = sizeof(wchar_t);
@@ -354,20 +450,47 @@ size_t iconv(iconv_t cd, char **in, size_t *inb, char **out, size_t *outb)
 			case UCS2_8BIT:
 				c -= 0x80;
 				break;
-			case EUC:
-				if ((unsigned)c - 0xa1 >= 94) goto ilseq;
-				if ((unsigned)in[0][1] - 0xa1 >= 94) goto ilseq;
-				c = (c-0xa1)*94 + (in[0][1]-0xa1);
-				l = 2;
-				break;
+#ifdef CJK_CHARSETS
+			case GB18030:
+				if (*inb < 2) goto starved;
+				d = ((unsigned char *)*in)[1];
+				if ((unsigned)d - 0x30 < 10) {
+					if (*inb < 4) goto starved;
+					c = gb18030_4byte(*(unsigned char **)in);
+					l = 4;
+				} else {
+					c = gb18030_2byte_get(c, d);
+					l = 2;
+				}
+				if (c == UNMAPPED) goto ilseq;
+				goto charok;
 			case SHIFT_JIS:
+				/* half-width katakana */
 				if ((unsigned)c - 0xa1 <= 0xdf-0xa1) {
 					c += 0xff61-0xa1;
 					goto charok;
 				}
-				// FIXME...
+				/* fall through */
+			case EUC_JP:
+				if (*inb < 2) goto starved;
+				/* SS2 half-width katakana, JIS X 0212 (SS3) is not supported */
+				if (map[0] == EUC_JP && c == 0x8e) {
+					c = ((unsigned char *)*in)[1];
+					if ((unsigned)c - 0xa1 > 0xdf-0xa1) goto ilseq;
+					c += 0xff61-0xa1;
+					l = 2;
+					goto charok;
+				}
+				/* fall through */
+			case EUC:
+			case BIG5:
+			case GBK:
+				if (*inb < 2) goto starved;
+				c = dbcs_get(map, c, ((unsigned char *)*in)[1]);
 				l = 2;
-				break;
+				if (c == UNMAPPED) goto ilseq;
+				goto charok;
+#endif
 			default:
 				goto badf;
 			}
@@ -25,6 +25,15 @@
 #include "charmaps/windows-1258.h"
 #endif
 
+#ifdef CJK_CHARSETS
+#include "charmaps/gbk.h"
+#include "charmaps/gb18030.h"
+#include "charmaps/big5.h"
+#include "charmaps/euc-kr.h"
+#include "charmaps/euc-jp.h"
+#include "charmaps/shift_jis.h"
+#endif
+
 
 struct charmap {
 	const char name[13];
@@ -64,6 +73,15 @@ static struct charmap charmaps[] = {
 
 	{ "KOI8-R",       map_koi8_r       },
 
+#ifdef CJK_CHARSETS
+	{ "GBK",          map_gbk          },
+	{ "GB18030",      map_gb18030      },
+	{ "BIG5",         map_big5         },
+	{ "EUC-KR",       map_euc_kr       },
+	{ "EUC-JP",       map_euc_jp       },
+	{ "SHIFT_JIS",    map_shift_jis    },
+#endif
+
 	/* Aliases */
 	{ "LATIN2",       map_iso_8859_2   },
 	{ "LATIN6",       map_iso_8859_10  },
@@ -77,4 +95,18 @@ static struct charmap charmaps[] = {
 	{ "LATIN4",       map_iso_8859_4   },
 	{ "LATIN5",       map_iso_8859_9   },
 #endif
+
+#ifdef CJK_CHARSETS
+	{ "CP936",        map_gbk          },
+	{ "GB2312",       map_gbk          },
+	{ "EUC-CN",       map_gbk          },
+	{ "BIG-5",        map_big5         },
+	{ "CN-BIG5",      map_big5         },
+	{ "CSBIG5",       map_big5         },
+	{ "EUCKR",        map_euc_kr       },
+	{ "EUCJP",        map_euc_jp       },
+	{ "SJIS",         map_shift_jis    },
+	{ "SHIFT-JIS",    map_shift_jis    },
+	{ "MS_KANJI",     map_shift_jis    },
+#endif
 };
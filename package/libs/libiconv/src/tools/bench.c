@@ -0,0 +1,149 @@
+/*
+ * Decode throughput of the CJK charmaps, host only.
+ *
+ * Built twice by the Makefile next to this file: iconv-bench against
+ * ../iconv.c and iconv-bench-glibc against the C library's iconv. The
+ * input is random text drawn from the charmaps in ../include, one run of
+ * ASCII followed by a few double byte characters, converted to UTF-8.
+ *
+ *   iconv-bench [MB] [ascii run length]
+ */
+
+#include <errno.h>
+#include <iconv.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "charmaps/gbk.h"
+#include "charmaps/big5.h"
+#include "charmaps/euc-kr.h"
+#include "charmaps/euc-jp.h"
+#include "charmaps/shift_jis.h"
+
+static const struct {
+	const char *name;
+	const unsigned char *map;
+} tests[] = {
+	{ "ASCII", NULL },
+	{ "GBK", map_gbk },
+	{ "GB18030", map_gbk },
+	{ "BIG5", map_big5 },
+	{ "EUC-KR", map_euc_kr },
+	{ "EUC-JP", map_euc_jp },
+	{ "SHIFT_JIS", map_shift_jis },
+};
+
+static int dbcs_valid(const unsigned char *map, unsigned lead, unsigned trail)
+{
+	unsigned nlead = map[2] - map[1] + 1, ntrail = 0xff - map[3];
+	unsigned row;
+
+	if (lead - map[1] >= nlead || trail - map[3] >= ntrail)
+		return 0;
+	row = map[4 + 2*(lead - map[1])] << 8 | map[5 + 2*(lead - map[1])];
+	if (row == 0xffff)
+		return 0;
+	row = 4 + 2*nlead + 2*(row*ntrail + trail - map[3]);
+	return (map[row] << 8 | map[row + 1]) != 0xffff;
+}
+
+static size_t gen(unsigned char *buf, size_t len, const char *name,
+		  const unsigned char *map, unsigned run)
+{
+	size_t n = 0;
+	unsigned i, k, idx, lead, trail;
+
+	while (n + run + 16 <= len) {
+		for (i = 0; i < run; i++)
+			buf[n++] = "etaoin shrdlu 0123456789,./"[rand() % 27];
+		if (!map)
+			continue;
+		for (k = 1 + rand() % 4; k; k--) {
+			if (!strcmp(name, "GB18030") && rand() % 8 == 0) {
+				/* four byte BMP sequence */
+				idx = rand() % 39420;
+				buf[n++] = 0x81 + idx / 12600;
+				buf[n++] = 0x30 + idx / 1260 % 10;
+				buf[n++] = 0x81 + idx / 10 % 126;
+				buf[n++] = 0x30 + idx % 10;
+				continue;
+			}
+			do {
+				lead = map[1] + rand() % (map[2] - map[1] + 1);
+				trail = map[3] + rand() % (0xff - map[3]);
+			} while (!dbcs_valid(map, lead, trail) ||
+				 (map == map_euc_jp && lead == 0x8e));
+			buf[n++] = lead;
+			buf[n++] = trail;
+		}
+	}
+	return n;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+	size_t len = (argc > 1 ? atoi(argv[1]) : 16) << 20;
+	unsigned run = argc > 2 ? atoi(argv[2]) : 16;
+	unsigned char *in = malloc(len);
+	char *out = malloc(4 * len);
+	unsigned t, rep, skipped;
+	size_t n, il, ol;
+	char *ip, *op;
+	iconv_t cd;
+	double t0, best;
+
+	if (!in || !out)
+		return 1;
+
+	for (t = 0; t < sizeof(tests) / sizeof(tests[0]); t++) {
+		srand(1);
+		n = gen(in, len, tests[t].name, tests[t].map, run);
+		cd = iconv_open("UTF-8", tests[t].name);
+		if (cd == (iconv_t)-1) {
+			printf("%-10s not supported\n", tests[t].name);
+			continue;
+		}
+
+		best = 1e9;
+		skipped = 0;
+		for (rep = 0; rep < 5; rep++) {
+			ip = (char *)in;
+			il = n;
+			op = out;
+			ol = 4 * len;
+			t0 = now();
+			/* glibc and the Python derived tables disagree on a
+			 * few codes, step over those */
+			while (iconv(cd, &ip, &il, &op, &ol) == (size_t)-1) {
+				if (errno != EILSEQ && errno != EINVAL)
+					break;
+				ip++;
+				il--;
+				skipped++;
+			}
+			t0 = now() - t0;
+			if (t0 < best)
+				best = t0;
+		}
+		iconv_close(cd);
+
+		printf("%-10s %8.1f MB/s", tests[t].name, n / best / 1e6);
+		if (skipped)
+			printf("  (%u bytes skipped)", skipped / 5);
+		printf("\n");
+	}
+
+	free(in);
+	free(out);
+	return 0;
+}
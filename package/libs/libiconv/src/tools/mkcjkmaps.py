@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# Regenerate the CJK charmaps in ../include/charmaps from Python's codecs:
+#
+#   python3 tools/mkcjkmaps.py
+#
+# Double byte maps are two level, see the comment in iconv.c. A code point
+# of 0xffff marks an unmapped byte sequence in the tables.
+
+import os
+
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                   '..', 'include', 'charmaps')
+
+EUC, SHIFT_JIS, BIG5, GBK, EUC_JP, GB18030 = 2, 4, 5, 6, 7, 8
+
+
+def emit(name, data):
+    lines = ['static const unsigned char map_%s[] = {' % name]
+    for i in range(0, len(data), 12):
+        lines.append('\t' + ', '.join('0x%02x' % b for b in data[i:i+12]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def emit_table(decl, items, per_line):
+    s = decl + ' = {\n'
+    for i in range(0, len(items), per_line):
+        s += '\t' + ', '.join(items[i:i+per_line]) + ',\n'
+    return s.rstrip(',\n') + '\n};\n'
+
+
+def decode2(codec, lead, trail):
+    try:
+        u = bytes([lead, trail]).decode(codec)
+    except UnicodeDecodeError:
+        return 0xffff
+    return ord(u) if len(u) == 1 and ord(u) < 0xffff else 0xffff
+
+
+def dbcs(codec, typ, lead_min, lead_max, trail_min):
+    index = []
+    rows = []
+    for lead in range(lead_min, lead_max + 1):
+        row = [decode2(codec, lead, t) for t in range(trail_min, 0xff)]
+        if all(u == 0xffff for u in row):
+            index.append(0xffff)
+        else:
+            index.append(len(rows))
+            rows.append(row)
+    data = [typ, lead_min, lead_max, trail_min]
+    for r in index:
+        data += [r >> 8, r & 0xff]
+    for row in rows:
+        for u in row:
+            data += [u >> 8, u & 0xff]
+    return data
+
+
+def write(fname, s):
+    with open(os.path.join(OUT, fname), 'w') as f:
+        f.write(s)
+
+
+def runs(pairs):
+    """merge (key, ucs) pairs into [first key, first ucs, count] runs"""
+    out = []
+    for k, u in pairs:
+        if out and k == out[-1][0] + out[-1][2] and u == out[-1][1] + out[-1][2]:
+            out[-1][2] += 1
+        else:
+            out.append([k, u, 1])
+    return out
+
+
+write('gbk.h', emit('gbk', dbcs('gbk', GBK, 0x81, 0xfe, 0x40)))
+write('big5.h', emit('big5', dbcs('big5', BIG5, 0xa1, 0xf9, 0x40)))
+write('euc-kr.h', emit('euc_kr', dbcs('euc_kr', EUC, 0xa1, 0xfe, 0xa1)))
+write('euc-jp.h', emit('euc_jp', dbcs('euc_jp', EUC_JP, 0xa1, 0xfe, 0xa1)))
+write('shift_jis.h', emit('shift_jis', dbcs('shift_jis', SHIFT_JIS, 0x81, 0xfc, 0x40)))
+
+# GB18030 two byte sequences are GBK plus the user defined areas and a few
+# later additions, only the difference is stored
+extra = []
+for lead in range(0x81, 0xff):
+    for trail in range(0x40, 0xff):
+        g = decode2('gbk', lead, trail)
+        u = decode2('gb18030', lead, trail)
+        assert g == 0xffff or g == u, 'gbk is not a subset of gb18030'
+        if g == 0xffff and u != 0xffff:
+            extra.append((lead << 8 | trail, u))
+extra_runs = runs(extra)
+for k, u, n in extra_runs:
+    assert (k & 0xff) + n - 1 <= 0xfe
+
+# four byte BMP sequences, the linear index is dense over the BMP
+seen = []
+for u in range(0x80, 0x10000):
+    if 0xd800 <= u < 0xe000:
+        continue
+    e = chr(u).encode('gb18030')
+    if len(e) != 4:
+        continue
+    idx = (((e[0]-0x81)*10 + (e[1]-0x30))*126 + (e[2]-0x81))*10 + (e[3]-0x30)
+    seen.append((idx, u))
+assert [i for i, u in seen] == list(range(39420)), 'gb18030 four byte index not dense'
+ranges = [(k, u) for k, u, n in runs(seen)]
+
+s = emit('gb18030', [GB18030, 0, 0, 0])
+s += '\n/* two byte sequences not in GBK: first byte pair of each run, the code point\n'
+s += ' * it maps to and the run length, runs stay within one lead byte */\n'
+s += emit_table('static const unsigned short gb18030_2byte[][3]',
+                ['{ 0x%04x, 0x%04x, %2d }' % tuple(r) for r in extra_runs], 3)
+s += '\n/* four byte BMP sequences: linear index of the first byte sequence of each run\n'
+s += ' * and the code point it maps to, runs are consecutive in both */\n'
+s += emit_table('static const unsigned short gb18030_ranges[][2]',
+                ['{ %5d, 0x%04x }' % r for r in ranges], 4)
+write('gb18030.h', s)
+
+print('gbk: %d codes, gb18030: %d extra two byte codes in %d runs, %d four byte runs'
+      % (sum(1 for l in range(0x81, 0xff) for t in range(0x40, 0xff)
+             if decode2('gbk', l, t) != 0xffff),
+         len(extra), len(extra_runs), len(ranges)))
@@ -198,6 +198,80 @@ show_vlan(struct switch_dev *dev, int vlan, bool all)
 	show_attrs(dev, dev->vlan_ops, &val);
 }
 
+struct show_arg {
+	struct switch_dev *dev;
+	int atype;
+	int port_vlan;
+	int next_port;
+	int count;
+};
+
+static void
+show_dump_enter(struct show_arg *s, int atype, int port_vlan)
+{
+	int last_port = s->dev->ports;
+
+	if (s->count && s->atype == atype && s->port_vlan == port_vlan)
+		return;
+
+	if (!s->count++)
+		printf("Global attributes:\n");
+
+	/* every port gets a header, even without readable attributes */
+	if (atype == SWLIB_ATTR_GROUP_PORT)
+		last_port = port_vlan + 1;
+	if (atype != SWLIB_ATTR_GROUP_GLOBAL)
+		while (s->next_port < last_port)
+			printf("Port %d:\n", s->next_port++);
+
+	if (atype == SWLIB_ATTR_GROUP_VLAN && port_vlan >= 0)
+		printf("VLAN %d:\n", port_vlan);
+
+	s->atype = atype;
+	s->port_vlan = port_vlan;
+}
+
+static void
+show_dump_val(struct switch_attr *attr, struct switch_val *val, void *arg)
+{
+	struct show_arg *s = arg;
+
+	show_dump_enter(s, attr->atype, val->port_vlan);
+
+	printf("\t%s: ", attr->name);
+	if (val->err < 0)
+		printf("???");
+	else
+		print_attr_val(attr, val);
+	putchar('\n');
+}
+
+/*
+ * same output as show_global/show_port/show_vlan, from one dump
+ *
+ * returns 1 if nothing could be dumped and the caller should fall back to
+ * reading the attributes one by one, a negative error if the dump failed
+ * after part of it was printed
+ */
+static int
+show_all(struct switch_dev *dev)
+{
+	struct show_arg s;
+	int err;
+
+	memset(&s, 0, sizeof(s));
+	s.dev = dev;
+	err = swlib_dump_attrs(dev, show_dump_val, &s);
+	if (err < 0 && !s.count)
+		return 1;
+
+	if (err < 0)
+		return err;
+
+	show_dump_enter(&s, SWLIB_ATTR_GROUP_VLAN, -1);
+	return 0;
+}
+
 static void
 print_usage(void)
 {
@@ -372,11 +446,20 @@ int main(int argc, char **argv)
 			else
 				show_vlan(dev, cvlan, false);
 		} else {
-			show_global(dev);
-			for (i=0; i < dev->ports; i++)
-				show_port(dev, i);
-			for (i=0; i < dev->vlans; i++)
-				show_vlan(dev, i, true);
+			retval = show_all(dev);
+			if (retval < 0) {
+				nl_perror(-retval, "Failed to dump attributes");
+				goto out;
+			}
+
+			if (retval > 0) {
+				retval = 0;
+				show_global(dev);
+				for (i=0; i < dev->ports; i++)
+					show_port(dev, i);
+				for (i=0; i < dev->vlans; i++)
+					show_vlan(dev, i, true);
+			}
 		}
 		break;
 	}
@@ -36,12 +36,20 @@
 #define DPRINTF(fmt, ...) do {} while (0)
 #endif
 
+/* upper bound for one batched set message */
+#define SWLIB_BATCH_SIZE	(32 * 1024)
+
 static struct nl_sock *handle;
 static struct nl_cache *cache;
 static struct genl_family *family;
 static struct nlattr *tb[SWITCH_ATTR_MAX + 1];
 static int refcount = 0;
 
+static struct switch_dev *batch_dev;
+static struct nl_msg *batch_msg;
+static struct nlattr *batch_list;
+static int batch_len;
+
 static struct nla_policy port_policy[SWITCH_ATTR_MAX] = {
 	[SWITCH_PORT_ID] = { .type = NLA_U32 },
 	[SWITCH_PORT_FLAG_TAGGED] = { .type = NLA_FLAG },
@@ -84,32 +92,13 @@ wait_handler(struct nl_msg *msg, void *arg)
 	return NL_STOP;
 }
 
-/* helper function for performing netlink requests */
+/* send a prepared request and wait for the ack or the end of the dump */
 static int
-swlib_call(int cmd, int (*call)(struct nl_msg *, void *),
-		int (*data)(struct nl_msg *, void *), void *arg)
+swlib_send(struct nl_msg *msg, int (*call)(struct nl_msg *, void *), void *arg)
 {
-	struct nl_msg *msg;
-	struct nl_cb *cb = NULL;
+	struct nl_cb *cb;
 	int finished;
-	int flags = 0;
-	int err = 0;
-
-	msg = nlmsg_alloc();
-	if (!msg) {
-		fprintf(stderr, "Out of memory!\n");
-		exit(1);
-	}
-
-	if (!data)
-		flags |= NLM_F_DUMP;
-
-	genlmsg_put(msg, NL_AUTO_PID, NL_AUTO_SEQ, genl_family_get_id(family), 0, flags, cmd, 0);
-	if (data) {
-		err = data(msg, arg);
-		if (err < 0)
-			goto nla_put_failure;
-	}
+	int err;
 
 	cb = nl_cb_alloc(NL_CB_CUSTOM);
 	if (!cb) {
@@ -128,7 +117,7 @@ swlib_call(int cmd, int (*call)(struct nl_msg *, void *),
 	if (call)
 		nl_cb_set(cb, NL_CB_VALID, NL_CB_CUSTOM, call, arg);
 
-	if (data)
+	if (!(nlmsg_hdr(msg)->nlmsg_flags & NLM_F_DUMP))
 		nl_cb_set(cb, NL_CB_ACK, NL_CB_CUSTOM, wait_handler, &finished);
 	else
 		nl_cb_set(cb, NL_CB_FINISH, NL_CB_CUSTOM, wait_handler, &finished);
@@ -142,13 +131,45 @@ swlib_call(int cmd, int (*call)(struct nl_msg *, void *),
 		err = nl_wait_for_ack(handle);
 
 out:
-	if (cb)
-		nl_cb_put(cb);
+	nl_cb_put(cb);
+	return err;
+}
+
+/* helper function for performing netlink requests */
+static int
+swlib_call_flags(int cmd, int flags, int (*call)(struct nl_msg *, void *),
+		int (*data)(struct nl_msg *, void *), void *arg)
+{
+	struct nl_msg *msg;
+	int err = 0;
+
+	msg = nlmsg_alloc();
+	if (!msg) {
+		fprintf(stderr, "Out of memory!\n");
+		exit(1);
+	}
+
+	genlmsg_put(msg, NL_AUTO_PID, NL_AUTO_SEQ, genl_family_get_id(family), 0, flags, cmd, 0);
+	if (data) {
+		err = data(msg, arg);
+		if (err < 0)
+			goto nla_put_failure;
+	}
+
+	err = swlib_send(msg, call, arg);
+
 nla_put_failure:
 	nlmsg_free(msg);
 	return err;
 }
 
+static int
+swlib_call(int cmd, int (*call)(struct nl_msg *, void *),
+		int (*data)(struct nl_msg *, void *), void *arg)
+{
+	return swlib_call_flags(cmd, data ? 0 : NLM_F_DUMP, call, data, arg);
+}
+
 static int
 send_attr(struct nl_msg *msg, void *arg)
 {
@@ -399,6 +420,93 @@ nla_put_failure:
 	return -1;
 }
 
+static int
+send_dev_id(struct nl_msg *msg, void *arg)
+{
+	struct switch_dev *dev = arg;
+
+	NLA_PUT_U32(msg, SWITCH_ATTR_ID, dev->id);
+
+	return 0;
+nla_put_failure:
+	return -1;
+}
+
+static int
+swlib_batch_alloc(struct switch_dev *dev)
+{
+	batch_msg = nlmsg_alloc_size(SWLIB_BATCH_SIZE);
+	if (!batch_msg)
+		return -ENOMEM;
+
+	genlmsg_put(batch_msg, NL_AUTO_PID, NL_AUTO_SEQ,
+		genl_family_get_id(family), 0, 0, SWITCH_CMD_SET_BATCH, 0);
+	if (send_dev_id(batch_msg, dev) < 0)
+		goto nla_put_failure;
+
+	batch_list = nla_nest_start(batch_msg, SWITCH_ATTR_OP_BATCH);
+	if (!batch_list)
+		goto nla_put_failure;
+
+	batch_len = 0;
+	return 0;
+
+nla_put_failure:
+	nlmsg_free(batch_msg);
+	batch_msg = NULL;
+	return -ENOMEM;
+}
+
+static int
+swlib_batch_flush(void)
+{
+	int err = 0;
+
+	if (!batch_msg)
+		return 0;
+
+	nla_nest_end(batch_msg, batch_list);
+	if (batch_len)
+		err = swlib_send(batch_msg, NULL, NULL);
+
+	nlmsg_free(batch_msg);
+	batch_msg = NULL;
+	return err;
+}
+
+static int
+swlib_batch_add(int cmd, struct switch_val *val)
+{
+	struct nlattr *n;
+	int len;
+	int err;
+
+	if (!batch_msg) {
+		err = swlib_batch_alloc(batch_dev);
+		if (err < 0)
+			return err;
+	}
+
+	len = nlmsg_hdr(batch_msg)->nlmsg_len;
+	n = nla_nest_start(batch_msg, cmd);
+	if (n && send_attr_val(batch_msg, val) == 0) {
+		nla_nest_end(batch_msg, n);
+		batch_len++;
+		return 0;
+	}
+
+	/* drop the partial entry, then retry in a new message */
+	nlmsg_hdr(batch_msg)->nlmsg_len = len;
+	if (!batch_len)
+		return -1;
+
+	err = swlib_batch_flush();
+	if (err < 0)
+		return err;
+
+	return swlib_batch_add(cmd, val);
+}
+
 int
 swlib_set_attr(struct switch_dev *dev, struct switch_attr *attr, struct switch_val *val)
 {
@@ -419,9 +527,43 @@ swlib_set_attr(struct switch_dev *dev, struct switch_attr *attr, struct switch_v
 	}
 
 	val->attr = attr;
+	if (batch_dev == dev)
+		return swlib_batch_add(cmd, val);
+
 	return swlib_call(cmd, NULL, send_attr_val, val);
 }
 
+int
+swlib_batch_begin(struct switch_dev *dev)
+{
+	int err;
+
+	if (batch_dev)
+		return -EBUSY;
+
+	/* an empty batch tells whether the kernel supports it */
+	err = swlib_call(SWITCH_CMD_SET_BATCH, NULL, send_dev_id, dev);
+	if (err < 0)
+		return err;
+
+	batch_dev = dev;
+	return 0;
+}
+
+int
+swlib_batch_end(struct switch_dev *dev)
+{
+	int err;
+
+	if (!dev || batch_dev != dev)
+		return -EINVAL;
+
+	err = swlib_batch_flush();
+	batch_dev = NULL;
+
+	return err;
+}
+
 enum {
 	CMD_NONE,
 	CMD_DUPLEX,
@@ -621,6 +763,33 @@ swlib_scan(struct switch_dev *dev)
 	return 0;
 }
 
+static struct switch_attr *
+swlib_attr_list(struct switch_dev *dev, enum swlib_attr_group atype)
+{
+	switch(atype) {
+	case SWLIB_ATTR_GROUP_GLOBAL:
+		return dev->ops;
+	case SWLIB_ATTR_GROUP_PORT:
+		return dev->port_ops;
+	case SWLIB_ATTR_GROUP_VLAN:
+		return dev->vlan_ops;
+	}
+
+	return NULL;
+}
+
+static struct switch_attr *
+swlib_lookup_attr_id(struct switch_dev *dev, enum swlib_attr_group atype,
+		int id)
+{
+	struct switch_attr *head = swlib_attr_list(dev, atype);
+
+	while (head && head->id != id)
+		head = head->next;
+
+	return head;
+}
+
 struct switch_attr *swlib_lookup_attr(struct switch_dev *dev,
 		enum swlib_attr_group atype, const char *name)
 {
@@ -629,17 +798,7 @@ struct switch_attr *swlib_lookup_attr(struct switch_dev *dev,
 	if (!name || !dev)
 		return NULL;
 
-	switch(atype) {
-	case SWLIB_ATTR_GROUP_GLOBAL:
-		head = dev->ops;
-		break;
-	case SWLIB_ATTR_GROUP_PORT:
-		head = dev->port_ops;
-		break;
-	case SWLIB_ATTR_GROUP_VLAN:
-		head = dev->vlan_ops;
-		break;
-	}
+	head = swlib_attr_list(dev, atype);
 	while(head) {
 		if (!strcmp(name, head->name))
 			return head;
@@ -649,6 +808,106 @@ struct switch_attr *swlib_lookup_attr(struct switch_dev *dev,
 	return NULL;
 }
 
+struct swlib_dump_arg {
+	struct switch_dev *dev;
+	void (*cb)(struct switch_attr *attr, struct switch_val *val, void *arg);
+	void *arg;
+	struct switch_port *ports;
+	struct switch_port_link link;
+};
+
+static int
+send_dump_id(struct nl_msg *msg, void *arg)
+{
+	struct swlib_dump_arg *d = arg;
+
+	return send_dev_id(msg, d->dev);
+}
+
+static int
+store_dump_val(struct nl_msg *msg, void *arg)
+{
+	struct genlmsghdr *gnlh = nlmsg_data(nlmsg_hdr(msg));
+	struct swlib_dump_arg *d = arg;
+	struct switch_attr *attr;
+	struct switch_val val;
+	int atype, idx = SWITCH_ATTR_UNSPEC;
+
+	switch (gnlh->cmd) {
+	case SWITCH_CMD_GET_GLOBAL:
+		atype = SWLIB_ATTR_GROUP_GLOBAL;
+		break;
+	case SWITCH_CMD_GET_PORT:
+		atype = SWLIB_ATTR_GROUP_PORT;
+		idx = SWITCH_ATTR_OP_PORT;
+		break;
+	case SWITCH_CMD_GET_VLAN:
+		atype = SWLIB_ATTR_GROUP_VLAN;
+		idx = SWITCH_ATTR_OP_VLAN;
+		break;
+	default:
+		goto done;
+	}
+
+	if (nla_parse(tb, SWITCH_ATTR_MAX - 1, genlmsg_attrdata(gnlh, 0),
+			genlmsg_attrlen(gnlh, 0), NULL) < 0)
+		goto done;
+
+	if (!tb[SWITCH_ATTR_OP_ID] || (idx && !tb[idx]))
+		goto done;
+
+	attr = swlib_lookup_attr_id(d->dev, atype,
+		nla_get_u32(tb[SWITCH_ATTR_OP_ID]));
+	if (!attr)
+		goto done;
+
+	memset(&val, 0, sizeof(val));
+	val.attr = attr;
+	if (idx)
+		val.port_vlan = nla_get_u32(tb[idx]);
+
+	if (tb[SWITCH_ATTR_OP_ERR]) {
+		val.err = -(int) nla_get_u32(tb[SWITCH_ATTR_OP_ERR]);
+	} else {
+		if (attr->type == SWITCH_TYPE_PORTS)
+			val.value.ports = d->ports;
+		else if (attr->type == SWITCH_TYPE_LINK)
+			val.value.link = &d->link;
+		store_val(msg, &val);
+	}
+
+	d->cb(attr, &val, d->arg);
+
+	if (!val.err && attr->type == SWITCH_TYPE_STRING)
+		free(val.value.s);
+
+done:
+	return NL_SKIP;
+}
+
+int
+swlib_dump_attrs(struct switch_dev *dev,
+		void (*cb)(struct switch_attr *attr, struct switch_val *val, void *arg),
+		void *arg)
+{
+	struct swlib_dump_arg d;
+	int err;
+
+	memset(&d, 0, sizeof(d));
+	d.dev = dev;
+	d.cb = cb;
+	d.arg = arg;
+	d.ports = swlib_alloc(sizeof(struct switch_port) * (dev->ports + 1));
+	if (!d.ports)
+		return -ENOMEM;
+
+	err = swlib_call_flags(SWITCH_CMD_DUMP_VALUES, NLM_F_DUMP,
+		store_dump_val, send_dump_id, &d);
+
+	free(d.ports);
+	return err;
+}
+
 static void
 swlib_priv_free(void)
 {
@@ -899,6 +1158,9 @@ swlib_free_port_map(struct switch_dev *dev)
 void
 swlib_free(struct switch_dev *dev)
 {
+	if (batch_dev == dev)
+		swlib_batch_end(dev);
+
 	swlib_free_attributes(&dev->ops);
 	swlib_free_attributes(&dev->port_ops);
 	swlib_free_attributes(&dev->vlan_ops);
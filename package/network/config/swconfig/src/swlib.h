@@ -259,6 +259,37 @@ int swlib_set_attr_string(struct switch_dev *dev, struct switch_attr *attr,
 int swlib_get_attr(struct switch_dev *dev, struct switch_attr *attr,
 		struct switch_val *val);
 
+/**
+ * swlib_dump_attrs: read all attribute values with a single dump request
+ * @dev: switch device struct
+ * @cb: called for every value, in attribute list order: global values
+ *      first, then all ports, then all VLANs that have member ports.
+ *      val->err is set if the value could not be read; the value data
+ *      is only valid during the call
+ * @arg: passed to @cb
+ * returns 0 on success, or an error if the kernel does not support dumps
+ */
+int swlib_dump_attrs(struct switch_dev *dev,
+		void (*cb)(struct switch_attr *attr, struct switch_val *val, void *arg),
+		void *arg);
+
+/**
+ * swlib_batch_begin: start queueing attribute changes
+ * @dev: switch device struct
+ * returns 0 on success. Until swlib_batch_end, swlib_set_attr queues its
+ * changes, and they are sent in as few messages as possible, each applied
+ * under a single lock of the switch. If the kernel does not support
+ * batching, an error is returned and changes are still sent one by one.
+ */
+int swlib_batch_begin(struct switch_dev *dev);
+
+/**
+ * swlib_batch_end: send all queued attribute changes
+ * @dev: switch device struct
+ * returns 0 on success
+ */
+int swlib_batch_end(struct switch_dev *dev);
+
 /**
  * swlib_apply_from_uci: set up the switch from a uci configuration
  * @dev: switch device struct
@@ -113,6 +113,7 @@ int swlib_apply_from_uci(struct switch_dev *dev, struct uci_package *p)
 	struct uci_option *o;
 	struct uci_ptr ptr;
 	struct switch_val val;
+	bool batch;
 	int i;
 
 	settings = NULL;
@@ -217,6 +218,8 @@ found:
 		}
 	}
 
+	batch = !swlib_batch_begin(dev);
+
 	for (i = 0; i < ARRAY_SIZE(early_settings); i++) {
 		struct swlib_setting *st = &early_settings[i];
 		if (!st->attr || !st->val)
@@ -236,11 +239,13 @@ found:
 
 	/* Apply the config */
 	attr = swlib_lookup_attr(dev, SWLIB_ATTR_GROUP_GLOBAL, "apply");
-	if (!attr)
-		return 0;
+	if (attr) {
+		memset(&val, 0, sizeof(val));
+		swlib_set_attr(dev, attr, &val);
+	}
 
-	memset(&val, 0, sizeof(val));
-	swlib_set_attr(dev, attr, &val);
+	if (batch)
+		swlib_batch_end(dev);
 
 	return 0;
 }
@@ -15,6 +15,9 @@
 #include <sys/types.h>
 #include <sys/time.h>
 #include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -42,6 +45,7 @@
 
 #ifdef linux
 #include <linux/if_packet.h>
+#include <linux/filter.h>
 #endif
 
 #define PASSWD_FILE	"/etc/passwd"
@@ -57,6 +61,8 @@
 #define PCAP_MRU		1600
 #define PCAP_TIMEOUT	200
 
+#define EPOLL_EVENTS	8
+
 #if EAD_DEBUGLEVEL >= 1
 #define DEBUG(n, format, ...) do { \
 	if (EAD_DEBUGLEVEL >= n) \
@@ -74,6 +80,9 @@ struct ead_instance {
 	char id;
 	char bridge[16];
 	bool br_check;
+	bool warned;
+	int rx_fd;
+	int tx_fd;
 };
 
 static char ethmac[6] = "\x00\x13\x37\x00\x00\x00"; /* last 3 bytes will be randomized */
@@ -85,7 +94,7 @@ static u16_t nid = 0xffff; /* node id */
 static char username[32] = "";
 static int state = EAD_TYPE_SET_USERNAME;
 static const char *passwd_file = PASSWD_FILE;
-static const char password[MAXPARAMLEN];
+static char password[MAXPARAMLEN];
 static bool child_pending = false;
 
 static unsigned char abuf[MAXPARAMLEN + 1];
@@ -95,7 +104,24 @@ static unsigned char pw_saltbuf[MAXSALTLEN];
 static struct list_head instances;
 static const char *dev_name = DEFAULT_DEVNAME;
 static bool nonfork = false;
+static bool single = false;
+static int epoll_fd = -1;
 static struct ead_instance *instance = NULL;
+static char rxbuf[PCAP_MRU];
+
+/*
+ * Output of an EAD_CMD_NORMAL command in single process mode. The pipe is
+ * polled from the main loop instead of blocking it until the command exits.
+ */
+static struct {
+	int fd;
+	pid_t pid;
+	struct ead_instance *in;
+	struct ead_packet pkt;
+	struct timeval last, end;
+} cmd_stream = {
+	.fd = -1,
+};
 
 static struct t_pwent tpe = {
 	.name = username,
@@ -111,17 +137,10 @@ static struct t_num A, *B = NULL;
 unsigned char *skey;
 
 static void
-set_recv_type(pcap_t *p, bool rx)
+set_recv_type_fd(int fd, bool rx)
 {
 #ifdef PACKET_RECV_TYPE
-	struct sockaddr_ll sll;
-	struct ifreq ifr;
 	int mask;
-	int fd;
-
-	fd = pcap_get_selectable_fd(p);
-	if (fd < 0)
-		return;
 
 	if (rx)
 		mask = 1 << PACKET_BROADCAST;
@@ -132,6 +151,18 @@ set_recv_type(pcap_t *p, bool rx)
 #endif
 }
 
+static void
+set_recv_type(pcap_t *p, bool rx)
+{
+	int fd;
+
+	fd = pcap_get_selectable_fd(p);
+	if (fd < 0)
+		return;
+
+	set_recv_type_fd(fd, rx);
+}
+
 
 static pcap_t *
 ead_open_pcap(const char *ifname, char *errbuf, bool rx)
@@ -153,6 +184,54 @@ out:
 	return p;
 }
 
+/*
+ * Packet socket equivalent of ead_open_pcap for single process mode. The
+ * precompiled pcap filter is attached before binding to the protocol, so
+ * the socket never queues anything but EAD requests.
+ */
+static int
+ead_open_socket(const char *ifname, bool rx)
+{
+	struct sock_fprog prog = {
+		.len = pktfilter.bf_len,
+		.filter = (struct sock_filter *) pktfilter.bf_insns,
+	};
+	struct sockaddr_ll sll = {
+		.sll_family = AF_PACKET,
+	};
+	struct packet_mreq mr = {
+		.mr_type = PACKET_MR_PROMISC,
+	};
+	int fd;
+
+	sll.sll_ifindex = if_nametoindex(ifname);
+	if (!sll.sll_ifindex)
+		return -1;
+
+	fd = socket(AF_PACKET, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+		return -1;
+
+	if (rx) {
+		if (setsockopt(fd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) < 0)
+			goto error;
+
+		mr.mr_ifindex = sll.sll_ifindex;
+		setsockopt(fd, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &mr, sizeof(mr));
+		sll.sll_protocol = htons(ETH_P_IP);
+	}
+	set_recv_type_fd(fd, rx);
+
+	if (bind(fd, (struct sockaddr *) &sll, sizeof(sll)) < 0)
+		goto error;
+
+	return fd;
+
+error:
+	close(fd);
+	return -1;
+}
+
 static void
 get_random_bytes(void *ptr, int len)
 {
@@ -171,6 +250,8 @@ static bool
 prepare_password(void)
 {
 	static char lbuf[1024];
+	static char cache_user[sizeof(username)];
+	static char cache_pw[MAXPARAMLEN];
 	unsigned char dig[SHA_DIGESTSIZE];
 	BigInteger x, v, n, g;
 	SHA1_CTX ctxt;
@@ -225,10 +306,14 @@ prepare_password(void)
 	return false;
 
 hash_password:
+	/* the verifier only depends on username and password, reuse it */
+	if (tpe.password.len > 0 &&
+		!strcmp(cache_user, username) &&
+		!strncmp(cache_pw, password, MAXPARAMLEN))
+		return true;
+
 	tce = gettcid(tpe.index);
-	do {
-		t_random(tpe.password.data, SALTLEN);
-	} while (memcmp(saltbuf, (char *)dig, sizeof(saltbuf)) == 0);
+	t_random(tpe.password.data, SALTLEN);
 	if (saltbuf[0] == 0)
 		saltbuf[0] = 0xff;
 
@@ -252,6 +337,8 @@ hash_password:
 
 	BigIntegerModExp(v, g, x, n);
 	tpe.password.len = BigIntegerToBytes(v, (unsigned char *)pwbuf);
+	strncpy(cache_user, username, sizeof(cache_user));
+	strncpy(cache_pw, password, sizeof(cache_pw));
 
 	BigIntegerFree(v);
 	BigIntegerFree(x);
@@ -328,7 +415,12 @@ ead_send_packet_clone(struct ead_packet *pkt)
 	if (sum == 0)
 		sum = 0xffff;
 	pktbuf->udpchksum = htons(~sum);
-	pcap_sendpacket(pcap_fp, (void *) pktbuf, sizeof(struct ead_packet) + ntohl(pktbuf->msg.len));
+
+	len = sizeof(struct ead_packet) + ntohl(pktbuf->msg.len);
+	if (single)
+		send(instance->tx_fd, pktbuf, len, 0);
+	else
+		pcap_sendpacket(pcap_fp, (void *) pktbuf, len);
 }
 
 static void
@@ -469,6 +561,121 @@ handle_send_auth(struct ead_packet *pkt, int len, int *nstate)
 	return true;
 }
 
+static void
+cmd_stream_send(int bytes, bool done)
+{
+	struct ead_msg *msg = &pktbuf->msg;
+	struct ead_msg_cmd_data *cmddata = EAD_ENC_DATA(msg, cmd_data);
+
+	/* pktbuf may have carried other replies since the last chunk */
+	instance = cmd_stream.in;
+	msg->magic = htonl(EAD_MAGIC);
+	msg->type = htonl(EAD_TYPE_SEND_CMD + 1);
+	msg->nid = htons(nid);
+	msg->sid = cmd_stream.pkt.msg.sid;
+	cmddata->done = done;
+
+	DEBUG(3, "Sending %d bytes of console data, done=%d\n", bytes, done);
+	ead_encrypt_message(msg, sizeof(struct ead_msg_cmd_data) + bytes);
+	ead_send_packet_clone(&cmd_stream.pkt);
+	gettimeofday(&cmd_stream.last, NULL);
+}
+
+static void
+cmd_stream_close(void)
+{
+	if (cmd_stream.fd < 0)
+		return;
+
+	epoll_ctl(epoll_fd, EPOLL_CTL_DEL, cmd_stream.fd, NULL);
+	close(cmd_stream.fd);
+	cmd_stream.fd = -1;
+}
+
+static bool
+cmd_stream_start(struct ead_packet *pkt, int fd, pid_t pid, int timeout)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+		.data.ptr = &cmd_stream,
+	};
+
+	memcpy(&cmd_stream.pkt, pkt, sizeof(cmd_stream.pkt));
+	cmd_stream.fd = fd;
+	cmd_stream.pid = pid;
+	cmd_stream.in = instance;
+	gettimeofday(&cmd_stream.last, NULL);
+	cmd_stream.end = cmd_stream.last;
+	cmd_stream.end.tv_sec += timeout;
+
+	/* without the pipe the client still gets keepalives and the end */
+	if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+		cmd_stream_close();
+
+	/* every reply is sent from the main loop */
+	return false;
+}
+
+static void
+cmd_stream_read(void)
+{
+	struct ead_msg_cmd_data *cmddata = EAD_ENC_DATA(&pktbuf->msg, cmd_data);
+	int bytes;
+
+	bytes = read(cmd_stream.fd, cmddata->data, 1024);
+	if (bytes > 0)
+		cmd_stream_send(bytes, false);
+	else if (!bytes || (errno != EAGAIN && errno != EINTR))
+		cmd_stream_close();
+}
+
+/* keepalives every PCAP_TIMEOUT ms, the end of the command or its timeout */
+static void
+cmd_stream_poll(void)
+{
+	struct timeval tv, idle;
+
+	if (!cmd_stream.pid)
+		return;
+
+	gettimeofday(&tv, NULL);
+	if (!timercmp(&tv, &cmd_stream.end, <)) {
+		kill(cmd_stream.pid, SIGKILL);
+		goto stop;
+	}
+
+	timersub(&tv, &cmd_stream.last, &idle);
+	if (!child_pending && (cmd_stream.fd < 0 ||
+		idle.tv_sec * 1000 + idle.tv_usec / 1000 >= PCAP_TIMEOUT)) {
+		cmd_stream_send(0, true);
+		goto stop;
+	}
+
+	if (idle.tv_sec * 1000 + idle.tv_usec / 1000 >= PCAP_TIMEOUT)
+		cmd_stream_send(0, false);
+	return;
+
+stop:
+	cmd_stream_close();
+	cmd_stream.pid = 0;
+}
+
+/* epoll timeout until the next keepalive is due */
+static int
+cmd_stream_timeout(void)
+{
+	struct timeval tv;
+	int ms;
+
+	if (!cmd_stream.pid)
+		return 1000;
+
+	gettimeofday(&tv, NULL);
+	timersub(&tv, &cmd_stream.last, &tv);
+	ms = PCAP_TIMEOUT - (tv.tv_sec * 1000 + tv.tv_usec / 1000);
+	return ms > 0 ? ms : 0;
+}
+
 static bool
 handle_send_cmd(struct ead_packet *pkt, int len, int *nstate)
 {
@@ -540,6 +747,9 @@ handle_send_cmd(struct ead_packet *pkt, int len, int *nstate)
 		return false;
 	}
 
+	if (stream && single)
+		return cmd_stream_start(pkt, pfd[0], pid, timeout);
+
 	msg = &pktbuf->msg;
 	cmddata = EAD_ENC_DATA(msg, cmd_data);
 
@@ -593,6 +803,10 @@ parse_message(struct ead_packet *pkt, int len)
 		(state != type))
 		return;
 
+	/* the session is busy until the streaming command is done */
+	if (cmd_stream.pid && (type != EAD_TYPE_PING))
+		return;
+
 	if ((type != EAD_TYPE_PING) &&
 		((ntohs(pkt->msg.sid) & EAD_INSTANCE_MASK) >>
 		 EAD_INSTANCE_SHIFT) != instance->id)
@@ -732,6 +946,7 @@ usage(const char *prog)
 		"\t-D <name>      Set the name of the device visible to clients\n"
 		"\t-p <file>      Set the password file for authenticating\n"
 		"\t-P <file>      Write a pidfile\n"
+		"\t-s             Serve all interfaces from a single process\n"
 		"\n", prog);
 	return -1;
 }
@@ -802,10 +1017,93 @@ start_servers(bool restart)
 	}
 }
 
+static void
+close_instance(struct ead_instance *in)
+{
+	if (in->rx_fd < 0)
+		return;
+
+	epoll_ctl(epoll_fd, EPOLL_CTL_DEL, in->rx_fd, NULL);
+	if (in->tx_fd != in->rx_fd)
+		close(in->tx_fd);
+	close(in->rx_fd);
+	in->rx_fd = -1;
+	in->tx_fd = -1;
+}
+
+static bool
+open_instance(struct ead_instance *in)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+		.data.ptr = in,
+	};
+
+	if (in->bridge[0]) {
+		in->rx_fd = ead_open_socket(in->bridge, true);
+		in->tx_fd = ead_open_socket(in->ifname, false);
+	} else {
+		in->rx_fd = ead_open_socket(in->ifname, true);
+		in->tx_fd = in->rx_fd;
+	}
+
+	if (in->rx_fd < 0 || in->tx_fd < 0 ||
+		epoll_ctl(epoll_fd, EPOLL_CTL_ADD, in->rx_fd, &ev) < 0) {
+		if (in->rx_fd >= 0)
+			close(in->rx_fd);
+		if (in->tx_fd >= 0 && in->tx_fd != in->rx_fd)
+			close(in->tx_fd);
+		in->rx_fd = -1;
+		in->tx_fd = -1;
+		return false;
+	}
+
+	return true;
+}
+
+static void
+open_instances(void)
+{
+	struct ead_instance *in;
+	struct list_head *p;
+
+	list_for_each(p, &instances) {
+		in = list_entry(p, struct ead_instance, list);
+		if (in->rx_fd >= 0)
+			continue;
+
+		if (open_instance(in))
+			in->warned = false;
+		else if (!in->warned) {
+			DEBUG(1, "WARNING: unable to open interface '%s'\n", in->ifname);
+			in->warned = true;
+		}
+	}
+}
+
+static void
+handle_instance(struct ead_instance *in)
+{
+	struct pcap_pkthdr h;
+	int len;
+
+	instance = in;
+	while ((len = recv(in->rx_fd, rxbuf, sizeof(rxbuf), 0)) > 0) {
+		h.caplen = len;
+		h.len = len;
+		handle_packet(NULL, &h, (u_char *) rxbuf);
+	}
+
+	if (len < 0 && errno != EAGAIN && errno != EINTR)
+		close_instance(in);
+}
+
 static void
 stop_server(struct ead_instance *in, bool do_free)
 {
-	if (in->pid > 0)
+	if (single)
+		close_instance(in);
+	else if (in->pid > 0)
 		kill(in->pid, SIGKILL);
 	in->pid = 0;
 	if (do_free) {
@@ -879,6 +1177,58 @@ check_all_interfaces(void)
 	}
 }
 
+/*
+ * Single process mode: all interfaces are served from one epoll loop over
+ * packet sockets. There is one SRP/session state for all of them, a new
+ * login on any interface replaces the previous session.
+ */
+static void
+ead_single_loop(void)
+{
+	struct epoll_event ev[EPOLL_EVENTS];
+	struct timeval tv, next = {};
+	int i, n;
+
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if (epoll_fd < 0) {
+		perror("epoll_create1");
+		exit(1);
+	}
+
+	signal(SIGCHLD, instance_handle_sigchld);
+	br_init();
+
+	while (1) {
+		gettimeofday(&tv, NULL);
+		if (!timercmp(&tv, &next, <)) {
+			check_all_interfaces();
+			open_instances();
+			next = tv;
+			next.tv_sec++;
+		}
+
+		n = epoll_wait(epoll_fd, ev, EPOLL_EVENTS, cmd_stream_timeout());
+		for (i = 0; i < n; i++) {
+			struct ead_instance *in = ev[i].data.ptr;
+
+			if (ev[i].data.ptr == &cmd_stream) {
+				if (cmd_stream.fd >= 0)
+					cmd_stream_read();
+				continue;
+			}
+
+			if (in->rx_fd < 0)
+				continue;
+
+			if (ev[i].events & (EPOLLERR | EPOLLHUP))
+				close_instance(in);
+			else
+				handle_instance(in);
+		}
+		cmd_stream_poll();
+	}
+}
+
 
 int main(int argc, char **argv)
 {
@@ -893,7 +1243,7 @@ int main(int argc, char **argv)
 		return usage(argv[0]);
 
 	INIT_LIST_HEAD(&instances);
-	while ((ch = getopt(argc, argv, "Bd:D:fhp:P:")) != -1) {
+	while ((ch = getopt(argc, argv, "Bd:D:fhp:P:s")) != -1) {
 		switch(ch) {
 		case 'B':
 			background = true;
@@ -908,6 +1258,8 @@ int main(int argc, char **argv)
 			memset(in, 0, sizeof(struct ead_instance));
 			INIT_LIST_HEAD(&in->list);
 			strncpy(in->ifname, optarg, sizeof(in->ifname) - 1);
+			in->rx_fd = -1;
+			in->tx_fd = -1;
 			list_add(&in->list, &instances);
 			in->id = n_iface++;
 			break;
@@ -920,6 +1272,9 @@ int main(int argc, char **argv)
 		case 'P':
 			pidfile = optarg;
 			break;
+		case 's':
+			single = true;
+			break;
 		}
 	}
 	signal(SIGCHLD, server_handle_sigchld);
@@ -959,6 +1314,9 @@ int main(int argc, char **argv)
 	get_random_bytes(ethmac + 3, 3);
 	nid = *(((u16_t *) ethmac) + 2);
 
+	if (single)
+		ead_single_loop();
+
 	start_servers(false);
 	br_init();
 	tv.tv_sec = 1;
@@ -26,15 +26,20 @@
 #include <signal.h>
 #include <syslog.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <byteswap.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <net/ethernet.h>
 #include <net/if.h>
 #include <netinet/in.h>
 #include <linux/if_packet.h>
+#include <linux/filter.h>
 
 #define ARPHRD_IEEE80211_RADIOTAP	803
 
@@ -44,6 +49,15 @@
 #define FRAMETYPE_MASK				0xFC
 #define FRAMETYPE_BEACON			0x80
 #define FRAMETYPE_DATA				0x08
+#define FRAMETYPE_TYPE_MASK			0x0C
+#define FRAMETYPE_MGMT				0x00
+
+#define RX_BLOCK_SIZE				(1 << 16)
+#define RX_BLOCK_NR					8
+#define RX_BLOCK_TOV				100	/* ms until a partial block is retired */
+#define RX_FRAME_SIZE				2048
+
+#define IOV_BATCH					64
 
 #if __BYTE_ORDER == __BIG_ENDIAN
 #define le16(x) __bswap_16(x)
@@ -55,8 +69,11 @@ uint8_t run_dump   = 0;
 uint8_t run_stop   = 0;
 uint8_t run_daemon = 0;
 
+uint8_t filter_kernel = 0;
+
 uint32_t frames_captured = 0;
 uint32_t frames_filtered = 0;
+uint32_t frames_dropped  = 0;
 
 int capture_sock = -1;
 const char *ifname = NULL;
@@ -69,11 +86,19 @@ struct ringbuf {
 	void *buf;               /* ring memory */
 };
 
+/* laid out like pcaprec_hdr_t so that slots can be written out as is */
 struct ringbuf_entry {
-	uint32_t len;            /* used slot memory */
-	uint32_t olen;           /* original data size */
 	uint32_t sec;            /* epoch of slot creation */
 	uint32_t usec;			 /* epoch microseconds */
+	uint32_t len;            /* used slot memory */
+	uint32_t olen;           /* original data size */
+};
+
+struct rxring {
+	uint8_t *map;            /* mmap()ed TPACKET_V3 block ring */
+	uint32_t blksz;          /* block size */
+	uint32_t blknr;          /* number of blocks */
+	uint32_t cur;            /* next block to read */
 };
 
 typedef struct pcap_hdr_s {
@@ -144,6 +169,102 @@ int set_promisc(int on)
 	return 0;
 }
 
+int frame_filtered(uint8_t *frame, uint32_t len,
+				   uint8_t beacon, uint8_t data, uint8_t mgmt)
+{
+	radiotap_hdr_t *rhdr = (radiotap_hdr_t *)frame;
+	uint8_t frametype;
+
+	if (len <= sizeof(radiotap_hdr_t) || le16(rhdr->it_len) >= len)
+		return 1;
+
+	frametype = frame[le16(rhdr->it_len)];
+
+	return ((data   && (frametype & FRAMETYPE_MASK) == FRAMETYPE_DATA) ||
+	        (beacon && (frametype & FRAMETYPE_MASK) == FRAMETYPE_BEACON) ||
+	        (mgmt   && (frametype & FRAMETYPE_TYPE_MASK) != FRAMETYPE_MGMT));
+}
+
+/*
+ * Compile the frame type filters into a classic BPF program so that unwanted
+ * frames are discarded before they are queued to the socket. The radiotap
+ * length is little endian while BPF loads are big endian, so it is assembled
+ * from two byte loads. Accepted frames are cut at snap bytes.
+ */
+int set_filter(uint8_t beacon, uint8_t data, uint8_t mgmt, uint32_t snap)
+{
+	struct sock_filter code[32];
+	struct sock_fprog prog = { .filter = code };
+	int n = 0, i;
+
+	struct {
+		uint8_t on, mask, type, drop_eq;
+	} rules[] = {
+		{ beacon, FRAMETYPE_MASK,      FRAMETYPE_BEACON, 1 },
+		{ data,   FRAMETYPE_MASK,      FRAMETYPE_DATA,   1 },
+		{ mgmt,   FRAMETYPE_TYPE_MASK, FRAMETYPE_MGMT,   0 },
+	};
+
+	/* X = it_len, A = X = frame control */
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_B   | BPF_ABS, 3);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_LSH | BPF_K, 8);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_B   | BPF_ABS, 2);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_OR  | BPF_X, 0);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_B   | BPF_IND, 0);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+
+	for (i = 0; i < sizeof(rules) / sizeof(rules[0]); i++)
+	{
+		if (!rules[i].on)
+			continue;
+
+		/* the drop statement directly follows the accept statement */
+		code[n++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TXA, 0);
+		code[n++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_AND | BPF_K,
+		                                         rules[i].mask);
+		code[n] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+		                                       rules[i].type, 0, 0);
+
+		if (rules[i].drop_eq)
+			code[n].jt = 0xFF;
+		else
+			code[n].jf = 0xFF;
+
+		n++;
+	}
+
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, snap);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, 0);
+
+	/* resolve the drop jumps now that the program length is known */
+	for (i = 0; i < n; i++)
+	{
+		if (code[i].jt == 0xFF)
+			code[i].jt = n - 2 - i;
+		else if (code[i].jf == 0xFF)
+			code[i].jf = n - 2 - i;
+	}
+
+	prog.len = n;
+
+	return setsockopt(capture_sock, SOL_SOCKET, SO_ATTACH_FILTER,
+	                  &prog, sizeof(prog));
+}
+
+uint32_t get_drops(void)
+{
+	struct tpacket_stats_v3 st = { 0 };
+	socklen_t len = sizeof(st);
+
+	/* reading the statistics resets the kernel counters */
+	if (!getsockopt(capture_sock, SOL_PACKET, PACKET_STATISTICS, &st, &len))
+		frames_dropped += st.tp_drops;
+
+	return frames_dropped;
+}
+
 
 void sig_dump(int sig)
 {
@@ -156,19 +277,19 @@ void sig_teardown(int sig)
 }
 
 
+static const pcap_hdr_t pcap_ghdr = {
+	.magic_number  = 0xa1b2c3d4,
+	.version_major = 2,
+	.version_minor = 4,
+	.thiszone      = 0,
+	.sigfigs       = 0,
+	.snaplen       = 0xFFFF,
+	.network       = DLT_IEEE802_11_RADIO
+};
+
 void write_pcap_header(FILE *o)
 {
-	pcap_hdr_t ghdr = {
-		.magic_number  = 0xa1b2c3d4,
-		.version_major = 2,
-		.version_minor = 4,
-		.thiszone      = 0,
-		.sigfigs       = 0,
-		.snaplen       = 0xFFFF,
-		.network       = DLT_IEEE802_11_RADIO
-	};
-
-	fwrite(&ghdr, 1, sizeof(ghdr), o);
+	fwrite(&pcap_ghdr, 1, sizeof(pcap_ghdr), o);
 }
 
 void write_pcap_frame(FILE *o, uint32_t *sec, uint32_t *usec,
@@ -211,7 +332,7 @@ struct ringbuf * ringbuf_init(uint32_t num_item, uint16_t len_item)
 		r.fill = 0;
 		r.slen = (len_item + sizeof(struct ringbuf_entry));
 
-		memset(r.buf, 0, num_item * len_item);
+		memset(r.buf, 0, num_item * r.slen);
 
 		return &r;
 	}
@@ -219,20 +340,22 @@ struct ringbuf * ringbuf_init(uint32_t num_item, uint16_t len_item)
 	return NULL;
 }
 
-struct ringbuf_entry * ringbuf_add(struct ringbuf *r)
+struct ringbuf_entry * ringbuf_add(struct ringbuf *r, uint8_t *frame,
+                                   uint32_t len, uint32_t olen,
+                                   uint32_t sec, uint32_t usec)
 {
-	struct timeval t;
 	struct ringbuf_entry *e;
-
-	gettimeofday(&t, NULL);
+	uint32_t max = r->slen - sizeof(*e);
 
 	e = r->buf + (r->fill++ * r->slen);
 	r->fill %= r->len;
 
-	memset(e, 0, r->slen);
+	e->sec = sec;
+	e->usec = usec;
+	e->len = (len > max) ? max : len;
+	e->olen = olen;
 
-	e->sec = t.tv_sec;
-	e->usec = t.tv_usec;
+	memcpy((void *)e + sizeof(*e), frame, e->len);
 
 	return e;
 }
@@ -253,6 +376,185 @@ void ringbuf_free(struct ringbuf *r)
 	memset(r, 0, sizeof(*r));
 }
 
+int ringbuf_dump(struct ringbuf *r, const char *file)
+{
+	struct iovec iov[IOV_BATCH];
+	struct ringbuf_entry *e;
+	int i, n = 0, fd;
+	int niov = 1;
+
+	if ((fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0)
+		return -1;
+
+	iov[0].iov_base = (void *)&pcap_ghdr;
+	iov[0].iov_len  = sizeof(pcap_ghdr);
+
+	/* each used slot already is a pcap record header followed by data */
+	for (i = 0; i < r->len; i++)
+	{
+		if (!(e = ringbuf_get(r, i)))
+			continue;
+
+		iov[niov].iov_base = e;
+		iov[niov].iov_len  = sizeof(*e) + e->len;
+		n++;
+
+		if (++niov == IOV_BATCH)
+		{
+			writev(fd, iov, niov);
+			niov = 0;
+		}
+	}
+
+	if (niov > 0)
+		writev(fd, iov, niov);
+
+	close(fd);
+
+	return n;
+}
+
+
+struct rxring * rxring_init(void)
+{
+	static struct rxring rx;
+
+	int ver = TPACKET_V3;
+	struct tpacket_req3 req = {
+		.tp_block_size     = RX_BLOCK_SIZE,
+		.tp_block_nr       = RX_BLOCK_NR,
+		.tp_frame_size     = RX_FRAME_SIZE,
+		.tp_frame_nr       = (RX_BLOCK_SIZE * RX_BLOCK_NR) / RX_FRAME_SIZE,
+		.tp_retire_blk_tov = RX_BLOCK_TOV
+	};
+
+	if (setsockopt(capture_sock, SOL_PACKET, PACKET_VERSION,
+	               &ver, sizeof(ver)))
+		return NULL;
+
+	if (setsockopt(capture_sock, SOL_PACKET, PACKET_RX_RING,
+	               &req, sizeof(req)))
+		return NULL;
+
+	rx.map = mmap(NULL, req.tp_block_size * req.tp_block_nr,
+	              PROT_READ | PROT_WRITE, MAP_SHARED, capture_sock, 0);
+
+	if (rx.map == MAP_FAILED)
+		return NULL;
+
+	rx.blksz = req.tp_block_size;
+	rx.blknr = req.tp_block_nr;
+	rx.cur = 0;
+
+	return &rx;
+}
+
+struct tpacket_block_desc * rxring_get(struct rxring *rx)
+{
+	struct tpacket_block_desc *bd =
+		(struct tpacket_block_desc *)(rx->map + rx->cur * rx->blksz);
+
+	if (!(bd->hdr.bh1.block_status & TP_STATUS_USER))
+		return NULL;
+
+	__sync_synchronize();
+
+	return bd;
+}
+
+void rxring_put(struct rxring *rx, struct tpacket_block_desc *bd)
+{
+	__sync_synchronize();
+
+	bd->hdr.bh1.block_status = TP_STATUS_KERNEL;
+	rx->cur = (rx->cur + 1) % rx->blknr;
+}
+
+void rxring_free(struct rxring *rx)
+{
+	munmap(rx->map, rx->blksz * rx->blknr);
+	memset(rx, 0, sizeof(*rx));
+}
+
+/*
+ * Write all frames of a retired block to stdout, the pcap record headers
+ * are interleaved with pointers into the ring so frame data is not copied.
+ */
+void rxring_stream(struct tpacket_block_desc *bd,
+                   uint8_t beacon, uint8_t data, uint8_t mgmt)
+{
+	struct tpacket3_hdr *ph;
+	pcaprec_hdr_t fhdr[IOV_BATCH / 2];
+	struct iovec iov[IOV_BATCH];
+	uint8_t *frame;
+	int i, niov = 0;
+
+	ph = (struct tpacket3_hdr *)((uint8_t *)bd + bd->hdr.bh1.offset_to_first_pkt);
+
+	for (i = 0; i < bd->hdr.bh1.num_pkts; i++,
+	     ph = (struct tpacket3_hdr *)((uint8_t *)ph + ph->tp_next_offset))
+	{
+		frames_captured++;
+		frame = (uint8_t *)ph + ph->tp_mac;
+
+		if (!filter_kernel &&
+		    frame_filtered(frame, ph->tp_snaplen, beacon, data, mgmt))
+		{
+			frames_filtered++;
+			continue;
+		}
+
+		fhdr[niov / 2].ts_sec   = ph->tp_sec;
+		fhdr[niov / 2].ts_usec  = ph->tp_nsec / 1000;
+		fhdr[niov / 2].incl_len = ph->tp_snaplen;
+		fhdr[niov / 2].orig_len = ph->tp_len;
+
+		iov[niov].iov_base = &fhdr[niov / 2];
+		iov[niov].iov_len  = sizeof(fhdr[0]);
+		niov++;
+
+		iov[niov].iov_base = frame;
+		iov[niov].iov_len  = ph->tp_snaplen;
+		niov++;
+
+		if (niov == IOV_BATCH)
+		{
+			writev(1, iov, niov);
+			niov = 0;
+		}
+	}
+
+	if (niov > 0)
+		writev(1, iov, niov);
+}
+
+void rxring_store(struct tpacket_block_desc *bd, struct ringbuf *r,
+                  uint8_t beacon, uint8_t data, uint8_t mgmt)
+{
+	struct tpacket3_hdr *ph;
+	uint8_t *frame;
+	int i;
+
+	ph = (struct tpacket3_hdr *)((uint8_t *)bd + bd->hdr.bh1.offset_to_first_pkt);
+
+	for (i = 0; i < bd->hdr.bh1.num_pkts; i++,
+	     ph = (struct tpacket3_hdr *)((uint8_t *)ph + ph->tp_next_offset))
+	{
+		frames_captured++;
+		frame = (uint8_t *)ph + ph->tp_mac;
+
+		if (!filter_kernel &&
+		    frame_filtered(frame, ph->tp_snaplen, beacon, data, mgmt))
+		{
+			frames_filtered++;
+			continue;
+		}
+
+		ringbuf_add(r, frame, ph->tp_snaplen, ph->tp_len,
+		            ph->tp_sec, ph->tp_nsec / 1000);
+	}
+}
+
 
 void msg(const char *fmt, ...)
 {
@@ -270,21 +572,19 @@ void msg(const char *fmt, ...)
 
 int main(int argc, char **argv)
 {
-	int i, n;
-	struct ringbuf *ring;
-	struct ringbuf_entry *e;
+	int n;
+	struct ringbuf *ring = NULL;
+	struct rxring *rx = NULL;
+	struct tpacket_block_desc *bd;
+	struct pollfd pfd;
 	struct sockaddr_ll local = {
 		.sll_family   = AF_PACKET,
 		.sll_protocol = htons(ETH_P_ALL)
 	};
 
-	radiotap_hdr_t *rhdr;
-
-	uint8_t frametype;
 	uint8_t pktbuf[0xFFFF];
 	ssize_t pktlen;
-
-	FILE *o;
+	struct timeval tv;
 
 	int opt;
 
@@ -293,6 +593,7 @@ int main(int argc, char **argv)
 	uint8_t foreground     = 0;
 	uint8_t filter_data    = 0;
 	uint8_t filter_beacon  = 0;
+	uint8_t filter_mgmt    = 0;
 	uint8_t header_written = 0;
 
 	uint32_t ringsz   = 1024 * 1024; /* 1 Mbyte ring buffer */
@@ -301,7 +602,7 @@ int main(int argc, char **argv)
 	const char *output = NULL;
 
 
-	while ((opt = getopt(argc, argv, "i:r:c:o:sfhBD")) != -1)
+	while ((opt = getopt(argc, argv, "i:r:c:o:sfhBDM")) != -1)
 	{
 		switch (opt)
 		{
@@ -351,6 +652,10 @@ int main(int argc, char **argv)
 			filter_data = 1;
 			break;
 
+		case 'M':
+			filter_mgmt = 1;
+			break;
+
 		case 'f':
 			foreground = 1;
 			break;
@@ -358,8 +663,8 @@ int main(int argc, char **argv)
 		case 'h':
 			msg(
 				"Usage:\n"
-				"  %s -i {iface} -s [-b] [-d]\n"
-				"  %s -i {iface} -o {file} [-r len] [-c len] [-B] [-D] [-f]\n"
+				"  %s -i {iface} -s [-B] [-D] [-M]\n"
+				"  %s -i {iface} -o {file} [-r len] [-c len] [-B] [-D] [-M] [-f]\n"
 				"\n"
 				"  -i iface\n"
 				"    Specify interface to use, must be in monitor mode and\n"
@@ -379,6 +684,8 @@ int main(int argc, char **argv)
 				"    Don't store beacon frames in ring, default is keep.\n\n"
 				"  -D\n"
 				"    Don't store data frames in ring, default is keep.\n\n"
+				"  -M\n"
+				"    Only store management frames in ring, default is all.\n\n"
 				"  -f\n"
 				"    Do not daemonize but keep running in foreground.\n\n"
 				"  -h\n"
@@ -426,6 +733,15 @@ int main(int argc, char **argv)
 		return 6;
 	}
 
+	/* set up ring and filter before binding so no frame bypasses them */
+	if (!(rx = rxring_init()))
+		msg("Unable to set up packet ring, falling back to recvfrom: %s\n",
+			strerror(errno));
+
+	if (!set_filter(filter_beacon, filter_data, filter_mgmt,
+	                (rx && !streaming) ? pktcap : 0xFFFF))
+		filter_kernel = 1;
+
 	if (bind(capture_sock, (struct sockaddr *)&local, sizeof(local)) == -1)
 	{
 		msg("Unable to bind to interface: %s\n",
@@ -481,6 +797,10 @@ int main(int argc, char **argv)
 
 	msg(" * Beacon frames are %sfiltered\n", filter_beacon ? "" : "not ");
 	msg(" * Data frames are %sfiltered\n", filter_data ? "" : "not ");
+	msg(" * Non-management frames are %sfiltered\n", filter_mgmt ? "" : "not ");
+	msg(" * Capturing through %s, filtering in %s\n",
+		rx ? "TPACKET_V3 ring" : "recvfrom",
+		filter_kernel ? "kernel" : "userspace");
 
 	signal(SIGINT, sig_teardown);
 	signal(SIGTERM, sig_teardown);
@@ -494,30 +814,16 @@ int main(int argc, char **argv)
 		{
 			msg("Dumping ring to %s ...\n", output);
 
-			if (!(o = fopen(output, "w")))
+			if ((n = ringbuf_dump(ring, output)) < 0)
 			{
 				msg("Unable to open %s: %s\n",
 					output, strerror(errno));
 			}
 			else
 			{
-				write_pcap_header(o);
-
-				/* sig_dump packet buffer */
-				for (i = 0, n = 0; i < ring->len; i++)
-				{
-					if (!(e = ringbuf_get(ring, i)))
-						continue;
-
-					write_pcap_frame(o, &(e->sec), &(e->usec), e->len, e->olen);
-					fwrite((void *)e + sizeof(*e), 1, e->len, o);
-					n++;
-				}
-
-				fclose(o);
-
 				msg(" * %d frames captured\n", frames_captured);
 				msg(" * %d frames filtered\n", frames_filtered);
+				msg(" * %d frames dropped\n", get_drops());
 				msg(" * %d frames dumped\n", n);
 			}
 
@@ -533,25 +839,50 @@ int main(int argc, char **argv)
 			if (ring)
 				ringbuf_free(ring);
 
+			if (rx)
+				rxring_free(rx);
+
 			return 0;
 		}
 
-		pktlen = recvfrom(capture_sock, pktbuf, sizeof(pktbuf), 0, NULL, 0);
-		frames_captured++;
-
-		/* check received frametype, if we should filter it, rewind the ring */
-		rhdr = (radiotap_hdr_t *)pktbuf;
+		if (streaming && !header_written)
+		{
+			write_pcap_header(stdout);
+			fflush(stdout);
+			header_written = 1;
+		}
 
-		if (pktlen <= sizeof(radiotap_hdr_t) || le16(rhdr->it_len) >= pktlen)
+		if (rx)
 		{
-			frames_filtered++;
+			/* wait for the kernel to retire the next block */
+			if (!(bd = rxring_get(rx)))
+			{
+				pfd.fd = capture_sock;
+				pfd.events = POLLIN | POLLERR;
+				poll(&pfd, 1, 1000);
+				continue;
+			}
+
+			if (streaming)
+				rxring_stream(bd, filter_beacon, filter_data, filter_mgmt);
+			else
+				rxring_store(bd, ring, filter_beacon, filter_data, filter_mgmt);
+
+			rxring_put(rx, bd);
 			continue;
 		}
 
-		frametype = *(uint8_t *)(pktbuf + le16(rhdr->it_len));
+		pktlen = recvfrom(capture_sock, pktbuf, sizeof(pktbuf), 0, NULL, 0);
+
+		if (pktlen < 0)
+			continue;
+
+		frames_captured++;
 
-		if ((filter_data   && (frametype & FRAMETYPE_MASK) == FRAMETYPE_DATA) ||
-		    (filter_beacon && (frametype & FRAMETYPE_MASK) == FRAMETYPE_BEACON))
+		/* check received frametype, if we should filter it, rewind the ring */
+		if (!filter_kernel &&
+		    frame_filtered(pktbuf, pktlen,
+		                   filter_beacon, filter_data, filter_mgmt))
 		{
 			frames_filtered++;
 			continue;
@@ -559,23 +890,14 @@ int main(int argc, char **argv)
 
 		if (streaming)
 		{
-			if (!header_written)
-			{
-				write_pcap_header(stdout);
-				header_written = 1;
-			}
-
 			write_pcap_frame(stdout, NULL, NULL, pktlen, pktlen);
 			fwrite(pktbuf, 1, pktlen, stdout);
 			fflush(stdout);
 		}
 		else
 		{
-			e = ringbuf_add(ring);
-			e->olen = pktlen;
-			e->len = (pktlen > pktcap) ? pktcap : pktlen;
-
-			memcpy((void *)e + sizeof(*e), pktbuf, e->len);
+			gettimeofday(&tv, NULL);
+			ringbuf_add(ring, pktbuf, pktlen, pktlen, tv.tv_sec, tv.tv_usec);
 		}
 	}
 
@@ -46,6 +46,8 @@
 #include <mtd/mtd-user.h>
 #include <assert.h>
 
+#include "tffs_index.h"
+
 #define DEFAULT_TFFS_SIZE	(256 * 1024)
 
 #define TFFS_ID_END		0xffffffff
@@ -62,6 +64,9 @@
 
 #define TFFS_SEGMENT_CLEARED 0xffffffff
 
+/* erase block size assumed for raw images without -e */
+#define DEFAULT_IMAGE_BLOCKSIZE	(128 * 1024)
+
 static char *progname;
 static char *mtddev;
 static char *name_filter = NULL;
@@ -69,11 +74,14 @@ static bool show_all = false;
 static bool print_all_key_names = false;
 static bool read_oob_sector_health = false;
 static bool swap_bytes = false;
+static bool raw_image = false;
+static uint32_t image_blocksize = DEFAULT_IMAGE_BLOCKSIZE;
 static uint8_t readbuf[TFFS_SECTOR_SIZE];
 static uint8_t oobbuf[TFFS_SECTOR_OOB_SIZE];
 static uint32_t blocksize;
 static int mtdfd;
 struct tffs_sectors *sectors;
+static struct tffs_index entry_index;
 
 struct tffs_sectors {
 	uint32_t num_sectors;
@@ -133,8 +141,21 @@ static inline uint64_t read_uint64(void *buf, ptrdiff_t off)
 	return tmp;
 }
 
+/*
+ * Raw images (e.g. nanddump --oob) store the OOB data of each sector right
+ * behind it, so sector pos of the flash starts at this image offset.
+ */
+static inline off_t image_pos(off_t pos)
+{
+	return pos / TFFS_SECTOR_SIZE * (TFFS_SECTOR_SIZE + TFFS_SECTOR_OOB_SIZE);
+}
+
 static int read_sector(off_t pos)
 {
+	if (raw_image) {
+		pos = image_pos(pos);
+	}
+
 	if (pread(mtdfd, readbuf, TFFS_SECTOR_SIZE, pos) != TFFS_SECTOR_SIZE) {
 		return -1;
 	}
@@ -150,6 +171,14 @@ static int read_sectoroob(off_t pos)
 		.ptr = oobbuf
 	};
 
+	if (raw_image) {
+		if (pread(mtdfd, oobbuf, TFFS_SECTOR_OOB_SIZE,
+			  image_pos(pos) + TFFS_SECTOR_SIZE) != TFFS_SECTOR_OOB_SIZE) {
+			return -1;
+		}
+		return 0;
+	}
+
 	if (ioctl(mtdfd, MEMREADOOB, &oob) < 0)	{
 		return -1;
 	}
@@ -168,12 +197,8 @@ static void print_entry_value(const struct tffs_entry *entry)
 	fwrite(entry->val, 1, entry->len, stdout);
 }
 
-static int find_entry(uint32_t id, struct tffs_entry *entry)
+static void build_index(void)
 {
-	uint32_t rev = 0;
-	uint32_t num_segments = 0;
-	struct tffs_entry_segment *segments = NULL;
-
 	off_t pos = 0;
 	uint8_t block_end = 0;
 	for (uint32_t sector = 0; sector < sectors->num_sectors; sector++, pos += TFFS_SECTOR_SIZE) {
@@ -205,66 +230,53 @@ static int find_entry(uint32_t id, struct tffs_entry *entry)
 				fprintf(stderr, "Warning: segment is longer than possible\n");
 				continue;
 			}
-			if (read_id == id) {
-				if (read_rev < rev) {
-					/* obsolete revision => ignore this */
-					continue;
-				}
-				if (read_rev > rev) {
-					/* newer revision => clear old data */
-					for (uint32_t i = 0; i < num_segments; i++) {
-						free(segments[i].val);
-					}
-					free (segments);
-					rev = read_rev;
-					num_segments = 0;
-					segments = NULL;
-				}
-
-				uint32_t seg = read_uint32(readbuf, 0x10);
-
-				if (seg == TFFS_SEGMENT_CLEARED) {
-					continue;
-				}
-
-				uint32_t next_seg = read_uint32(readbuf, 0x14);
-
-				uint32_t new_num_segs = next_seg == 0 ? seg + 1 : next_seg + 1;
-				if (new_num_segs > num_segments) {
-					segments = realloc(segments, new_num_segs * sizeof(struct tffs_entry_segment));
-					memset(segments + (num_segments * sizeof(struct tffs_entry_segment)), 0x0,
-							(new_num_segs - num_segments) * sizeof(struct tffs_entry_segment));
-					num_segments = new_num_segs;
-				}
-				segments[seg].len = read_len;
-				segments[seg].val = malloc(read_len);
-				memcpy(segments[seg].val, readbuf + TFFS_ENTRY_HEADER_SIZE, read_len);
+
+			struct tffs_index_entry *entry = tffs_index_add(&entry_index, read_id);
+			if (read_rev < entry->rev) {
+				/* obsolete revision => ignore this */
+				continue;
+			}
+			if (read_rev > entry->rev) {
+				/* newer revision => forget old segments */
+				tffs_index_clear_segments(entry);
+				entry->rev = read_rev;
 			}
-		}
-	}
 
-	if (num_segments == 0) {
-		return 0;
-	}
+			uint32_t seg = read_uint32(readbuf, 0x10);
+
+			if (seg == TFFS_SEGMENT_CLEARED) {
+				continue;
+			}
 
-	assert (segments != NULL);
+			uint32_t next_seg = read_uint32(readbuf, 0x14);
 
-	uint32_t len = 0;
-	for (uint32_t i = 0; i < num_segments; i++) {
-		if (segments[i].val == NULL) {
-			/* missing segment */
-			return 0;
+			uint32_t new_num_segs = next_seg == 0 ? seg + 1 : next_seg + 1;
+			tffs_index_set_segment(entry, seg, new_num_segs, read_len, pos);
 		}
+	}
+}
+
+static int find_entry(uint32_t id, struct tffs_entry *entry)
+{
+	struct tffs_index_entry *found = tffs_index_find(&entry_index, id);
+	int64_t len = tffs_index_entry_len(found);
 
-		len += segments[i].len;
+	if (len < 0) {
+		return 0;
 	}
 
+	assert (found->segments != NULL);
+
 	void *p = malloc(len);
 	entry->val = p;
 	entry->len = len;
-	for (uint32_t i = 0; i < num_segments; i++) {
-		memcpy(p, segments[i].val, segments[i].len);
-		p += segments[i].len;
+	for (uint32_t i = 0; i < found->num_segments; i++) {
+		if (read_sector(found->segments[i].pos)) {
+			fprintf(stderr, "ERROR: sector isn't readable, but has been previously!\n");
+			exit(EXIT_FAILURE);
+		}
+		memcpy(p, readbuf + TFFS_ENTRY_HEADER_SIZE, found->segments[i].len);
+		p += found->segments[i].len;
 	}
 
 	return 1;
@@ -407,8 +419,17 @@ static int check_block(off_t pos, uint32_t sector)
 static int scan_mtd(void)
 {
 	struct mtd_info_user info;
+	struct stat st;
+
+	if (fstat(mtdfd, &st)) {
+		return 0;
+	}
 
-	if (ioctl(mtdfd, MEMGETINFO, &info)) {
+	if (S_ISREG(st.st_mode)) {
+		raw_image = true;
+		info.erasesize = image_blocksize;
+		info.size = st.st_size / (TFFS_SECTOR_SIZE + TFFS_SECTOR_OOB_SIZE) * TFFS_SECTOR_SIZE;
+	} else if (ioctl(mtdfd, MEMGETINFO, &info)) {
 		return 0;
 	}
 
@@ -450,7 +471,8 @@ static void usage(int status)
 	"\n"
 	"Options:\n"
 	"  -a              list all key value pairs found in the TFFS file/device\n"
-	"  -d <mtd>        inspect the TFFS on mtd device <mtd>\n"
+	"  -d <mtd>        inspect the TFFS on mtd device <mtd> or raw image with OOB\n"
+	"  -e <size>       erase block size of a raw image (default 128KiB)\n"
 	"  -h              show this screen\n"
 	"  -l              list all supported keys\n"
 	"  -n <key name>   display the value of the given key\n"
@@ -465,7 +487,7 @@ static void parse_options(int argc, char *argv[])
 	while (1) {
 		int c;
 
-		c = getopt(argc, argv, "abd:hln:o");
+		c = getopt(argc, argv, "abd:e:hln:o");
 		if (c == -1)
 			break;
 
@@ -481,6 +503,13 @@ static void parse_options(int argc, char *argv[])
 		case 'd':
 			mtddev = optarg;
 			break;
+		case 'e':
+			image_blocksize = strtoul(optarg, NULL, 0);
+			if (!image_blocksize || image_blocksize % TFFS_SECTOR_SIZE) {
+				fprintf(stderr, "ERROR: invalid erase block size %s\n", optarg);
+				usage(EXIT_FAILURE);
+			}
+			break;
 		case 'h':
 			usage(EXIT_SUCCESS);
 			break;
@@ -538,10 +567,13 @@ int main(int argc, char *argv[])
 		goto out_close;
 	}
 
+	tffs_index_init(&entry_index);
+	build_index();
+
 	if (!find_entry(TFFS_ID_TABLE_NAME, &name_table)) {
 		fprintf(stderr, "ERROR: No name table found on tffs device %s\n",
 			mtddev);
-		goto out_free_sectors;
+		goto out_free_index;
 	}
 
 	parse_key_names(&name_table, &key_names);
@@ -563,7 +595,8 @@ int main(int argc, char *argv[])
 	free(key_names.entries);
 out_free_entry:
 	free(name_table.val);
-out_free_sectors:
+out_free_index:
+	tffs_index_free(&entry_index);
 	free(sectors);
 out_close:
 	close(mtdfd);
@@ -36,6 +36,8 @@
 #include <sys/stat.h>
 #include <arpa/inet.h>
 
+#include "tffs_index.h"
+
 #define TFFS_ID_END		0xffff
 #define TFFS_ID_TABLE_NAME	0x01ff
 
@@ -46,6 +48,7 @@ static char *name_filter = NULL;
 static bool show_all = false;
 static bool print_all_key_names = false;
 static bool swap_bytes = false;
+static struct tffs_index entry_index;
 
 struct tffs_entry_header {
 	uint16_t id;
@@ -113,21 +116,35 @@ static void parse_entry(uint8_t *buffer, uint32_t pos,
 	entry->val = &buffer[pos + sizeof(struct tffs_entry_header)];
 }
 
-static int find_entry(uint8_t *buffer, uint16_t id, struct tffs_entry *entry)
+static void build_index(uint8_t *buffer)
 {
 	uint32_t pos = 0;
+	struct tffs_entry tmp;
+	struct tffs_index_entry *found;
 
 	do {
-		parse_entry(buffer, pos, entry);
+		parse_entry(buffer, pos, &tmp);
 
-		if (get_header_id(entry->header) == id)
-			return 1;
+		/* the first entry with an id wins */
+		found = tffs_index_add(&entry_index, get_header_id(tmp.header));
+		if (!found->num_segments)
+			tffs_index_set_segment(found, 0, 1,
+					       get_header_len(tmp.header), pos);
 
 		pos += sizeof(struct tffs_entry_header);
-		pos += get_walk_size(get_header_len(entry->header));
-	} while (pos < tffs_size && entry->header->id != TFFS_ID_END);
+		pos += get_walk_size(get_header_len(tmp.header));
+	} while (pos < tffs_size && tmp.header->id != TFFS_ID_END);
+}
 
-	return 0;
+static int find_entry(uint8_t *buffer, uint16_t id, struct tffs_entry *entry)
+{
+	struct tffs_index_entry *found = tffs_index_find(&entry_index, id);
+
+	if (!found || !found->num_segments)
+		return 0;
+
+	parse_entry(buffer, found->segments[0].pos, entry);
+	return 1;
 }
 
 static void parse_key_names(struct tffs_entry *names_entry,
@@ -346,6 +363,9 @@ int main(int argc, char *argv[])
 		goto out_free;
 	}
 
+	tffs_index_init(&entry_index);
+	build_index(buffer);
+
 	if (!find_entry(buffer, TFFS_ID_TABLE_NAME, &name_table)) {
 		fprintf(stderr,"ERROR: No name table found in tffs file %s\n",
 			input_file);
@@ -372,6 +392,7 @@ int main(int argc, char *argv[])
 out_free_names:
 	free(key_names.entries);
 out_free:
+	tffs_index_free(&entry_index);
 	fclose(fp);
 	free(buffer);
 out:
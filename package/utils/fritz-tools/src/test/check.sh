@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+# Check fritz_tffs_read and fritz_tffs_nand_read against the synthetic
+# images written by mk_tffs_images.py.
+#
+# usage: check.sh <directory holding the built tools>
+
+[ -n "$1" ] || { echo "usage: $0 <bindir>" >&2; exit 1; }
+
+bindir=$1
+srcdir=$(dirname "$0")
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+python3 "$srcdir/mk_tffs_images.py" "$tmp" || exit 1
+
+ret=0
+check() {
+	name=$1; shift
+	if ! "$@" > "$tmp/$name.out"; then
+		echo "FAIL: $name: $*"
+		ret=1
+	elif ! cmp -s "$tmp/$name.out" "$tmp/$name.expect"; then
+		echo "FAIL: $name: output differs"
+		diff "$tmp/$name.expect" "$tmp/$name.out" | head -n 20
+		ret=1
+	else
+		echo "ok: $name"
+	fi
+}
+
+check tffs2 "$bindir/fritz_tffs_read" -i "$tmp/tffs2.img" -a
+check tffs3 "$bindir/fritz_tffs_nand_read" -d "$tmp/tffs3.nanddump" -e 0x4000 -a
+
+exit $ret
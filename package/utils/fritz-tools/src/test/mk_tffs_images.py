@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+#
+# Write small synthetic TFFS images and the output fritz_tffs_read and
+# fritz_tffs_nand_read are expected to print for them with -a.
+#
+# usage: mk_tffs_images.py <outdir>
+#
+#   tffs2.img        TFFS2 (NOR) partition in host byte order
+#   tffs2.expect
+#   tffs3.nanddump   TFFS3 (NAND) partition with OOB data after each
+#                    sector, erase block size TFFS3_BLOCKSIZE
+#   tffs3.expect
+#
+# The TFFS3 image covers entries with several revisions stored out of
+# order, segments spread over different blocks, and a newest revision
+# with a missing segment, which hides the entry.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+
+import os
+import struct
+import sys
+
+SECTOR = 0x800
+OOB = 0x40
+SECTORS_PER_BLOCK = 8
+BLOCKS = 6
+TFFS3_BLOCKSIZE = SECTOR * SECTORS_PER_BLOCK
+SEGMENT_MAX = SECTOR - 0x18
+BLOCK_MAGIC = 0x41564d5f54464653
+ID_NAME_TABLE = 0x1ff
+
+
+def name_table(keys):
+    out = b''
+    for kid, name in keys:
+        raw = name.encode() + b'\0'
+        out += struct.pack('<I', kid) + raw + b'\0' * (-len(raw) % 4)
+    return out
+
+
+class Nand:
+    def __init__(self):
+        self.sectors = [[b'\xff' * SECTOR, b'\xff' * OOB]
+                        for _ in range(BLOCKS * SECTORS_PER_BLOCK)]
+        self.fill = [1] * BLOCKS
+        for b in range(BLOCKS):
+            hdr = bytearray(b'\xff' * SECTOR)
+            hdr[0x00:0x08] = struct.pack('<Q', BLOCK_MAGIC)
+            hdr[0x0c:0x10] = struct.pack('<I', 2)
+            hdr[0x1c:0x2c] = struct.pack('<QQ', 0, 0)
+            self.sectors[b * SECTORS_PER_BLOCK][0] = bytes(hdr)
+
+    def put(self, block, kid, rev, seg, next_seg, data):
+        assert len(data) <= SEGMENT_MAX
+        assert self.fill[block] < SECTORS_PER_BLOCK
+        sector = block * SECTORS_PER_BLOCK + self.fill[block]
+        self.fill[block] += 1
+        d = bytearray(b'\xff' * SECTOR)
+        d[0:0x18] = struct.pack('<IIIIII', kid, len(data), 0, rev, seg,
+                                next_seg)
+        d[0x18:0x18 + len(data)] = data
+        o = bytearray(b'\xff' * OOB)
+        o[2:14] = struct.pack('<III', kid, len(data), rev)
+        self.sectors[sector] = [bytes(d), bytes(o)]
+
+    def put_entry(self, blocks, kid, rev, data, skip=()):
+        segs = [data[i:i + SEGMENT_MAX]
+                for i in range(0, len(data), SEGMENT_MAX)] or [b'']
+        assert len(blocks) == len(segs)
+        for i, seg in enumerate(segs):
+            if i not in skip:
+                nxt = i + 1 if i + 1 < len(segs) else 0
+                self.put(blocks[i], kid, rev, i, nxt, seg)
+
+    def image(self):
+        return b''.join(d + o for d, o in self.sectors)
+
+
+def value(name, rev, size):
+    v = ('%s-rev%d;' % (name, rev)).encode()
+    return (v * (size // len(v) + 1))[:size]
+
+
+def tffs3(outdir):
+    keys = [(0x100, 'single'), (0x101, 'revisions'), (0x102, 'spread'),
+            (0x103, 'missing'), (0x104, 'empty'), (0x105, 'stale')]
+    nand = Nand()
+    expect = {}
+
+    # name table itself in two segments, second one in an earlier block
+    nt = name_table(keys)
+    half = len(nt) // 2
+    nand.put(3, ID_NAME_TABLE, 1, 0, 1, nt[:half])
+    nand.put(0, ID_NAME_TABLE, 1, 1, 0, nt[half:])
+
+    nand.put_entry([0], 0x100, 1, value('single', 1, 100))
+    expect['single'] = value('single', 1, 100)
+
+    # newest revision stored before the older ones
+    nand.put_entry([1], 0x101, 3, value('revisions', 3, 300))
+    nand.put_entry([2], 0x101, 1, value('revisions', 1, 200))
+    nand.put_entry([4, 5], 0x101, 2, value('revisions', 2, 2500))
+    expect['revisions'] = value('revisions', 3, 300)
+
+    # three segments, stored in blocks 5, 1 and 2
+    v = value('spread', 1, 2 * SEGMENT_MAX + 100)
+    nand.put_entry([5, 1, 2], 0x102, 1, v)
+    expect['spread'] = v
+
+    # complete revision 1, revision 2 lacks its second segment
+    nand.put_entry([0], 0x103, 1, value('missing', 1, 50))
+    nand.put_entry([3, 4, 5], 0x103, 2,
+                   value('missing', 2, 2 * SEGMENT_MAX + 10), skip=(1,))
+
+    nand.put_entry([2], 0x104, 1, b'')
+    expect['empty'] = b''
+
+    # longer older revision in more segments than the current one
+    nand.put_entry([4, 5], 0x105, 1, value('stale', 1, SEGMENT_MAX + 5))
+    nand.put_entry([1], 0x105, 2, value('stale', 2, 40))
+    expect['stale'] = value('stale', 2, 40)
+
+    with open(os.path.join(outdir, 'tffs3.nanddump'), 'wb') as f:
+        f.write(nand.image())
+    with open(os.path.join(outdir, 'tffs3.expect'), 'wb') as f:
+        for kid, name in keys:
+            if name in expect:
+                f.write(name.encode() + b'=' + expect[name] + b'\n')
+
+
+def tffs2(outdir):
+    keys = [(0x100 + i, 'key%02d' % i) for i in range(20)]
+
+    # name table ids are 32 bit, entry headers 16 bit, both host order
+    def entry(kid, data):
+        return (struct.pack('=HH', kid, len(data)) + data +
+                b'\0' * (-len(data) % 4))
+
+    img = entry(ID_NAME_TABLE, name_table(keys))
+    expect = b''
+    for kid, name in keys:
+        v = ('v-%s' % name).encode() * (kid % 5 + 1)
+        img += entry(kid, v)
+        expect += name.encode() + b'=' + v + b'\n'
+        # a later copy of an entry does not replace the first one
+        if kid % 7 == 0:
+            img += entry(kid, b'duplicate')
+    img += struct.pack('=HH', 0xffff, 0) + b'\xff' * 64
+
+    with open(os.path.join(outdir, 'tffs2.img'), 'wb') as f:
+        f.write(img)
+    with open(os.path.join(outdir, 'tffs2.expect'), 'wb') as f:
+        f.write(expect)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        sys.exit('usage: %s <outdir>' % sys.argv[0])
+    tffs3(sys.argv[1])
+    tffs2(sys.argv[1])
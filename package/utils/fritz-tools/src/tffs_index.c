@@ -0,0 +1,188 @@
+/*
+ * In-memory index of the entries of a TFFS partition, shared by the
+ * fritz_tffs_read and fritz_tffs_nand_read tools.
+ *
+ * The partition is walked once to fill the index, lookups of single
+ * keys are then done without touching the flash again.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tffs_index.h"
+
+#define TFFS_INDEX_MIN_SIZE	64
+
+static void *xrealloc(void *ptr, size_t size)
+{
+	ptr = realloc(ptr, size);
+	if (ptr == NULL) {
+		fprintf(stderr, "ERROR: memory allocation failed!\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return ptr;
+}
+
+static inline uint32_t hash_id(uint32_t id)
+{
+	id ^= id >> 16;
+	id *= 0x7feb352d;
+	id ^= id >> 15;
+	return id;
+}
+
+static struct tffs_index_entry *lookup(const struct tffs_index *index,
+				       uint32_t id)
+{
+	uint32_t mask = index->size - 1;
+	uint32_t slot = hash_id(id) & mask;
+
+	while (index->entries[slot].id != id &&
+	       index->entries[slot].id != TFFS_INDEX_FREE)
+		slot = (slot + 1) & mask;
+
+	return &index->entries[slot];
+}
+
+static void resize(struct tffs_index *index, uint32_t size)
+{
+	struct tffs_index old = *index;
+
+	index->size = size;
+	index->entries = xrealloc(NULL, size * sizeof(*index->entries));
+	for (uint32_t i = 0; i < size; i++) {
+		index->entries[i].id = TFFS_INDEX_FREE;
+	}
+
+	for (uint32_t i = 0; i < old.size; i++) {
+		if (old.entries[i].id != TFFS_INDEX_FREE) {
+			*lookup(index, old.entries[i].id) = old.entries[i];
+		}
+	}
+
+	free(old.entries);
+}
+
+void tffs_index_init(struct tffs_index *index)
+{
+	index->size = 0;
+	index->used = 0;
+	index->entries = NULL;
+	resize(index, TFFS_INDEX_MIN_SIZE);
+}
+
+void tffs_index_free(struct tffs_index *index)
+{
+	for (uint32_t i = 0; i < index->size; i++) {
+		free(index->entries[i].segments);
+	}
+
+	free(index->entries);
+	index->entries = NULL;
+	index->size = 0;
+	index->used = 0;
+}
+
+struct tffs_index_entry *tffs_index_find(const struct tffs_index *index,
+					 uint32_t id)
+{
+	struct tffs_index_entry *entry;
+
+	if (id == TFFS_INDEX_FREE) {
+		return NULL;
+	}
+
+	entry = lookup(index, id);
+	return entry->id == id ? entry : NULL;
+}
+
+struct tffs_index_entry *tffs_index_add(struct tffs_index *index, uint32_t id)
+{
+	struct tffs_index_entry *entry;
+
+	if (id == TFFS_INDEX_FREE) {
+		return NULL;
+	}
+
+	entry = lookup(index, id);
+	if (entry->id == id) {
+		return entry;
+	}
+
+	/* keep the load below 3/4 */
+	if ((index->used + 1) * 4 > index->size * 3) {
+		resize(index, index->size * 2);
+		entry = lookup(index, id);
+	}
+
+	entry->id = id;
+	entry->rev = 0;
+	entry->num_segments = 0;
+	entry->segments = NULL;
+	index->used++;
+
+	return entry;
+}
+
+void tffs_index_clear_segments(struct tffs_index_entry *entry)
+{
+	free(entry->segments);
+	entry->segments = NULL;
+	entry->num_segments = 0;
+}
+
+void tffs_index_set_segment(struct tffs_index_entry *entry, uint32_t seg,
+			    uint32_t num_segments, uint32_t len, off_t pos)
+{
+	if (num_segments <= seg) {
+		num_segments = seg + 1;
+	}
+
+	if (num_segments > entry->num_segments) {
+		entry->segments = xrealloc(entry->segments,
+				num_segments * sizeof(*entry->segments));
+		memset(entry->segments + entry->num_segments, 0x0,
+		       (num_segments - entry->num_segments) * sizeof(*entry->segments));
+		entry->num_segments = num_segments;
+	}
+
+	entry->segments[seg].len = len;
+	entry->segments[seg].pos = pos;
+	entry->segments[seg].present = 1;
+}
+
+int64_t tffs_index_entry_len(const struct tffs_index_entry *entry)
+{
+	int64_t len = 0;
+
+	if (entry == NULL || entry->num_segments == 0) {
+		return -1;
+	}
+
+	for (uint32_t i = 0; i < entry->num_segments; i++) {
+		if (!entry->segments[i].present) {
+			/* missing segment */
+			return -1;
+		}
+
+		len += entry->segments[i].len;
+	}
+
+	return len;
+}
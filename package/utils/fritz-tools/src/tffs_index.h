@@ -0,0 +1,66 @@
+/*
+ * In-memory index of the entries of a TFFS partition, shared by the
+ * fritz_tffs_read and fritz_tffs_nand_read tools.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef TFFS_INDEX_H
+#define TFFS_INDEX_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/* never a valid entry id in either TFFS version, marks a free slot */
+#define TFFS_INDEX_FREE		0xffffffff
+
+struct tffs_index_segment {
+	uint32_t len;
+	off_t pos;	/* where the segment is stored */
+	uint8_t present;
+};
+
+struct tffs_index_entry {
+	uint32_t id;
+	uint32_t rev;
+	uint32_t num_segments;
+	struct tffs_index_segment *segments;
+};
+
+struct tffs_index {
+	uint32_t size;	/* number of slots, a power of two */
+	uint32_t used;
+	struct tffs_index_entry *entries;
+};
+
+void tffs_index_init(struct tffs_index *index);
+void tffs_index_free(struct tffs_index *index);
+
+/* entry for id, or NULL if the partition holds none */
+struct tffs_index_entry *tffs_index_find(const struct tffs_index *index,
+					 uint32_t id);
+
+/* entry for id, a new one with revision 0 and no segments if needed */
+struct tffs_index_entry *tffs_index_add(struct tffs_index *index, uint32_t id);
+
+void tffs_index_clear_segments(struct tffs_index_entry *entry);
+
+void tffs_index_set_segment(struct tffs_index_entry *entry, uint32_t seg,
+			    uint32_t num_segments, uint32_t len, off_t pos);
+
+/* total length if all segments of the entry are present, -1 otherwise */
+int64_t tffs_index_entry_len(const struct tffs_index_entry *entry);
+
+#endif /* TFFS_INDEX_H */
@@ -284,8 +284,9 @@ static int nss_match_cmd_procfs_config_handler(struct ctl_table *ctl, int write,
 	{
 		uint32_t profile_type = 0;
 		uint32_t table_id = 0;
-		int rule_id = -1;
-		struct nss_match_msg input_rule_param = {0};
+		int rule_id = -1, added = 0;
+		char *rule_str;
+		struct nss_match_msg input_rule_param;
 
 		token = strsep(&input_msg, " ");
 		param = strsep(&token, "=");
@@ -311,25 +312,50 @@ static int nss_match_cmd_procfs_config_handler(struct ctl_table *ctl, int write,
 
 		nss_match_db_get_profile_type(table_id, &profile_type);
 
-		if (nss_match_db_parse_cmd(table_id, input_msg, &input_rule_param, NSS_MATCH_ADD_RULE)) {
-			pr_warn("%px: Wrong input", ctl);
-			kfree(input_msg_orig);
-			return -EINVAL;
+		/*
+		 * Several rules can be given at once, separated by ';'.
+		 * Stop at the first rule which can't be added.
+		 */
+		while (input_msg != NULL) {
+			rule_str = strim(strsep(&input_msg, ";"));
+			if (!*rule_str) {
+				continue;
+			}
+
+			memset(&input_rule_param, 0, sizeof(input_rule_param));
+			if (nss_match_db_parse_cmd(table_id, rule_str, &input_rule_param, NSS_MATCH_ADD_RULE)) {
+				pr_warn("%px: Wrong input, %d rules added to table %d", ctl, added, table_id);
+				kfree(input_msg_orig);
+				return -EINVAL;
+			}
+
+			rule_id = -1;
+			if (profile_type == NSS_MATCH_PROFILE_TYPE_VOW) {
+				rule_id = nss_match_vow_rule_add(nss_ctx, &input_rule_param.msg.vow_rule, table_id);
+			} else if (profile_type == NSS_MATCH_PROFILE_TYPE_L2) {
+				rule_id = nss_match_l2_rule_add(nss_ctx, &input_rule_param.msg.l2_rule, table_id);
+			}
+
+			if (rule_id < 0) {
+				pr_warn("%px: Failed to add rule into table %d, %d rules added.\n", ctl, table_id, added);
+				kfree(input_msg_orig);
+				return -EINVAL;
+			}
+
+			added++;
 		}
 
-		if (profile_type == NSS_MATCH_PROFILE_TYPE_VOW) {
-			rule_id = nss_match_vow_rule_add(nss_ctx, &input_rule_param.msg.vow_rule, table_id);
-		} else if (profile_type == NSS_MATCH_PROFILE_TYPE_L2) {
-			rule_id = nss_match_l2_rule_add(nss_ctx, &input_rule_param.msg.l2_rule, table_id);
+		if (!added) {
+			ret = -EINVAL;
+			goto fail;
 		}
 
-		if (rule_id < 0) {
-			pr_warn("%px: Failed to add rule into table %d.\n", ctl, table_id);
-			kfree(input_msg_orig);
-			return -EINVAL;
+		if (added == 1) {
+			pr_warn("%px: Rule added to table %d successfully with rule_id: %d\n", ctl, table_id, rule_id);
+		} else {
+			pr_warn("%px: %d rules added to table %d successfully, last rule_id: %d\n", ctl, added, table_id, rule_id);
 		}
 
-		pr_warn("%px: Rule added to table %d successfully with rule_id: %d\n", ctl, table_id, rule_id);
 		kfree(input_msg_orig);
 		return count;
 	}
@@ -337,7 +363,15 @@ static int nss_match_cmd_procfs_config_handler(struct ctl_table *ctl, int write,
 	case NSS_MATCH_DELETE_RULE:
 	{
 		uint32_t table_id = 0;
-		uint16_t rule_id = 0;
+		unsigned int rule_id;
+		int deleted = 0;
+
+		/*
+		 * Rule IDs are 1 based, bit 0 is never valid.
+		 */
+		DECLARE_BITMAP(rule_ids, NSS_MATCH_INSTANCE_RULE_MAX + 1);
+
+		bitmap_zero(rule_ids, NSS_MATCH_INSTANCE_RULE_MAX + 1);
 
 		while (input_msg != NULL) {
 			token = strsep(&input_msg, " ");
@@ -348,10 +382,11 @@ static int nss_match_cmd_procfs_config_handler(struct ctl_table *ctl, int write,
 
 			/*
 			 * Parsing rule_id and table_id value from the message.
+			 * rule_id takes a list of IDs and ranges, e.g. 1,4-9.
 			 */
 			if (!(strncasecmp(param, "rule_id", strlen("rule_id")))) {
-				if (!sscanf(token, "%hu", &rule_id)) {
-					pr_warn("%px: Cannot convert to integer. Wrong input\n", ctl);
+				if (bitmap_parselist(strim(token), rule_ids, NSS_MATCH_INSTANCE_RULE_MAX + 1)) {
+					pr_warn("%px: Invalid rule_id list. Wrong input\n", ctl);
 					kfree(input_msg_orig);
 					return -EINVAL;
 				}
@@ -377,19 +412,23 @@ static int nss_match_cmd_procfs_config_handler(struct ctl_table *ctl, int write,
 			return -EINVAL;
 		}
 
-		if (rule_id == 0 || rule_id > NSS_MATCH_INSTANCE_RULE_MAX) {
-			pr_warn("%px: Invalid rule_id: %d", ctl, rule_id);
+		if (test_bit(0, rule_ids) || bitmap_empty(rule_ids, NSS_MATCH_INSTANCE_RULE_MAX + 1)) {
+			pr_warn("%px: Invalid rule_id", ctl);
 			kfree(input_msg_orig);
 			return -EINVAL;
 		}
 
-		if (nss_match_rule_delete(nss_ctx, rule_id, table_id)) {
-			pr_warn("%px: Failed to delete rule from table %d.\n", ctl, table_id);
-			kfree(input_msg_orig);
-			return -EINVAL;
+		for_each_set_bit(rule_id, rule_ids, NSS_MATCH_INSTANCE_RULE_MAX + 1) {
+			if (nss_match_rule_delete(nss_ctx, rule_id, table_id)) {
+				pr_warn("%px: Failed to delete rule %u from table %d, %d rules deleted.\n",
+						ctl, rule_id, table_id, deleted);
+				kfree(input_msg_orig);
+				return -EINVAL;
+			}
+			deleted++;
 		}
 
-		pr_warn("%px: Rule deleted from table %d successfully\n", ctl, table_id);
+		pr_warn("%px: %d rules deleted from table %d successfully\n", ctl, deleted, table_id);
 		kfree(input_msg_orig);
 		return count;
 	}
@@ -647,6 +686,10 @@ static int nss_match_cmd_procfs_read_help(struct ctl_table *ctl, int write, void
 			dmac=<1..ffffffffffff> ethertype=<1..ffff> > config\n\
 		3. To enable match instance \n\
 			echo enable table_id=1 > config \n\
+		4. To add rules, several rules can be separated by ';': \n\
+			echo addrule table_id=1 <rule> [; <rule> ...] > config \n\
+		   To delete rules, rule_id takes a list such as 1,4-9: \n\
+			echo delrule table_id=1 rule_id=<list> > config \n\
 		5. Actions:\n\
 			a. action=1 priority=<pri_value>\n\
 			b. action=2 nexthop=<nexthop_ifnum>\n\
@@ -41,6 +41,36 @@ static struct nss_match_instance *nss_match_db_get_instance_by_table_id(uint32_t
 	return match_db.instance[table_id];
 }
 
+/*
+ * nss_match_db_get_instance_by_ifnum()
+ *	Get match instance and its table ID by interface number.
+ */
+static struct nss_match_instance *nss_match_db_get_instance_by_ifnum(int if_num, int *table_id)
+{
+	int id;
+
+	assert_spin_locked(&match_db.db_lock);
+
+	id = nss_match_ifnum_index_find(&match_db.ifnum_index, if_num);
+	if (id < 0) {
+		return NULL;
+	}
+
+	*table_id = id;
+	return match_db.instance[id - 1];
+}
+
+/*
+ * nss_match_db_rule_index()
+ *	Index a rule being stored by the profile under rule_id.
+ */
+void nss_match_db_rule_index(struct nss_match_instance *db_instance, struct nss_match_rule_info *rule, uint16_t rule_id)
+{
+	assert_spin_locked(&match_db.db_lock);
+
+	nss_match_rule_index_add(&db_instance->rule_index, rule_id, db_instance->ops->nss_match_rule_hash(rule));
+}
+
 int nss_match_table_count_get(void)
 {
 	int index, count = 0;
@@ -121,20 +151,16 @@ int nss_match_db_generate_rule_id(uint32_t table_id)
 	/*
 	 * Find an unused slot in the rule table.
 	 */
-	for (rule_id = 0; rule_id < NSS_MATCH_INSTANCE_RULE_MAX; rule_id++) {
-		if (db_instance->rules[rule_id].valid_rule) {
-			continue;
-		}
-
+	rule_id = nss_match_rule_index_alloc(&db_instance->rule_index);
+	if (rule_id < 0) {
+		nss_match_warn("Rule table full with NSS_MATCH_INSTANCE_RULE_MAX:%d entries.\n",
+				NSS_MATCH_INSTANCE_RULE_MAX);
 		spin_unlock_bh(&match_db.db_lock);
-		return (rule_id + 1);
+		return -1;
 	}
 
-	nss_match_warn("Rule table full with NSS_MATCH_INSTANCE_RULE_MAX:%d entries.\n",
-			NSS_MATCH_INSTANCE_RULE_MAX);
-
 	spin_unlock_bh(&match_db.db_lock);
-	return -1;
+	return rule_id;
 }
 
 /*
@@ -217,6 +243,7 @@ bool nss_match_db_rule_delete(uint32_t table_id, uint32_t rule_id)
 
 	db_instance->rule_count--;
 	db_instance->stats.hit_count[rule_id - 1] = 0;
+	nss_match_rule_index_del(&db_instance->rule_index, rule_id);
 
 	for (index = 0; index < NSS_MATCH_MASK_MAX; index++) {
 		db_instance->valid_rule_mask[index][rule_id - 1] = false;
@@ -354,21 +381,12 @@ int nss_match_db_get_ifnum_by_table_id(uint32_t table_id)
  */
 int nss_match_get_table_id_by_ifnum(int if_num)
 {
-	int index;
+	int table_id = -1;
 
 	spin_lock_bh(&match_db.db_lock);
-
-	for (index = 0; index < NSS_MATCH_INSTANCE_MAX; index++) {
-		if (!match_db.instance[index] || match_db.instance[index]->if_num != if_num) {
-			continue;
-		}
-
-		spin_unlock_bh(&match_db.db_lock);
-		return index + 1;
-	}
-
+	nss_match_db_get_instance_by_ifnum(if_num, &table_id);
 	spin_unlock_bh(&match_db.db_lock);
-	return -1;
+	return table_id;
 }
 
 /*
@@ -398,6 +416,7 @@ bool nss_match_db_table_destroy(int table_id)
 
 	match_db.instance_count--;
 	match_db.instance[table_id - 1] = NULL;
+	nss_match_ifnum_index_clear(&match_db.ifnum_index, table_id);
 
 	spin_unlock_bh(&match_db.db_lock);
 	kfree(table_info);
@@ -434,6 +453,7 @@ int nss_match_db_table_create(int if_num)
 		match_db.instance[index]->is_configured = false;
 		match_db.instance[index]->valid_mask_flag = 0;
 		table_id = index + 1;
+		nss_match_ifnum_index_set(&match_db.ifnum_index, table_id, if_num);
 		break;
 	}
 
@@ -580,20 +600,15 @@ int nss_match_db_rule_count_get(uint32_t table_id)
  */
 void nss_match_stats_table_sync(struct nss_ctx_instance *nss_ctx, struct nss_match_stats_sync *stats_msg, uint16_t if_num)
 {
-	int index, table_id;
+	int index, table_id = -1;
+	uint16_t rule_id;
 	struct nss_match_instance *db_instance;
 
-	table_id = nss_match_get_table_id_by_ifnum(if_num);
-	if (table_id <= 0 || table_id > NSS_MATCH_INSTANCE_MAX) {
-		nss_match_warn("Invalid table id: %d\n", table_id);
-		return;
-	}
-
 	spin_lock_bh(&match_db.db_lock);
 
-	db_instance = nss_match_db_get_instance_by_table_id(table_id - 1);
+	db_instance = nss_match_db_get_instance_by_ifnum(if_num, &table_id);
 	if (!db_instance) {
-		nss_match_warn("Invalid if_num: %d, table index: %d, failed to get DB instance. \n", if_num, table_id);
+		nss_match_warn("Invalid if_num: %d, failed to get DB instance. \n", if_num);
 		spin_unlock_bh(&match_db.db_lock);
 		return;
 	}
@@ -607,14 +622,11 @@ void nss_match_stats_table_sync(struct nss_ctx_instance *nss_ctx, struct nss_mat
 		db_instance->stats.pstats.rx_dropped[index] += stats_msg->p_stats.rx_dropped[index];
 	}
 
-	for (index = 0; index < NSS_MATCH_INSTANCE_RULE_MAX; index++) {
-		/*
-		 * Avoid sync for invalid rules.
-		 */
-		if (!db_instance->rules[index].valid_rule) {
-			continue;
-		}
-		db_instance->stats.hit_count[index] += stats_msg->hit_count[index];
+	/*
+	 * Avoid sync for invalid rules.
+	 */
+	nss_match_rule_index_for_each_used(&db_instance->rule_index, rule_id) {
+		db_instance->stats.hit_count[rule_id - 1] += stats_msg->hit_count[rule_id - 1];
 	}
 
 	spin_unlock_bh(&match_db.db_lock);
@@ -690,6 +702,7 @@ bool nss_match_profile_ops_register(uint32_t type, struct match_profile_ops *mop
 void nss_match_db_init(void)
 {
 	match_db.instance_count = 0;
+	nss_match_ifnum_index_init(&match_db.ifnum_index);
 	spin_lock_init(&match_db.db_lock);
 	nss_match_info("db init successful.\n");
 }
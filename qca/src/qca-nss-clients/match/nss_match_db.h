@@ -21,6 +21,7 @@
 
 #include "nss_match_stats.h"
 #include "nss_match_cmd.h"
+#include "nss_match_index.h"
 
 /*
  * nss_match_rule_info
@@ -45,6 +46,7 @@ struct nss_match_instance {
 	uint32_t valid_mask_flag;
 	uint32_t maskset[NSS_MATCH_MASK_MAX][NSS_MATCH_MASK_WORDS_MAX];	/* Maskset. */
 	bool valid_rule_mask[NSS_MATCH_MASK_MAX][NSS_MATCH_INSTANCE_RULE_MAX];
+	struct nss_match_rule_index rule_index;	/* Rule IDs in use, valid rules hashed by content. */
 	uint32_t profile_type;
 	uint32_t if_num;
 	uint16_t rule_count;
@@ -57,6 +59,7 @@ struct nss_match_instance {
  */
 struct nss_match_db {
 	struct nss_match_instance *instance[NSS_MATCH_INSTANCE_MAX];		/* Pointer to each match instance database. */
+	struct nss_match_ifnum_index ifnum_index;	/* Table ID of each interface. */
 	spinlock_t db_lock;		/* Spin lock to protect database. */
 	int8_t instance_count;		/* Match instance count. */
 };
@@ -67,6 +70,9 @@ struct nss_match_db {
  */
 struct match_profile_ops {
 
+	/* Hash the rule content, rule in message format. */
+	uint32_t (*nss_match_rule_hash)(struct nss_match_rule_info *rule);
+
 	/* Check if rule exists already in database. */
 	bool (*nss_match_rule_find)(struct nss_match_instance *db_instance, struct nss_match_rule_info *rule);
 
@@ -108,5 +114,6 @@ bool nss_match_db_stats_get(uint32_t table_id, struct nss_match_stats *match_sta
 void nss_match_db_init(void);
 bool nss_match_profile_ops_register(uint32_t type, struct match_profile_ops *mops);
 int nss_match_db_get_ifnum_by_table_id(uint32_t table_id);
+void nss_match_db_rule_index(struct nss_match_instance *db_instance, struct nss_match_rule_info *rule, uint16_t rule_id);
 
 #endif /* __NSS_MATCH_DB_H */
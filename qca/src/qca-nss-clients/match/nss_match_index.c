@@ -0,0 +1,218 @@
+/* SPDX-License-Identifier: ISC */
+
+#ifdef __KERNEL__
+#include <linux/string.h>
+#else
+#include <string.h>
+#endif
+#include "nss_match_index.h"
+
+/*
+ * nss_match_rule_index_bucket()
+ *	Bucket of a content hash, the multiplicative hash_32() of the kernel.
+ */
+static inline uint32_t nss_match_rule_index_bucket(uint32_t hash)
+{
+	return (hash * 0x61C88647u) >> (32 - NSS_MATCH_INDEX_HASH_BITS);
+}
+
+/*
+ * nss_match_rule_index_init()
+ *	Empty the index.
+ */
+void nss_match_rule_index_init(struct nss_match_rule_index *idx)
+{
+	memset(idx, 0, sizeof(*idx));
+}
+
+/*
+ * nss_match_rule_index_used()
+ *	Check if rule_id is in use.
+ */
+bool nss_match_rule_index_used(const struct nss_match_rule_index *idx, uint16_t rule_id)
+{
+	uint16_t bit = rule_id - 1;
+
+	if (rule_id == 0 || rule_id > NSS_MATCH_INSTANCE_RULE_MAX) {
+		return false;
+	}
+
+	return !!(idx->id_map[bit / 32] & (1u << (bit % 32)));
+}
+
+/*
+ * nss_match_rule_index_alloc()
+ *	Returns the lowest free rule ID, -1 if all are in use.
+ */
+int nss_match_rule_index_alloc(const struct nss_match_rule_index *idx)
+{
+	uint32_t word, bit;
+
+	for (word = 0; word < NSS_MATCH_INDEX_ID_WORDS; word++) {
+		if (idx->id_map[word] == 0xffffffffu) {
+			continue;
+		}
+
+		bit = word * 32 + __builtin_ctz(~idx->id_map[word]);
+		if (bit >= NSS_MATCH_INSTANCE_RULE_MAX) {
+			break;
+		}
+
+		return bit + 1;
+	}
+
+	return -1;
+}
+
+/*
+ * nss_match_rule_index_add()
+ *	Mark rule_id in use and index it under the content hash.
+ */
+bool nss_match_rule_index_add(struct nss_match_rule_index *idx, uint16_t rule_id, uint32_t hash)
+{
+	uint16_t bit = rule_id - 1;
+	uint32_t b;
+
+	if (rule_id == 0 || rule_id > NSS_MATCH_INSTANCE_RULE_MAX || nss_match_rule_index_used(idx, rule_id)) {
+		return false;
+	}
+
+	b = nss_match_rule_index_bucket(hash);
+	idx->hash[bit] = hash;
+	idx->next[bit] = idx->bucket[b];
+	idx->bucket[b] = rule_id;
+	idx->id_map[bit / 32] |= 1u << (bit % 32);
+	return true;
+}
+
+/*
+ * nss_match_rule_index_del()
+ *	Unlink rule_id from its bucket and free it.
+ */
+bool nss_match_rule_index_del(struct nss_match_rule_index *idx, uint16_t rule_id)
+{
+	uint16_t bit = rule_id - 1;
+	uint8_t *link;
+
+	if (!nss_match_rule_index_used(idx, rule_id)) {
+		return false;
+	}
+
+	link = &idx->bucket[nss_match_rule_index_bucket(idx->hash[bit])];
+	while (*link != rule_id) {
+		link = &idx->next[*link - 1];
+	}
+
+	*link = idx->next[bit];
+	idx->next[bit] = 0;
+	idx->hash[bit] = 0;
+	idx->id_map[bit / 32] &= ~(1u << (bit % 32));
+	return true;
+}
+
+/*
+ * nss_match_rule_index_next_used()
+ *	Returns the lowest rule ID in use above rule_id, 0 if there is none.
+ */
+uint16_t nss_match_rule_index_next_used(const struct nss_match_rule_index *idx, uint16_t rule_id)
+{
+	uint32_t bit = rule_id, word, bits;
+
+	while (bit < NSS_MATCH_INSTANCE_RULE_MAX) {
+		word = bit / 32;
+		bits = idx->id_map[word] & (0xffffffffu << (bit % 32));
+		if (bits) {
+			bit = word * 32 + __builtin_ctz(bits);
+			return (bit < NSS_MATCH_INSTANCE_RULE_MAX) ? bit + 1 : 0;
+		}
+
+		bit = (word + 1) * 32;
+	}
+
+	return 0;
+}
+
+/*
+ * nss_match_rule_index_match()
+ *	First rule ID from rule_id on in a bucket chain with the given hash.
+ */
+static uint16_t nss_match_rule_index_match(const struct nss_match_rule_index *idx, uint16_t rule_id, uint32_t hash)
+{
+	while (rule_id && idx->hash[rule_id - 1] != hash) {
+		rule_id = idx->next[rule_id - 1];
+	}
+
+	return rule_id;
+}
+
+/*
+ * nss_match_rule_index_first()
+ *	Returns the first rule ID stored with the hash, 0 if there is none.
+ */
+uint16_t nss_match_rule_index_first(const struct nss_match_rule_index *idx, uint32_t hash)
+{
+	return nss_match_rule_index_match(idx, idx->bucket[nss_match_rule_index_bucket(hash)], hash);
+}
+
+/*
+ * nss_match_rule_index_next()
+ *	Returns the next rule ID stored with the same hash as rule_id, 0 if there is none.
+ */
+uint16_t nss_match_rule_index_next(const struct nss_match_rule_index *idx, uint16_t rule_id)
+{
+	return nss_match_rule_index_match(idx, idx->next[rule_id - 1], idx->hash[rule_id - 1]);
+}
+
+/*
+ * nss_match_ifnum_index_init()
+ *	Mark every table ID free.
+ */
+void nss_match_ifnum_index_init(struct nss_match_ifnum_index *ix)
+{
+	int index;
+
+	for (index = 0; index < NSS_MATCH_INSTANCE_MAX; index++) {
+		ix->if_num[index] = -1;
+	}
+}
+
+/*
+ * nss_match_ifnum_index_set()
+ *	Record the interface of table_id.
+ */
+void nss_match_ifnum_index_set(struct nss_match_ifnum_index *ix, int table_id, int32_t if_num)
+{
+	if (table_id > 0 && table_id <= NSS_MATCH_INSTANCE_MAX) {
+		ix->if_num[table_id - 1] = if_num;
+	}
+}
+
+/*
+ * nss_match_ifnum_index_clear()
+ *	Forget the interface of table_id.
+ */
+void nss_match_ifnum_index_clear(struct nss_match_ifnum_index *ix, int table_id)
+{
+	nss_match_ifnum_index_set(ix, table_id, -1);
+}
+
+/*
+ * nss_match_ifnum_index_find()
+ *	Returns the table ID for if_num, -1 if no table uses it.
+ */
+int nss_match_ifnum_index_find(const struct nss_match_ifnum_index *ix, int32_t if_num)
+{
+	int index;
+
+	if (if_num < 0) {
+		return -1;
+	}
+
+	for (index = 0; index < NSS_MATCH_INSTANCE_MAX; index++) {
+		if (ix->if_num[index] == if_num) {
+			return index + 1;
+		}
+	}
+
+	return -1;
+}
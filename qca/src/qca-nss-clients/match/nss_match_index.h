@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * Rule ID allocation and lookup indexes of a match instance.
+ *
+ * Nothing here depends on the kernel, so the same code builds in the
+ * host test under test/. NSS_MATCH_INSTANCE_MAX and
+ * NSS_MATCH_INSTANCE_RULE_MAX come from the NSS driver's nss_match.h.
+ */
+
+#ifndef __NSS_MATCH_INDEX_H
+#define __NSS_MATCH_INDEX_H
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <nss_api_if.h>
+#else
+#include <stdbool.h>
+#include <stdint.h>
+#endif
+
+#define NSS_MATCH_INDEX_HASH_BITS 4
+#define NSS_MATCH_INDEX_HASH_SIZE (1 << NSS_MATCH_INDEX_HASH_BITS)
+#define NSS_MATCH_INDEX_ID_WORDS ((NSS_MATCH_INSTANCE_RULE_MAX + 31) / 32)
+
+/*
+ * nss_match_rule_index
+ *	Rule IDs in use and valid rules hashed by content.
+ *
+ * Rule IDs are 1 based, bit n of id_map and entry n of hash and next
+ * belong to rule ID n + 1. A bucket is a chain of rule IDs linked
+ * through next, 0 ends it.
+ */
+struct nss_match_rule_index {
+	uint32_t id_map[NSS_MATCH_INDEX_ID_WORDS];	/* Rule IDs in use. */
+	uint32_t hash[NSS_MATCH_INSTANCE_RULE_MAX];	/* Content hash of each rule. */
+	uint8_t next[NSS_MATCH_INSTANCE_RULE_MAX];	/* Next rule ID in the bucket. */
+	uint8_t bucket[NSS_MATCH_INDEX_HASH_SIZE];	/* First rule ID of each bucket. */
+};
+
+/*
+ * nss_match_ifnum_index
+ *	Interface number of each table.
+ *
+ * With NSS_MATCH_INSTANCE_MAX tables a scan beats any hash, the index only
+ * keeps the interface numbers together instead of in each instance.
+ */
+struct nss_match_ifnum_index {
+	int32_t if_num[NSS_MATCH_INSTANCE_MAX];		/* -1 for a free table ID. */
+};
+
+void nss_match_rule_index_init(struct nss_match_rule_index *idx);
+int nss_match_rule_index_alloc(const struct nss_match_rule_index *idx);
+bool nss_match_rule_index_add(struct nss_match_rule_index *idx, uint16_t rule_id, uint32_t hash);
+bool nss_match_rule_index_del(struct nss_match_rule_index *idx, uint16_t rule_id);
+bool nss_match_rule_index_used(const struct nss_match_rule_index *idx, uint16_t rule_id);
+uint16_t nss_match_rule_index_next_used(const struct nss_match_rule_index *idx, uint16_t rule_id);
+uint16_t nss_match_rule_index_first(const struct nss_match_rule_index *idx, uint32_t hash);
+uint16_t nss_match_rule_index_next(const struct nss_match_rule_index *idx, uint16_t rule_id);
+
+/*
+ * Walk the rule IDs in use in ascending order.
+ */
+#define nss_match_rule_index_for_each_used(idx, rule_id) \
+	for ((rule_id) = nss_match_rule_index_next_used(idx, 0); (rule_id); \
+		(rule_id) = nss_match_rule_index_next_used(idx, rule_id))
+
+/*
+ * Walk the rule IDs stored with the given content hash.
+ */
+#define nss_match_rule_index_for_each_hash(idx, hash, rule_id) \
+	for ((rule_id) = nss_match_rule_index_first(idx, hash); (rule_id); \
+		(rule_id) = nss_match_rule_index_next(idx, rule_id))
+
+void nss_match_ifnum_index_init(struct nss_match_ifnum_index *ix);
+void nss_match_ifnum_index_set(struct nss_match_ifnum_index *ix, int table_id, int32_t if_num);
+void nss_match_ifnum_index_clear(struct nss_match_ifnum_index *ix, int table_id);
+int nss_match_ifnum_index_find(const struct nss_match_ifnum_index *ix, int32_t if_num);
+
+#endif /* __NSS_MATCH_INDEX_H */
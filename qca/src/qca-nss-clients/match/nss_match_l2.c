@@ -15,6 +15,7 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ********************************************************************************
  **/
+#include <linux/jhash.h>
 #include "nss_match_db.h"
 #include "nss_match_priv.h"
 
@@ -27,30 +28,48 @@
 #define MATCH_L2_KEY3_SMAC_HW2_SHIFT 0
 #define MATCH_L2_KEY3_ETHERTYPE_SHIFT 16
 
+/*
+ * nss_match_l2_rule_hash()
+ *	Hash the fields an L2 rule is matched on.
+ */
+static uint32_t nss_match_l2_rule_hash(struct nss_match_rule_info *rule)
+{
+	struct nss_match_rule_l2_msg *l2 = &rule->profile.l2;
+	uint32_t key[5];
+
+	key[0] = l2->if_num;
+	key[1] = (l2->dmac[0] << 16) | l2->dmac[1];
+	key[2] = (l2->dmac[2] << 16) | l2->smac[0];
+	key[3] = (l2->smac[1] << 16) | l2->smac[2];
+	key[4] = (l2->ethertype << 16) | l2->mask_id;
+
+	return jhash2(key, ARRAY_SIZE(key), 0);
+}
+
 /*
  * nss_match_l2_rule_find()
  *	Check if any slot is available for new entry.
  */
 static bool nss_match_l2_rule_find(struct nss_match_instance *db_instance, struct nss_match_rule_info *rule)
 {
-	uint16_t index;
+	struct nss_match_rule_info *rule_info;
+	uint32_t hash = nss_match_l2_rule_hash(rule);
+	uint16_t rule_id;
 
 	/*
 	 * Check if entry is duplicate.
 	 */
-	for (index = 0; index < NSS_MATCH_INSTANCE_RULE_MAX; index++) {
-		struct nss_match_rule_info rule_info = db_instance->rules[index];
-
-		if (rule_info.valid_rule &&
-			rule_info.profile.l2.if_num == rule->profile.l2.if_num &&
-			rule_info.profile.l2.ethertype == rule->profile.l2.ethertype &&
-			rule_info.profile.l2.smac[0] == htons(rule->profile.l2.smac[0]) &&
-			rule_info.profile.l2.smac[1] == htons(rule->profile.l2.smac[1]) &&
-			rule_info.profile.l2.smac[2] == htons(rule->profile.l2.smac[2]) &&
-			rule_info.profile.l2.dmac[0] == htons(rule->profile.l2.dmac[0]) &&
-			rule_info.profile.l2.dmac[1] == htons(rule->profile.l2.dmac[1]) &&
-			rule_info.profile.l2.dmac[2] == htons(rule->profile.l2.dmac[2]) &&
-			rule_info.profile.l2.mask_id == rule->profile.l2.mask_id) {
+	nss_match_rule_index_for_each_hash(&db_instance->rule_index, hash, rule_id) {
+		rule_info = &db_instance->rules[rule_id - 1];
+		if (rule_info->profile.l2.if_num == rule->profile.l2.if_num &&
+			rule_info->profile.l2.ethertype == rule->profile.l2.ethertype &&
+			rule_info->profile.l2.smac[0] == htons(rule->profile.l2.smac[0]) &&
+			rule_info->profile.l2.smac[1] == htons(rule->profile.l2.smac[1]) &&
+			rule_info->profile.l2.smac[2] == htons(rule->profile.l2.smac[2]) &&
+			rule_info->profile.l2.dmac[0] == htons(rule->profile.l2.dmac[0]) &&
+			rule_info->profile.l2.dmac[1] == htons(rule->profile.l2.dmac[1]) &&
+			rule_info->profile.l2.dmac[2] == htons(rule->profile.l2.dmac[2]) &&
+			rule_info->profile.l2.mask_id == rule->profile.l2.mask_id) {
 			nss_match_info("Rule matched\n");
 			return true;
 		}
@@ -93,6 +112,7 @@ static bool nss_match_l2_db_rule_add(struct nss_match_instance *db_instance, str
 	db_instance->rules[rule_id - 1].valid_rule = true;
 	db_instance->rules[rule_id - 1].profile.l2.rule_id = rule_id;
 	db_instance->valid_rule_mask[mask_id - 1][rule_id - 1] = true;
+	nss_match_db_rule_index(db_instance, rule, rule_id);
 	db_instance->rule_count++;
 
 	return true;
@@ -479,6 +499,7 @@ static size_t nss_match_l2_table_read(struct nss_match_instance *db_instance, si
  * Match ops for L2 profile.
  */
 static struct match_profile_ops match_profile_ops_l2 = {
+	nss_match_l2_rule_hash,
 	nss_match_l2_rule_find,
 	nss_match_l2_db_rule_add,
 	nss_match_l2_rule_read,
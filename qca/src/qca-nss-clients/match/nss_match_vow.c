@@ -15,6 +15,7 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ********************************************************************************
  **/
+#include <linux/jhash.h>
 #include "nss_match_db.h"
 #include "nss_match_priv.h"
 
@@ -25,26 +26,39 @@
 #define NSS_MATCH_VOW_KEY_INNER_8021P_SHIFT 22
 #define NSS_MATCH_VOW_KEY_OUTER_8021P_SHIFT 25
 
+/*
+ * nss_match_vow_rule_hash()
+ * 	Hash the fields a VoW rule is matched on.
+ */
+static uint32_t nss_match_vow_rule_hash(struct nss_match_rule_info *rule)
+{
+	struct nss_match_rule_vow_msg *vow = &rule->profile.vow;
+
+	return jhash_3words(vow->if_num,
+			vow->dscp | (vow->inner_8021p << 8) | (vow->outer_8021p << 16),
+			vow->mask_id, 0);
+}
+
 /*
  * nss_match_vow_rule_find()
  * 	Check if rule exists already.
  */
 static bool nss_match_vow_rule_find(struct nss_match_instance *db_instance, struct nss_match_rule_info *rule)
 {
-	uint16_t index;
+	struct nss_match_rule_info *rule_info;
+	uint32_t hash = nss_match_vow_rule_hash(rule);
+	uint16_t rule_id;
 
 	/*
 	 * Check if entry is present already.
 	 */
-	for (index = 0; index < NSS_MATCH_INSTANCE_RULE_MAX; index++) {
-		struct nss_match_rule_info rule_info = db_instance->rules[index];
-
-		if (rule->valid_rule &&
-				rule_info.profile.vow.if_num == rule->profile.vow.if_num &&
-				rule_info.profile.vow.dscp == rule->profile.vow.dscp &&
-				rule_info.profile.vow.inner_8021p == rule->profile.vow.inner_8021p &&
-				rule_info.profile.vow.outer_8021p == rule->profile.vow.outer_8021p &&
-				rule_info.profile.vow.mask_id == rule->profile.vow.mask_id) {
+	nss_match_rule_index_for_each_hash(&db_instance->rule_index, hash, rule_id) {
+		rule_info = &db_instance->rules[rule_id - 1];
+		if (rule_info->profile.vow.if_num == rule->profile.vow.if_num &&
+				rule_info->profile.vow.dscp == rule->profile.vow.dscp &&
+				rule_info->profile.vow.inner_8021p == rule->profile.vow.inner_8021p &&
+				rule_info->profile.vow.outer_8021p == rule->profile.vow.outer_8021p &&
+				rule_info->profile.vow.mask_id == rule->profile.vow.mask_id) {
 			nss_match_info("Rule matched.\n");
 			return true;
 		}
@@ -83,6 +97,7 @@ static bool nss_match_vow_db_rule_add(struct nss_match_instance *db_instance, st
 	db_instance->rules[rule_id - 1].valid_rule = true;
 	db_instance->rules[rule_id - 1].profile.vow.rule_id = rule_id;
 	db_instance->valid_rule_mask[mask_id - 1][rule_id - 1] = true;
+	nss_match_db_rule_index(db_instance, rule, rule_id);
 	db_instance->rule_count++;
 
 	return true;
@@ -433,6 +448,7 @@ static size_t nss_match_vow_table_read(struct nss_match_instance *db_instance, s
  * Match ops for VoW profile.
  */
 static struct match_profile_ops match_profile_vow_ops = {
+	nss_match_vow_rule_hash,
 	nss_match_vow_rule_find,
 	nss_match_vow_db_rule_add,
 	nss_match_vow_rule_read,
@@ -0,0 +1,243 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * Userspace unit test of the rule ID and interface indexes of
+ * nss_match_index.c: allocation, reuse after delete, lookup by content
+ * hash, and bulk add/delete against a reference array.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nss_match_index.h"
+
+#define TEST_OPS 200000
+
+/*
+ * Few distinct hashes, so equal hashes and shared buckets are common.
+ */
+#define TEST_HASHES 24
+
+#define TEST_ASSERT(cond) \
+	do { \
+		if (!(cond)) { \
+			fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+			exit(1); \
+		} \
+	} while (0)
+
+struct test_ref {
+	bool used[NSS_MATCH_INSTANCE_RULE_MAX + 1];
+	uint32_t hash[NSS_MATCH_INSTANCE_RULE_MAX + 1];
+};
+
+static uint32_t test_hash_value(uint32_t n)
+{
+	return n * 0x9e3779b9u + 7;
+}
+
+/*
+ * test_check()
+ *	Compare every lookup of the index with the reference.
+ */
+static void test_check(const struct nss_match_rule_index *idx, const struct test_ref *ref)
+{
+	bool seen[NSS_MATCH_INSTANCE_RULE_MAX + 1];
+	int free_id = -1, rule_id, prev = 0, n;
+	uint16_t id;
+	uint32_t h;
+
+	for (rule_id = 1; rule_id <= NSS_MATCH_INSTANCE_RULE_MAX; rule_id++) {
+		TEST_ASSERT(nss_match_rule_index_used(idx, rule_id) == ref->used[rule_id]);
+		if (!ref->used[rule_id] && free_id < 0) {
+			free_id = rule_id;
+		}
+	}
+	TEST_ASSERT(nss_match_rule_index_alloc(idx) == free_id);
+
+	/*
+	 * IDs in use, ascending and complete.
+	 */
+	n = 0;
+	nss_match_rule_index_for_each_used(idx, id) {
+		TEST_ASSERT(id > prev && ref->used[id]);
+		prev = id;
+		n++;
+	}
+	for (rule_id = 1; rule_id <= NSS_MATCH_INSTANCE_RULE_MAX; rule_id++) {
+		n -= ref->used[rule_id];
+	}
+	TEST_ASSERT(n == 0);
+
+	/*
+	 * Each hash finds exactly the IDs stored with it.
+	 */
+	for (h = 0; h < TEST_HASHES; h++) {
+		for (rule_id = 0; rule_id <= NSS_MATCH_INSTANCE_RULE_MAX; rule_id++) {
+			seen[rule_id] = false;
+		}
+
+		nss_match_rule_index_for_each_hash(idx, test_hash_value(h), id) {
+			TEST_ASSERT(ref->used[id] && ref->hash[id] == test_hash_value(h));
+			TEST_ASSERT(!seen[id]);
+			seen[id] = true;
+		}
+
+		for (rule_id = 1; rule_id <= NSS_MATCH_INSTANCE_RULE_MAX; rule_id++) {
+			TEST_ASSERT(seen[rule_id] == (ref->used[rule_id] && ref->hash[rule_id] == test_hash_value(h)));
+		}
+	}
+}
+
+/*
+ * test_alloc()
+ *	Sequential allocation until full, then reuse of deleted IDs.
+ */
+static void test_alloc(void)
+{
+	struct nss_match_rule_index idx;
+	int rule_id;
+
+	nss_match_rule_index_init(&idx);
+	for (rule_id = 1; rule_id <= NSS_MATCH_INSTANCE_RULE_MAX; rule_id++) {
+		TEST_ASSERT(nss_match_rule_index_alloc(&idx) == rule_id);
+		TEST_ASSERT(nss_match_rule_index_add(&idx, rule_id, test_hash_value(0)));
+	}
+	TEST_ASSERT(nss_match_rule_index_alloc(&idx) == -1);
+
+	TEST_ASSERT(nss_match_rule_index_del(&idx, 17));
+	TEST_ASSERT(nss_match_rule_index_del(&idx, 5));
+	TEST_ASSERT(nss_match_rule_index_alloc(&idx) == 5);
+	TEST_ASSERT(nss_match_rule_index_add(&idx, 5, test_hash_value(1)));
+	TEST_ASSERT(nss_match_rule_index_alloc(&idx) == 17);
+
+	/*
+	 * Out of range, duplicate and unused IDs are refused.
+	 */
+	TEST_ASSERT(!nss_match_rule_index_add(&idx, 0, 0));
+	TEST_ASSERT(!nss_match_rule_index_add(&idx, NSS_MATCH_INSTANCE_RULE_MAX + 1, 0));
+	TEST_ASSERT(!nss_match_rule_index_add(&idx, 5, 0));
+	TEST_ASSERT(!nss_match_rule_index_del(&idx, 17));
+	TEST_ASSERT(!nss_match_rule_index_del(&idx, 0));
+	TEST_ASSERT(!nss_match_rule_index_used(&idx, NSS_MATCH_INSTANCE_RULE_MAX + 1));
+}
+
+/*
+ * test_bulk()
+ *	Fill the table in a random order, then empty it in another one.
+ */
+static void test_bulk(void)
+{
+	struct nss_match_rule_index idx;
+	struct test_ref ref;
+	uint16_t order[NSS_MATCH_INSTANCE_RULE_MAX];
+	int i, j, round;
+	uint16_t t;
+
+	memset(&ref, 0, sizeof(ref));
+	nss_match_rule_index_init(&idx);
+	for (round = 0; round < 100; round++) {
+		for (i = 0; i < NSS_MATCH_INSTANCE_RULE_MAX; i++) {
+			order[i] = i + 1;
+		}
+		for (i = NSS_MATCH_INSTANCE_RULE_MAX - 1; i > 0; i--) {
+			j = rand() % (i + 1);
+			t = order[i];
+			order[i] = order[j];
+			order[j] = t;
+		}
+
+		for (i = 0; i < NSS_MATCH_INSTANCE_RULE_MAX; i++) {
+			ref.used[order[i]] = true;
+			ref.hash[order[i]] = test_hash_value(rand() % TEST_HASHES);
+			TEST_ASSERT(nss_match_rule_index_add(&idx, order[i], ref.hash[order[i]]));
+		}
+		test_check(&idx, &ref);
+
+		for (i = NSS_MATCH_INSTANCE_RULE_MAX - 1; i > 0; i--) {
+			j = rand() % (i + 1);
+			t = order[i];
+			order[i] = order[j];
+			order[j] = t;
+		}
+
+		for (i = 0; i < NSS_MATCH_INSTANCE_RULE_MAX; i++) {
+			ref.used[order[i]] = false;
+			TEST_ASSERT(nss_match_rule_index_del(&idx, order[i]));
+			if (i % 8 == 0) {
+				test_check(&idx, &ref);
+			}
+		}
+		test_check(&idx, &ref);
+	}
+}
+
+/*
+ * test_random()
+ *	Random adds and deletes, checked after each one.
+ */
+static void test_random(void)
+{
+	struct nss_match_rule_index idx;
+	struct test_ref ref;
+	uint32_t hash;
+	int op, rule_id;
+
+	memset(&ref, 0, sizeof(ref));
+	nss_match_rule_index_init(&idx);
+	for (op = 0; op < TEST_OPS; op++) {
+		rule_id = rand() % (NSS_MATCH_INSTANCE_RULE_MAX + 2);
+		if (rand() % 2) {
+			hash = test_hash_value(rand() % TEST_HASHES);
+			TEST_ASSERT(nss_match_rule_index_add(&idx, rule_id, hash) ==
+				(rule_id > 0 && rule_id <= NSS_MATCH_INSTANCE_RULE_MAX && !ref.used[rule_id]));
+			if (rule_id > 0 && rule_id <= NSS_MATCH_INSTANCE_RULE_MAX && !ref.used[rule_id]) {
+				ref.used[rule_id] = true;
+				ref.hash[rule_id] = hash;
+			}
+		} else {
+			TEST_ASSERT(nss_match_rule_index_del(&idx, rule_id) ==
+				(rule_id > 0 && rule_id <= NSS_MATCH_INSTANCE_RULE_MAX && ref.used[rule_id]));
+			if (rule_id > 0 && rule_id <= NSS_MATCH_INSTANCE_RULE_MAX) {
+				ref.used[rule_id] = false;
+			}
+		}
+		test_check(&idx, &ref);
+	}
+}
+
+/*
+ * test_ifnum()
+ *	Table ID lookup by interface number.
+ */
+static void test_ifnum(void)
+{
+	struct nss_match_ifnum_index ix;
+
+	nss_match_ifnum_index_init(&ix);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, 0) == -1);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, -1) == -1);
+
+	nss_match_ifnum_index_set(&ix, 1, 0);
+	nss_match_ifnum_index_set(&ix, NSS_MATCH_INSTANCE_MAX, 200);
+	nss_match_ifnum_index_set(&ix, NSS_MATCH_INSTANCE_MAX + 1, 300);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, 0) == 1);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, 200) == NSS_MATCH_INSTANCE_MAX);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, 300) == -1);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, -1) == -1);
+
+	nss_match_ifnum_index_clear(&ix, 1);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, 0) == -1);
+	TEST_ASSERT(nss_match_ifnum_index_find(&ix, 200) == NSS_MATCH_INSTANCE_MAX);
+}
+
+int main(void)
+{
+	srand(1);
+	test_alloc();
+	test_bulk();
+	test_random();
+	test_ifnum();
+	printf("nss_match_index: ok\n");
+	return 0;
+}
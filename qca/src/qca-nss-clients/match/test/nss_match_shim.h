@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * Host build of nss_match_index.c, the limits of qca-nss-drv
+ * exports/nss_match.h.
+ */
+
+#define NSS_MATCH_INSTANCE_MAX 4
+#define NSS_MATCH_INSTANCE_RULE_MAX 32
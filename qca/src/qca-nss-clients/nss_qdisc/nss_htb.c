@@ -292,10 +292,14 @@ static int nss_htb_change_class(struct Qdisc *sch, u32 classid, u32 parentid,
 	struct nss_qdisc *nq_parent;
 	struct nss_htb_param param;
 	struct nss_if_msg nim_config;
+	struct nss_if_msg nim_attach;
+	struct nss_qdisc_batch nqb;
 	struct net_device *dev = qdisc_dev(sch);
 	unsigned int mtu = psched_mtu(dev);
 	unsigned int accel_mode = nss_qdisc_accel_mode_get(&q->nq);
+	ktime_t start = ktime_get();
 	bool new_init = false;
+	int rc = 0;
 
 	nss_qdisc_trace("configuring htb class %x of qdisc %x\n", classid, sch->handle);
 
@@ -334,8 +338,13 @@ static int nss_htb_change_class(struct Qdisc *sch, u32 classid, u32 parentid,
 	/*
 	 * If class with a given classid is not found, we allocate a new one
 	 */
+	/*
+	 * The attach of a new class and its parameters are sent back to back
+	 * and their responses are waited for once.
+	 */
+	nss_qdisc_batch_init(&nqb);
+
 	if (!cl) {
-		struct nss_if_msg nim_attach;
 		cl = nss_htb_class_alloc(sch, parent, classid);
 
 		if (!cl) {
@@ -380,41 +389,12 @@ static int nss_htb_change_class(struct Qdisc *sch, u32 classid, u32 parentid,
 			nim_attach.msg.shaper_configure.config.msg.shaper_node_config.snc.htb_attach.child_qos_tag = cl->nq.qos_tag;
 		}
 
-		if (nss_qdisc_node_attach(nq_parent, &cl->nq, &nim_attach,
-				NSS_SHAPER_CONFIG_TYPE_SHAPER_NODE_ATTACH) < 0) {
+		if (nss_qdisc_node_attach_batch(nq_parent, &cl->nq, &nim_attach,
+				NSS_SHAPER_CONFIG_TYPE_SHAPER_NODE_ATTACH, &nqb) < 0) {
 			nss_qdisc_error("nss_attach for class %x failed\n", classid);
 			nss_qdisc_destroy(&cl->nq);
 			goto failure;
 		}
-
-		/*
-		 * We have successfully attached ourselves in the NSS. We can therefore
-		 * add this class to qdisc hash tree, and increment parent's child count
-		 * (if parent exists)
-		 */
-		sch_tree_lock(sch);
-		qdisc_class_hash_insert(&q->clhash, &cl->sch_common);
-		if (parent) {
-			parent->children++;
-
-			/*
-			 * Parent can no longer be leaf. Set flag to false.
-			 */
-			parent->is_leaf = false;
-		}
-		sch_tree_unlock(sch);
-
-		/*
-		 * Hash grow should not come within the tree lock
-		 */
-		qdisc_class_hash_grow(sch, &q->clhash);
-
-		/*
-		 * Start the stats polling timer
-		 */
-		nss_qdisc_start_basic_stats_polling(&cl->nq);
-
-		nss_qdisc_trace("class %x successfully allocated and initialized\n", classid);
 	}
 
 	/*
@@ -443,20 +423,61 @@ static int nss_htb_change_class(struct Qdisc *sch, u32 classid, u32 parentid,
 		/*
 		 * Send configure command to the NSS
 		 */
-		if (nss_qdisc_configure(&cl->nq, &nim_config,
-				NSS_SHAPER_CONFIG_TYPE_SHAPER_NODE_CHANGE_PARAM) < 0) {
+		if (nss_qdisc_configure_batch(&cl->nq, &nim_config,
+				NSS_SHAPER_CONFIG_TYPE_SHAPER_NODE_CHANGE_PARAM, &nqb) < 0) {
 			nss_qdisc_error("failed to send configure message for htb class %x\n", classid);
+			rc = -1;
+		}
+	}
 
-			if (!new_init) {
-				return -EINVAL;
-			}
+	/*
+	 * Wait for the attach and configure responses. This also has to be
+	 * done when the configure could not be sent, to settle the attach.
+	 */
+	if ((nss_qdisc_batch_wait(&nqb) < 0) || (rc < 0)) {
+		nss_qdisc_error("failed to attach or configure htb class %x\n", classid);
 
-			nss_qdisc_destroy(&cl->nq);
-			goto failure;
+		if (!new_init) {
+			return -EINVAL;
+		}
+
+		nss_qdisc_destroy(&cl->nq);
+		goto failure;
+	}
+
+	if (new_init) {
+		/*
+		 * We have successfully attached ourselves in the NSS. We can therefore
+		 * add this class to qdisc hash tree, and increment parent's child count
+		 * (if parent exists)
+		 */
+		sch_tree_lock(sch);
+		qdisc_class_hash_insert(&q->clhash, &cl->sch_common);
+		if (parent) {
+			parent->children++;
+
+			/*
+			 * Parent can no longer be leaf. Set flag to false.
+			 */
+			parent->is_leaf = false;
 		}
+		sch_tree_unlock(sch);
+
+		/*
+		 * Hash grow should not come within the tree lock
+		 */
+		qdisc_class_hash_grow(sch, &q->clhash);
+
+		/*
+		 * Start the stats polling timer
+		 */
+		nss_qdisc_start_basic_stats_polling(&cl->nq);
+
+		nss_qdisc_trace("class %x successfully allocated and initialized\n", classid);
 	}
 
-	nss_qdisc_info("htb class %x configured successfully\n", classid);
+	nss_qdisc_info("htb class %x configured successfully in %lldus\n", classid,
+			ktime_us_delta(ktime_get(), start));
 	return 0;
 
 failure:
@@ -1598,27 +1598,33 @@ static void nss_qdisc_node_attach_callback(void *app_data,
 }
 
 /*
- * nss_qdisc_node_attach()
- *	Configuration function that helps attach a child shaper node to a parent.
+ * nss_qdisc_batch_init()
+ *	Initializes an empty message batch.
  */
-int nss_qdisc_node_attach(struct nss_qdisc *nq, struct nss_qdisc *nq_child,
-			struct nss_if_msg *nim, int32_t attach_type)
+void nss_qdisc_batch_init(struct nss_qdisc_batch *nqb)
+{
+	memset(nqb, 0, sizeof(*nqb));
+}
+
+/*
+ * nss_qdisc_batch_send()
+ *	Sends a shaper configure message on nq and records it in the batch.
+ *
+ * The node is left IDLE until its callback runs; nss_qdisc_batch_wait()
+ * moves it back to READY.
+ */
+static int nss_qdisc_batch_send(struct nss_qdisc *nq, struct nss_qdisc *nq_child,
+				struct nss_if_msg *nim, int32_t request_type,
+				nss_if_msg_callback_t cb, struct nss_qdisc_batch *nqb)
 {
 	int32_t state, rc;
 	int msg_type;
 
-	nss_qdisc_info("Qdisc %px (type %d) attaching\n",
-			nq->qdisc, nq->type);
-#if defined(NSS_QDISC_PPE_SUPPORT)
-	if (nq->mode == NSS_QDISC_MODE_PPE) {
-		if (nss_ppe_node_attach(nq, nq_child) < 0) {
-			nss_qdisc_warning("attach of new qdisc %px failed\n", nq_child->qdisc);
-			return -EINVAL;
-
-		}
-		nim->msg.shaper_configure.config.msg.shaper_node_config.snc.ppe_sn_attach.child_qos_tag = nq_child->qos_tag;
+	if (nqb->count == NSS_QDISC_BATCH_MAX) {
+		nss_qdisc_warning("Qdisc %px (type %d): batch full\n",
+				nq->qdisc, nq->type);
+		return -1;
 	}
-#endif
 
 	state = atomic_read(&nq->state);
 	if (state != NSS_QDISC_STATE_READY) {
@@ -1637,52 +1643,145 @@ int nss_qdisc_node_attach(struct nss_qdisc *nq, struct nss_qdisc *nq_child,
 	 */
 	msg_type = nss_qdisc_get_interface_msg(nq->is_bridge, NSS_QDISC_IF_SHAPER_CONFIG);
 	nss_qdisc_msg_init(nim, nq->nss_interface_number, msg_type, sizeof(struct nss_if_shaper_configure),
-				nss_qdisc_node_attach_callback,
-				nq);
-	nim->msg.shaper_configure.config.request_type = attach_type;
+				cb, nq);
+	nim->msg.shaper_configure.config.request_type = request_type;
 	rc = nss_if_tx_msg(nq->nss_shaping_ctx, nim);
 
 	if (rc != NSS_TX_SUCCESS) {
-		nss_qdisc_warning("Failed to send configure message for "
-					"qdisc type %d\n", nq->type);
+		nss_qdisc_warning("Qdisc %px (type %d): Failed to send configure "
+					"message\n", nq->qdisc, nq->type);
 		atomic_set(&nq->state, NSS_QDISC_STATE_READY);
 		return -1;
 	}
 
-	/*
-	 * Wait until cleanup operation is complete at which point the state
-	 * shall become non-idle.
-	 */
-	if (!wait_event_timeout(nq->wait_queue, atomic_read(&nq->state) != NSS_QDISC_STATE_IDLE,
-				NSS_QDISC_COMMAND_TIMEOUT)) {
-		nss_qdisc_error("attach for qdisc %x timedout!\n", nq->qos_tag);
-		atomic_set(&nq->state, NSS_QDISC_STATE_READY);
-		return -1;
+	if (!nqb->count) {
+		nqb->start = ktime_get();
 	}
 
-	state = atomic_read(&nq->state);
-	if (state != NSS_QDISC_STATE_READY) {
-		nss_qdisc_error("Qdisc %px (type %d) failed to attach child "
-			"node, State: %d\n", nq->qdisc, nq->type, state);
-		atomic_set(&nq->state, NSS_QDISC_STATE_READY);
-		return -1;
+	nqb->nq[nqb->count] = nq;
+	nqb->nq_child[nqb->count] = nq_child;
+	nqb->count++;
+	return 0;
+}
+
+/*
+ * nss_qdisc_batch_wait()
+ *	Waits for the responses of every message in the batch.
+ *
+ * All messages share one command timeout, so a batch costs a single
+ * round trip to the NSS rather than one per message. Every node is
+ * returned to READY whatever the outcome.
+ */
+int nss_qdisc_batch_wait(struct nss_qdisc_batch *nqb)
+{
+	unsigned long deadline = jiffies + NSS_QDISC_COMMAND_TIMEOUT;
+	unsigned long remaining;
+	struct nss_qdisc *nq, *nq_child;
+	int32_t state;
+	int i, ret = 0;
+
+	for (i = 0; i < nqb->count; i++) {
+		nq = nqb->nq[i];
+		nq_child = nqb->nq_child[i];
+
+		/*
+		 * Wait until the operation is complete at which point the state
+		 * shall become non-idle.
+		 */
+		remaining = time_after(deadline, jiffies) ? deadline - jiffies : 1;
+		if (!wait_event_timeout(nq->wait_queue, atomic_read(&nq->state) != NSS_QDISC_STATE_IDLE,
+					remaining)) {
+			nss_qdisc_error("%s for qdisc %x timedout!\n",
+					nq_child ? "attach" : "configure", nq->qos_tag);
+			atomic_set(&nq->state, NSS_QDISC_STATE_READY);
+			ret = -1;
+			continue;
+		}
+
+		state = atomic_read(&nq->state);
+		if (state != NSS_QDISC_STATE_READY) {
+			nss_qdisc_error("Qdisc %px (type %d): failed to %s shaper "
+				"node, State: %d\n", nq->qdisc, nq->type,
+				nq_child ? "attach child" : "configure", state);
+			atomic_set(&nq->state, NSS_QDISC_STATE_READY);
+			ret = -1;
+			continue;
+		}
+
+		if (!nq_child) {
+			continue;
+		}
+
+		/*
+		 * Save the parent node (helps in debugging)
+		 */
+		spin_lock_bh(&nq_child->lock);
+		nq_child->parent = nq;
+		spin_unlock_bh(&nq_child->lock);
+
+#if defined(NSS_QDISC_PPE_SUPPORT)
+		/*
+		 * In case of hybrid mode, enable PPE queues when NSS queuing
+		 * Qdiscs are attached in the hierarchy.
+		 */
+		nss_ppe_all_queue_enable_hybrid(nq_child);
+#endif
 	}
 
-	/*
-	 * Save the parent node (helps in debugging)
-	 */
-	spin_lock_bh(&nq_child->lock);
-	nq_child->parent = nq;
-	spin_unlock_bh(&nq_child->lock);
+	if (nqb->count) {
+		nss_qdisc_info("batch of %d messages completed in %lldus\n", nqb->count,
+				ktime_us_delta(ktime_get(), nqb->start));
+	}
 
+	nqb->count = 0;
+	return ret;
+}
+
+/*
+ * nss_qdisc_node_attach_batch()
+ *	Sends a node attach message as part of a batch.
+ */
+int nss_qdisc_node_attach_batch(struct nss_qdisc *nq, struct nss_qdisc *nq_child,
+			struct nss_if_msg *nim, int32_t attach_type,
+			struct nss_qdisc_batch *nqb)
+{
+	nss_qdisc_info("Qdisc %px (type %d) attaching\n",
+			nq->qdisc, nq->type);
 #if defined(NSS_QDISC_PPE_SUPPORT)
-	/*
-	 * In case of hybrid mode, enable PPE queues when NSS queuing
-	 * Qdiscs are attached in the hierarchy.
-	 */
-	nss_ppe_all_queue_enable_hybrid(nq_child);
+	if (nq->mode == NSS_QDISC_MODE_PPE) {
+		if (nss_ppe_node_attach(nq, nq_child) < 0) {
+			nss_qdisc_warning("attach of new qdisc %px failed\n", nq_child->qdisc);
+			return -EINVAL;
+
+		}
+		nim->msg.shaper_configure.config.msg.shaper_node_config.snc.ppe_sn_attach.child_qos_tag = nq_child->qos_tag;
+	}
 #endif
 
+	return nss_qdisc_batch_send(nq, nq_child, nim, attach_type,
+				nss_qdisc_node_attach_callback, nqb);
+}
+
+/*
+ * nss_qdisc_node_attach()
+ *	Configuration function that helps attach a child shaper node to a parent.
+ */
+int nss_qdisc_node_attach(struct nss_qdisc *nq, struct nss_qdisc *nq_child,
+			struct nss_if_msg *nim, int32_t attach_type)
+{
+	struct nss_qdisc_batch nqb;
+	int rc;
+
+	nss_qdisc_batch_init(&nqb);
+	rc = nss_qdisc_node_attach_batch(nq, nq_child, nim, attach_type, &nqb);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (nss_qdisc_batch_wait(&nqb) < 0) {
+		return -1;
+	}
+
 	nss_qdisc_info("Qdisc %px (type %d): shaper node attach complete\n",
 			nq->qdisc, nq->type);
 	return 0;
@@ -1824,6 +1923,19 @@ static void nss_qdisc_configure_callback(void *app_data,
 	wake_up(&nq->wait_queue);
 }
 
+/*
+ * nss_qdisc_configure_batch()
+ *	Sends a node configure message as part of a batch.
+ */
+int nss_qdisc_configure_batch(struct nss_qdisc *nq, struct nss_if_msg *nim,
+			int32_t config_type, struct nss_qdisc_batch *nqb)
+{
+	nss_qdisc_info("Qdisc %px (type %d) configuring\n", nq->qdisc, nq->type);
+
+	return nss_qdisc_batch_send(nq, NULL, nim, config_type,
+				nss_qdisc_configure_callback, nqb);
+}
+
 /*
  * nss_qdisc_configure()
  *	Configuration function that aids in tuning of queuing parameters.
@@ -1831,56 +1943,14 @@ static void nss_qdisc_configure_callback(void *app_data,
 int nss_qdisc_configure(struct nss_qdisc *nq,
 	struct nss_if_msg *nim, int32_t config_type)
 {
-	int32_t state, rc;
-	int msg_type;
-
-	nss_qdisc_info("Qdisc %px (type %d) configuring\n", nq->qdisc, nq->type);
+	struct nss_qdisc_batch nqb;
 
-	state = atomic_read(&nq->state);
-	if (state != NSS_QDISC_STATE_READY) {
-		nss_qdisc_warning("Qdisc %px (type %d): not ready for configure, "
-				"state : %d\n", nq->qdisc, nq->type, state);
+	nss_qdisc_batch_init(&nqb);
+	if (nss_qdisc_configure_batch(nq, nim, config_type, &nqb) < 0) {
 		return -1;
 	}
 
-	/*
-	 * Set shaper node state to IDLE
-	 */
-	atomic_set(&nq->state, NSS_QDISC_STATE_IDLE);
-
-	/*
-	 * Create and send the shaper configure message to the NSS interface
-	 */
-	msg_type = nss_qdisc_get_interface_msg(nq->is_bridge, NSS_QDISC_IF_SHAPER_CONFIG);
-	nss_qdisc_msg_init(nim, nq->nss_interface_number, msg_type, sizeof(struct nss_if_shaper_configure),
-				nss_qdisc_configure_callback,
-				nq);
-	nim->msg.shaper_configure.config.request_type = config_type;
-	rc = nss_if_tx_msg(nq->nss_shaping_ctx, nim);
-
-	if (rc != NSS_TX_SUCCESS) {
-		nss_qdisc_warning("Qdisc %px (type %d): Failed to send configure "
-			"message\n", nq->qdisc, nq->type);
-		atomic_set(&nq->state, NSS_QDISC_STATE_READY);
-		return -1;
-	}
-
-	/*
-	 * Wait until cleanup operation is complete at which point the state
-	 * shall become non-idle.
-	 */
-	if (!wait_event_timeout(nq->wait_queue, atomic_read(&nq->state) != NSS_QDISC_STATE_IDLE,
-				NSS_QDISC_COMMAND_TIMEOUT)) {
-		nss_qdisc_error("configure for qdisc %x timedout!\n", nq->qos_tag);
-		atomic_set(&nq->state, NSS_QDISC_STATE_READY);
-		return -1;
-	}
-
-	state = atomic_read(&nq->state);
-	if (state != NSS_QDISC_STATE_READY) {
-		nss_qdisc_error("Qdisc %px (type %d): failed to configure shaper "
-			"node: State: %d\n", nq->qdisc, nq->type, state);
-		atomic_set(&nq->state, NSS_QDISC_STATE_READY);
+	if (nss_qdisc_batch_wait(&nqb) < 0) {
 		return -1;
 	}
 
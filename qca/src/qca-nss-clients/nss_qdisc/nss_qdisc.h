@@ -112,6 +112,8 @@
 
 #define NSS_QDISC_BRIDGE_PORT_MAX 100
 
+#define NSS_QDISC_BATCH_MAX 4
+
 #if (LINUX_VERSION_CODE <= KERNEL_VERSION(3,8,0))
 #define nss_qdisc_hlist_for_each_entry(tpos, pos, head, member) hlist_for_each_entry(tpos, pos, head, member)
 #define nss_qdisc_hlist_for_each_entry_safe(tpos, pos, n, head, member) hlist_for_each_entry_safe(tpos, pos, n, head, member)
@@ -223,6 +225,19 @@ struct nss_qdisc_bridge_update {
 	int unassign_count;
 };
 
+/*
+ * nss_qdisc batch structure
+ *	Shaper messages sent back to back and waited for together.
+ *	Each node may have only one message in a batch, since the
+ *	node state tracks a single outstanding response.
+ */
+struct nss_qdisc_batch {
+	struct nss_qdisc *nq[NSS_QDISC_BATCH_MAX];	/* Node each message was sent on */
+	struct nss_qdisc *nq_child[NSS_QDISC_BATCH_MAX];/* Child of an attach, NULL otherwise */
+	int count;					/* Messages in flight */
+	ktime_t start;					/* Time the first message was sent */
+};
+
 /*
  * Task types for bridge scanner.
  */
@@ -400,6 +415,33 @@ extern int nss_qdisc_node_detach(struct nss_qdisc *nq, struct nss_qdisc *nq_chil
 extern int nss_qdisc_configure(struct nss_qdisc *nq,
 	struct nss_if_msg *nim, int32_t config_type);
 
+/*
+ * nss_qdisc_batch_init()
+ *	Initializes an empty message batch.
+ */
+extern void nss_qdisc_batch_init(struct nss_qdisc_batch *nqb);
+
+/*
+ * nss_qdisc_node_attach_batch()
+ *	Sends a node attach message without waiting for its response.
+ */
+extern int nss_qdisc_node_attach_batch(struct nss_qdisc *nq, struct nss_qdisc *nq_child,
+					struct nss_if_msg *nim, int32_t attach_type,
+					struct nss_qdisc_batch *nqb);
+
+/*
+ * nss_qdisc_configure_batch()
+ *	Sends a node configure message without waiting for its response.
+ */
+extern int nss_qdisc_configure_batch(struct nss_qdisc *nq, struct nss_if_msg *nim,
+					int32_t config_type, struct nss_qdisc_batch *nqb);
+
+/*
+ * nss_qdisc_batch_wait()
+ *	Waits once for every message in the batch, returns -1 if any failed.
+ */
+extern int nss_qdisc_batch_wait(struct nss_qdisc_batch *nqb);
+
 
 /*
  * nss_qdisc_register_configure_callback()
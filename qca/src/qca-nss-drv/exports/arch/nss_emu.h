@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: ISC */
+
+/**
+ * @file nss_emu.h
+ *	Architecture dependent parameters for the emulated NSS core.
+ */
+#ifndef __NSS_EMU_H
+#define __NSS_EMU_H
+
+/**
+ * @addtogroup nss_arch_macros_emu
+ * @{
+ */
+
+#define NSS_MAX_NUM_PRI 4		/**< Maximum number of priority queues in NSS. */
+#define NSS_HOST_CORES 2		/**< Number of host cores. */
+
+#define NSS_N2H_RING_COUNT 3		/**< Number of N2H rings. */
+#define NSS_H2N_RING_COUNT 7		/**< Number of H2N rings. */
+#define NSS_RING_SIZE	128		/**< Ring size. */
+
+/**
+ * @}
+ */
+
+#endif /** __NSS_EMU_H */
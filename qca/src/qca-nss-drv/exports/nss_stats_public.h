@@ -115,6 +115,54 @@ enum nss_stats_types {
 	NSS_STATS_TYPE_MAX			/**< Maximum message type. */
 };
 
+/**
+ * Binary statistics snapshot magic ("NSSB") and layout version.
+ */
+#define NSS_STATS_BIN_MAGIC 0x4e535342
+#define NSS_STATS_BIN_VERSION 1
+
+/**
+ * nss_stats_bin_section_type
+ *	Sections of the binary statistics snapshot.
+ *
+ * Statistics in each section are indexed by the matching enum: nss_stats_node,
+ * nss_ipv4_stats_types, nss_ipv4_exception_events, nss_ipv6_stats_types,
+ * nss_ipv6_exception_events and nss_n2h_stats_types.
+ */
+enum nss_stats_bin_section_type {
+	NSS_STATS_BIN_SECTION_NODE,		/**< Common node statistics, instance is the interface number. */
+	NSS_STATS_BIN_SECTION_IPV4,		/**< IPv4 node statistics. */
+	NSS_STATS_BIN_SECTION_IPV4_EXCEPTION,	/**< IPv4 exception statistics. */
+	NSS_STATS_BIN_SECTION_IPV6,		/**< IPv6 node statistics. */
+	NSS_STATS_BIN_SECTION_IPV6_EXCEPTION,	/**< IPv6 exception statistics. */
+	NSS_STATS_BIN_SECTION_N2H,		/**< N2H statistics, instance is the core. */
+	NSS_STATS_BIN_SECTION_MAX,		/**< Maximum section type. */
+};
+
+/**
+ * nss_stats_bin_header
+ *	Header of the binary statistics snapshot.
+ */
+struct nss_stats_bin_header {
+	uint32_t magic;			/**< NSS_STATS_BIN_MAGIC. */
+	uint16_t version;		/**< NSS_STATS_BIN_VERSION. */
+	uint16_t num_sections;		/**< Number of sections following the header. */
+	uint32_t len;			/**< Length of the snapshot including this header. */
+	uint32_t reserved;		/**< Reserved, zero. */
+};
+
+/**
+ * nss_stats_bin_section
+ *	Section of the binary statistics snapshot.
+ */
+struct nss_stats_bin_section {
+	uint16_t type;			/**< Section type, see nss_stats_bin_section_type. */
+	uint16_t instance;		/**< Interface number or core, 0 otherwise. */
+	uint16_t num_stats;		/**< Number of statistics in this section. */
+	uint16_t reserved;		/**< Reserved, zero. */
+	uint64_t stats[];		/**< Statistics values. */
+};
+
 /**
  * nss_stats_notifier_action
  *	Statistics notification types.
@@ -1543,13 +1543,13 @@ static int32_t nss_core_handle_cause_queue(struct int_ctx_instance *int_ctx, uin
 	start = hlos_index;
 	end = (hlos_index + count) & mask;
 	if (end > start) {
-		dmac_inv_range((void *)&desc_ring[start], (void *)&desc_ring[end] + sizeof(struct n2h_descriptor));
+		NSS_CORE_DMA_CACHE_MAINT((void *)&desc_ring[start], (end - start + 1) * sizeof(struct n2h_descriptor), DMA_FROM_DEVICE);
 	} else {
 		/*
 		 * We have wrapped around
 		 */
-		dmac_inv_range((void *)&desc_ring[start], (void *)&desc_ring[mask] + sizeof(struct n2h_descriptor));
-		dmac_inv_range((void *)&desc_ring[0], (void *)&desc_ring[end] + sizeof(struct n2h_descriptor));
+		NSS_CORE_DMA_CACHE_MAINT((void *)&desc_ring[start], (mask - start + 1) * sizeof(struct n2h_descriptor), DMA_FROM_DEVICE);
+		NSS_CORE_DMA_CACHE_MAINT((void *)&desc_ring[0], (end + 1) * sizeof(struct n2h_descriptor), DMA_FROM_DEVICE);
 	}
 
 	/*
@@ -1990,13 +1990,13 @@ static void nss_core_alloc_max_avail_size_buffers(struct nss_ctx_instance *nss_c
 	 * Flush the descriptors, including the descriptor at prev_hlos_index.
 	 */
 	if (prev_hlos_index > start) {
-		dmac_clean_range((void *)&desc_ring[start], (void *)&desc_ring[prev_hlos_index] + sizeof(struct h2n_descriptor));
+		NSS_CORE_DMA_CACHE_MAINT((void *)&desc_ring[start], (prev_hlos_index - start + 1) * sizeof(struct h2n_descriptor), DMA_TO_DEVICE);
 	} else {
 		/*
 		 * We have wrapped around
 		 */
-		dmac_clean_range((void *)&desc_ring[start], (void *)&desc_ring[mask] + sizeof(struct h2n_descriptor));
-		dmac_clean_range((void *)&desc_ring[0], (void *)&desc_ring[prev_hlos_index] + sizeof(struct h2n_descriptor));
+		NSS_CORE_DMA_CACHE_MAINT((void *)&desc_ring[start], (mask - start + 1) * sizeof(struct h2n_descriptor), DMA_TO_DEVICE);
+		NSS_CORE_DMA_CACHE_MAINT((void *)&desc_ring[0], (prev_hlos_index + 1) * sizeof(struct h2n_descriptor), DMA_TO_DEVICE);
 	}
 
 	/*
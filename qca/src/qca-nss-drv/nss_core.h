@@ -102,7 +102,11 @@
 /*
  * Cache operation
  */
+#if defined(NSS_HAL_EMU_SUPPORT)
+#define NSS_CORE_DSB() mb()
+#else
 #define NSS_CORE_DSB() dsb(sy)
+#endif
 #define NSS_CORE_DMA_CACHE_MAINT(start, size, dir) nss_core_dma_cache_maint(start, size, dir)
 
 /*
@@ -111,6 +115,12 @@
  */
 static inline void nss_core_dma_cache_maint(void *start, uint32_t size, int direction)
 {
+#if defined(NSS_HAL_EMU_SUPPORT)
+	/*
+	 * The emulated core runs on host CPUs and shares coherent memory with us,
+	 * only the ordering of descriptor and index updates has to be kept.
+	 */
+#else
 	switch (direction) {
 	case DMA_FROM_DEVICE:/* invalidate only */
 		dmac_inv_range(start, start + size);
@@ -124,6 +134,7 @@ static inline void nss_core_dma_cache_maint(void *start, uint32_t size, int dire
 	default:
 		BUG();
 	}
+#endif
 }
 
 #define NSS_DEVICE_IF_START NSS_PHYSICAL_IF_START
@@ -189,7 +200,7 @@ static inline void nss_core_dma_cache_maint(void *start, uint32_t size, int dire
 #if defined(NSS_HAL_IPQ807x_SUPPORT) || defined(NSS_HAL_IPQ60XX_SUPPORT)
 #define NSS_MAX_IRQ_PER_INSTANCE 6
 #define NSS_MAX_IRQ_PER_CORE 10	/* must match with NSS_HAL_N2H_INTR_PURPOSE_MAX */
-#elif defined(NSS_HAL_IPQ50XX_SUPPORT)
+#elif defined(NSS_HAL_IPQ50XX_SUPPORT) || defined(NSS_HAL_EMU_SUPPORT)
 #define NSS_MAX_IRQ_PER_CORE 8
 #else
 #define NSS_MAX_IRQ_PER_INSTANCE 1
@@ -55,6 +55,9 @@ struct nss_data_plane_ops {
 
 extern struct nss_data_plane_ops nss_data_plane_gmac_ops;
 extern struct nss_data_plane_ops nss_data_plane_ops;
+#if defined(NSS_HAL_EMU_SUPPORT)
+extern struct nss_data_plane_ops nss_data_plane_emu_ops;
+#endif
 
 extern int nss_skip_nw_process;
 #endif
@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * nss_data_plane_emu.c
+ *	Data plane of the emulated NSS core.
+ *
+ * The emulated core has no physical ports, nothing is handed over to
+ * an ethernet driver.
+ */
+
+#include "nss_data_plane.h"
+#include "nss_phys_if.h"
+#include "nss_core.h"
+#include "nss_tx_rx_common.h"
+
+/*
+ * __nss_data_plane_register()
+ */
+static void __nss_data_plane_register(struct nss_ctx_instance *nss_ctx)
+{
+	nss_info("%px: emulated core has no physical ports to register\n", nss_ctx);
+}
+
+/*
+ * __nss_data_plane_unregister()
+ */
+static void __nss_data_plane_unregister(void)
+{
+}
+
+/*
+ * __nss_data_plane_stats_sync()
+ */
+static void __nss_data_plane_stats_sync(struct nss_phys_if_stats *stats, uint16_t interface)
+{
+}
+
+/*
+ * __nss_data_plane_get_mtu_sz()
+ */
+static uint16_t __nss_data_plane_get_mtu_sz(uint16_t max_mtu)
+{
+	return max_mtu;
+}
+
+/*
+ * nss_data_plane_emu_ops
+ */
+struct nss_data_plane_ops nss_data_plane_emu_ops = {
+	.data_plane_register = &__nss_data_plane_register,
+	.data_plane_unregister = &__nss_data_plane_unregister,
+	.data_plane_stats_sync = &__nss_data_plane_stats_sync,
+	.data_plane_get_mtu_sz = &__nss_data_plane_get_mtu_sz,
+};
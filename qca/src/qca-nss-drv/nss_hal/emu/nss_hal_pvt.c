@@ -0,0 +1,1141 @@
+/* SPDX-License-Identifier: ISC */
+
+/**
+ * nss_hal_pvt.c
+ *	NSS HAL private APIs for the emulated NSS core.
+ *
+ * The emulated core is a kernel thread playing the firmware side of the
+ * host interface: it hands out the nss_if_mem_map through a meminfo map
+ * built in host memory, drains the H2N rings, answers every command with
+ * an ACK, optionally echoes data packets back through the N2H rings and
+ * raises the N2H interrupts through software IRQs. It lets the host paths
+ * (descriptor rings, NAPI, skb recycling, message dispatch) run and be
+ * measured without NSS hardware.
+ *
+ * Writing a packet count to the "emu" debugfs file runs a loopback
+ * benchmark: the packets are sent on an interface of the emulated core,
+ * echoed and received through NAPI, the result is shown in the same file.
+ *
+ * Limitations:
+ *	- Buffers are reached through the opaque skb pointer, DMA addresses
+ *	  are only cookies. The host must not bounce or translate DMA (no
+ *	  IOMMU, no forced swiotlb), otherwise unmap would overwrite the data
+ *	  written by the emulated core.
+ *	- Only single segment packets are echoed, multi-segment packets,
+ *	  shaper bounce and rate test buffers are consumed.
+ *	- Paged empty buffers, profiler DMA and coredump are not emulated.
+ */
+
+#include <linux/err.h>
+#include <linux/version.h>
+#include <linux/interrupt.h>
+#include <linux/irq.h>
+#include <linux/kthread.h>
+#include <linux/wait.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/module.h>
+#include <linux/platform_device.h>
+#include <linux/dma-mapping.h>
+#include <linux/etherdevice.h>
+#include <linux/completion.h>
+#include "nss_hal.h"
+#include "nss_core.h"
+
+/*
+ * N2H interrupts
+ */
+#define NSS_IRQ_NAME_EMPTY_BUF_SOS "nss_empty_buf_sos"
+#define NSS_IRQ_NAME_EMPTY_BUF_QUEUE "nss_empty_buf_queue"
+#define NSS_IRQ_NAME_TX_UNBLOCK "nss-tx-unblock"
+#define NSS_IRQ_NAME_QUEUE0 "nss_queue0"
+#define NSS_IRQ_NAME_QUEUE1 "nss_queue1"
+
+/*
+ * Fake CSM address of the emulated core, it is never mapped
+ */
+#define NSS_HAL_EMU_NPHYS 0x40000000
+
+/*
+ * Empty buffers held by the emulated core for N2H packets.
+ * Below the low watermark an empty buffer SOS is raised.
+ */
+#define NSS_HAL_EMU_POOL_MAX (NSS_RING_SIZE * 2)
+#define NSS_HAL_EMU_POOL_LOW (NSS_RING_SIZE / 2)
+
+/*
+ * Poll period while interrupts are left asserted, and when idle
+ */
+#define NSS_HAL_EMU_BUSY_JIFFIES 1
+#define NSS_HAL_EMU_IDLE_JIFFIES HZ
+
+/*
+ * Purpose of each interrupt index
+ */
+enum nss_hal_n2h_intr_purpose {
+	NSS_HAL_N2H_INTR_PURPOSE_EMPTY_BUFFER_SOS = 0,
+	NSS_HAL_N2H_INTR_PURPOSE_EMPTY_BUFFER_QUEUE = 1,
+	NSS_HAL_N2H_INTR_PURPOSE_TX_UNBLOCKED = 2,
+	NSS_HAL_N2H_INTR_PURPOSE_DATA_QUEUE_0 = 3,
+	NSS_HAL_N2H_INTR_PURPOSE_DATA_QUEUE_1 = 4,
+	NSS_HAL_N2H_INTR_PURPOSE_MAX
+};
+
+/*
+ * Interrupt cause of each interrupt index
+ */
+static const uint32_t nss_hal_emu_intr_cause[NSS_HAL_N2H_INTR_PURPOSE_MAX] = {
+	NSS_N2H_INTR_EMPTY_BUFFERS_SOS,
+	NSS_N2H_INTR_EMPTY_BUFFER_QUEUE,
+	NSS_N2H_INTR_TX_UNBLOCKED,
+	NSS_N2H_INTR_DATA_QUEUE_0,
+	NSS_N2H_INTR_DATA_QUEUE_1,
+};
+
+/*
+ * What the emulated core does with data packets
+ */
+enum nss_hal_emu_mode {
+	NSS_HAL_EMU_MODE_CONSUME,	/* Return the buffer as a Tx completion */
+	NSS_HAL_EMU_MODE_ECHO,		/* Copy the packet back to the host on the same interface */
+};
+
+static int emu_mode = NSS_HAL_EMU_MODE_ECHO;
+module_param(emu_mode, int, S_IRUGO | S_IWUSR);
+MODULE_PARM_DESC(emu_mode, "Emulated core data mode: 0 = consume, 1 = echo");
+
+static int emu_batch = 64;
+module_param(emu_batch, int, S_IRUGO | S_IWUSR);
+MODULE_PARM_DESC(emu_batch, "Descriptors handled per H2N ring per emulated core round");
+
+/*
+ * nss_hal_emu_buf
+ *	Kept in skb->cb of the empty buffers held by the emulated core
+ */
+struct nss_hal_emu_buf {
+	uint32_t buffer;		/* DMA cookie given by the host */
+	uint16_t buffer_len;		/* Length of the buffer given by the host */
+};
+
+#define NSS_HAL_EMU_BUF(skb) ((struct nss_hal_emu_buf *)(skb)->cb)
+
+/*
+ * nss_hal_emu_meminfo
+ *	Meminfo map of the emulated firmware image
+ */
+struct nss_hal_emu_meminfo {
+	uint32_t start_magic;
+	struct nss_meminfo_request requests[1];
+	uint16_t end_magic;
+};
+
+/*
+ * nss_hal_emu_stats
+ *	Counters of the emulated core
+ */
+struct nss_hal_emu_stats {
+	uint64_t rounds;		/* Rounds run by the emulated core */
+	uint64_t cmd;			/* Commands acknowledged */
+	uint64_t cmd_drop;		/* Commands too large for an empty buffer */
+	uint64_t pkt_echo;		/* Packets echoed back to the host */
+	uint64_t pkt_consume;		/* Packets consumed */
+	uint64_t empty_return;		/* Buffers returned on the empty buffer queue */
+	uint64_t empty_hold;		/* Empty buffers taken from the host */
+	uint64_t stall;			/* Rounds stopped on a full N2H ring or an empty pool */
+	uint64_t irq;			/* Interrupts raised */
+};
+
+/*
+ * nss_hal_emu_core
+ *	State of one emulated core
+ */
+struct nss_hal_emu_core {
+	struct nss_ctx_instance *nss_ctx;	/* Host context of this core */
+	struct task_struct *thread;		/* Firmware thread */
+	wait_queue_head_t wq;			/* Firmware thread waits here for a doorbell */
+	atomic_t doorbell;			/* Host sent an interrupt */
+	unsigned long enabled;			/* N2H causes unmasked by the host */
+	struct sk_buff_head pool;		/* Empty buffers held for N2H packets */
+	int irq[NSS_HAL_N2H_INTR_PURPOSE_MAX];	/* Software IRQ of each interrupt index */
+	uint32_t meminfo_start[2];		/* Meminfo magic and map address */
+	struct nss_hal_emu_meminfo meminfo;	/* Meminfo map */
+	struct nss_hal_emu_stats stats;		/* Counters */
+};
+
+/*
+ * Loopback benchmark, the emulated core has no physical ports so any
+ * interface number is free
+ */
+#define NSS_HAL_EMU_BENCH_IF 0
+#define NSS_HAL_EMU_BENCH_LEN 64
+#define NSS_HAL_EMU_BENCH_TIMEOUT (5 * HZ)
+
+/*
+ * nss_hal_emu_bench
+ *	State and result of the last loopback benchmark
+ */
+struct nss_hal_emu_bench {
+	uint32_t count;			/* Packets to send */
+	atomic_t received;		/* Echoed packets received by the host */
+	struct completion done;		/* All packets came back */
+	uint32_t busy;			/* Sends retried on a full H2N ring */
+	uint64_t ns;			/* First send to last echo */
+	uint64_t rounds;		/* Emulated core rounds during the run */
+	uint64_t irq;			/* Interrupts raised during the run */
+};
+
+static struct nss_hal_emu_core nss_hal_emu_core[NSS_MAX_CORES];
+static struct nss_hal_emu_bench nss_hal_emu_bench;
+static DEFINE_MUTEX(nss_hal_emu_bench_lock);
+static struct nss_platform_data nss_hal_emu_pdata;
+static struct platform_device *nss_hal_emu_pdev;
+static struct dentry *nss_hal_emu_dentry;
+
+/*
+ * nss_hal_wq_function()
+ *	Added to Handle BH requests to kernel
+ */
+void nss_hal_wq_function(struct work_struct *work)
+{
+	nss_work_t *my_work = (nss_work_t *)work;
+
+	mutex_lock(&nss_top_main.wq_lock);
+
+	/*
+	 * There is no core clock, only the messages are exchanged
+	 */
+	nss_freq_change(&nss_top_main.nss[NSS_CORE_0], my_work->frequency, my_work->stats_enable, 0);
+	nss_freq_change(&nss_top_main.nss[NSS_CORE_0], my_work->frequency, my_work->stats_enable, 1);
+
+	mutex_unlock(&nss_top_main.wq_lock);
+	kfree((void *)work);
+}
+
+/*
+ * nss_hal_handle_irq()
+ */
+static irqreturn_t nss_hal_handle_irq(int irq, void *ctx)
+{
+	struct int_ctx_instance *int_ctx = (struct int_ctx_instance *) ctx;
+
+	disable_irq_nosync(irq);
+	napi_schedule(&int_ctx->napi);
+
+	return IRQ_HANDLED;
+}
+
+/*
+ * nss_hal_emu_kick()
+ *	Wake up the firmware thread
+ */
+static inline void nss_hal_emu_kick(struct nss_hal_emu_core *core)
+{
+	atomic_set(&core->doorbell, 1);
+	wake_up(&core->wq);
+}
+
+/*
+ * nss_hal_emu_irq_noop()
+ */
+static void nss_hal_emu_irq_noop(struct irq_data *data)
+{
+}
+
+/*
+ * nss_hal_emu_irq_retrigger()
+ *	An interrupt raised while masked is raised again by the next firmware round
+ */
+static int nss_hal_emu_irq_retrigger(struct irq_data *data)
+{
+	nss_hal_emu_kick((struct nss_hal_emu_core *)irq_data_get_irq_chip_data(data));
+	return 1;
+}
+
+static struct irq_chip nss_hal_emu_irq_chip = {
+	.name = "nss-emu",
+	.irq_mask = nss_hal_emu_irq_noop,
+	.irq_unmask = nss_hal_emu_irq_noop,
+	.irq_retrigger = nss_hal_emu_irq_retrigger,
+};
+
+/*
+ * nss_hal_emu_n2h_space()
+ *	Free descriptors in an N2H ring
+ */
+static inline uint32_t nss_hal_emu_n2h_space(struct nss_ctx_instance *nss_ctx, uint32_t qid)
+{
+	struct nss_if_mem_map *if_map = nss_ctx->meminfo_ctx.if_map;
+	uint32_t mask = nss_ctx->n2h_desc_ring[qid].desc_ring.size - 1;
+
+	return (READ_ONCE(if_map->n2h_hlos_index[qid]) - if_map->n2h_nss_index[qid] - 1) & mask;
+}
+
+/*
+ * nss_hal_emu_n2h_pending()
+ *	Descriptors of an N2H ring not yet read by the host
+ */
+static inline bool nss_hal_emu_n2h_pending(struct nss_ctx_instance *nss_ctx, uint32_t qid)
+{
+	struct nss_if_mem_map *if_map = nss_ctx->meminfo_ctx.if_map;
+
+	return READ_ONCE(if_map->n2h_hlos_index[qid]) != if_map->n2h_nss_index[qid];
+}
+
+/*
+ * nss_hal_emu_n2h_put()
+ *	Hand a buffer to the host on an N2H ring, the caller checks for space
+ */
+static void nss_hal_emu_n2h_put(struct nss_ctx_instance *nss_ctx, uint32_t qid, uint8_t buffer_type,
+				uint32_t if_num, struct sk_buff *nbuf, uint32_t buffer, uint16_t buffer_len,
+				uint16_t payload_offs, uint16_t payload_len)
+{
+	struct nss_if_mem_map *if_map = nss_ctx->meminfo_ctx.if_map;
+	struct n2h_desc_if_instance *desc_if = &nss_ctx->n2h_desc_ring[qid].desc_ring;
+	uint32_t nss_index = if_map->n2h_nss_index[qid];
+	struct n2h_descriptor *desc = &desc_if->desc[nss_index];
+
+	desc->interface_num = if_num;
+	desc->buffer = buffer;
+	desc->buffer_len = buffer_len;
+	desc->payload_len = payload_len;
+	desc->payload_offs = payload_offs;
+	desc->bit_flags = N2H_BIT_FLAG_FIRST_SEGMENT | N2H_BIT_FLAG_LAST_SEGMENT;
+	desc->buffer_type = buffer_type;
+	desc->response_type = 0;
+	desc->pri = 0;
+	desc->service_code = 0;
+	desc->opaque = (nss_ptr_t)nbuf;
+
+	/*
+	 * The descriptor must be visible before the index moves
+	 */
+	smp_wmb();
+	WRITE_ONCE(if_map->n2h_nss_index[qid], (nss_index + 1) & (desc_if->size - 1));
+}
+
+/*
+ * nss_hal_emu_reply()
+ *	Copy a payload into a held empty buffer and send it to the host
+ */
+static bool nss_hal_emu_reply(struct nss_hal_emu_core *core, uint32_t qid, uint8_t buffer_type,
+				uint32_t if_num, void *payload, uint16_t payload_len)
+{
+	struct sk_buff *nbuf = skb_peek(&core->pool);
+	struct nss_hal_emu_buf *buf = NSS_HAL_EMU_BUF(nbuf);
+
+	if (payload_len > buf->buffer_len - NET_SKB_PAD) {
+		return false;
+	}
+
+	__skb_unlink(nbuf, &core->pool);
+	memcpy(nbuf->head + NET_SKB_PAD, payload, payload_len);
+	nss_hal_emu_n2h_put(core->nss_ctx, qid, buffer_type, if_num, nbuf, buf->buffer, buf->buffer_len,
+				NET_SKB_PAD, payload_len);
+	return true;
+}
+
+/*
+ * nss_hal_emu_dispose()
+ *	Done with an H2N buffer, hold it for N2H packets or give it back to the host
+ */
+static void nss_hal_emu_dispose(struct nss_hal_emu_core *core, struct h2n_descriptor *desc)
+{
+	struct sk_buff *nbuf = (struct sk_buff *)desc->opaque;
+
+	/*
+	 * Only the last segment of a frags[] packet carries the skb
+	 */
+	if (!nbuf) {
+		return;
+	}
+
+	if ((desc->bit_flags & H2N_BIT_FLAG_BUFFER_REUSABLE) && !skb_shinfo(nbuf)->nr_frags
+			&& (desc->buffer_len > NET_SKB_PAD)
+			&& (skb_queue_len(&core->pool) < NSS_HAL_EMU_POOL_MAX)) {
+		NSS_HAL_EMU_BUF(nbuf)->buffer = desc->buffer;
+		NSS_HAL_EMU_BUF(nbuf)->buffer_len = desc->buffer_len;
+		__skb_queue_tail(&core->pool, nbuf);
+		core->stats.empty_hold++;
+		return;
+	}
+
+	nss_hal_emu_n2h_put(core->nss_ctx, NSS_IF_N2H_EMPTY_BUFFER_RETURN_QUEUE, N2H_BUFFER_EMPTY, 0, nbuf,
+				desc->buffer, desc->buffer_len, desc->payload_offs, desc->payload_len);
+	core->stats.empty_return++;
+}
+
+/*
+ * nss_hal_emu_h2n_pop()
+ *	Next H2N descriptor posted by the host or NULL
+ */
+static struct h2n_descriptor *nss_hal_emu_h2n_pop(struct nss_ctx_instance *nss_ctx, uint32_t qid)
+{
+	struct nss_if_mem_map *if_map = nss_ctx->meminfo_ctx.if_map;
+	struct h2n_desc_if_instance *desc_if = &nss_ctx->h2n_desc_rings[qid].desc_ring;
+	uint32_t nss_index = if_map->h2n_nss_index[qid];
+
+	if (READ_ONCE(if_map->h2n_hlos_index[qid]) == nss_index) {
+		return NULL;
+	}
+
+	/*
+	 * Read the descriptor only after seeing the index
+	 */
+	smp_rmb();
+	return &desc_if->desc[nss_index];
+}
+
+/*
+ * nss_hal_emu_h2n_advance()
+ */
+static inline void nss_hal_emu_h2n_advance(struct nss_ctx_instance *nss_ctx, uint32_t qid)
+{
+	struct nss_if_mem_map *if_map = nss_ctx->meminfo_ctx.if_map;
+	uint32_t mask = nss_ctx->h2n_desc_rings[qid].desc_ring.size - 1;
+
+	smp_mb();
+	WRITE_ONCE(if_map->h2n_nss_index[qid], (if_map->h2n_nss_index[qid] + 1) & mask);
+}
+
+/*
+ * nss_hal_emu_drain_empty()
+ *	Take empty buffers posted by the host
+ */
+static void nss_hal_emu_drain_empty(struct nss_hal_emu_core *core, uint32_t qid)
+{
+	struct nss_ctx_instance *nss_ctx = core->nss_ctx;
+	struct h2n_descriptor *desc;
+	int budget = emu_batch;
+
+	while (budget-- && (desc = nss_hal_emu_h2n_pop(nss_ctx, qid))) {
+		struct sk_buff *nbuf = (struct sk_buff *)desc->opaque;
+
+		/*
+		 * Paged buffers cannot take a copied packet, give them back
+		 */
+		if ((qid == NSS_IF_H2N_EMPTY_BUFFER_QUEUE) && !skb_shinfo(nbuf)->nr_frags
+				&& (skb_queue_len(&core->pool) < NSS_HAL_EMU_POOL_MAX)) {
+			NSS_HAL_EMU_BUF(nbuf)->buffer = desc->buffer;
+			NSS_HAL_EMU_BUF(nbuf)->buffer_len = desc->buffer_len;
+			__skb_queue_tail(&core->pool, nbuf);
+			core->stats.empty_hold++;
+		} else if (nss_hal_emu_n2h_space(nss_ctx, NSS_IF_N2H_EMPTY_BUFFER_RETURN_QUEUE)) {
+			nss_hal_emu_n2h_put(nss_ctx, NSS_IF_N2H_EMPTY_BUFFER_RETURN_QUEUE, N2H_BUFFER_EMPTY, 0, nbuf,
+						desc->buffer, desc->buffer_len, 0, desc->buffer_len);
+			core->stats.empty_return++;
+		} else {
+			core->stats.stall++;
+			return;
+		}
+
+		nss_hal_emu_h2n_advance(nss_ctx, qid);
+	}
+}
+
+/*
+ * nss_hal_emu_process()
+ *	Handle the command ring or a data ring, returns true if a descriptor was taken
+ */
+static bool nss_hal_emu_process(struct nss_hal_emu_core *core, uint32_t qid)
+{
+	struct nss_ctx_instance *nss_ctx = core->nss_ctx;
+	struct h2n_descriptor *desc;
+	uint32_t reply_qid = NSS_IF_N2H_DATA_QUEUE_0;
+	int budget = emu_batch;
+	bool taken = false;
+
+	if (qid >= NSS_IF_H2N_DATA_QUEUE) {
+		reply_qid += ((qid - NSS_IF_H2N_DATA_QUEUE) >> 1) & 1;
+	}
+
+	while (budget-- && (desc = nss_hal_emu_h2n_pop(nss_ctx, qid))) {
+		struct sk_buff *nbuf = (struct sk_buff *)desc->opaque;
+		bool single = (desc->bit_flags & H2N_BIT_FLAG_FIRST_SEGMENT) && (desc->bit_flags & H2N_BIT_FLAG_LAST_SEGMENT);
+		bool echo = (emu_mode == NSS_HAL_EMU_MODE_ECHO) && single && nbuf && !skb_shinfo(nbuf)->nr_frags
+				&& (desc->buffer_type == H2N_BUFFER_PACKET);
+		void *payload = nbuf ? nbuf->head + desc->payload_offs : NULL;
+
+		/*
+		 * Make sure the buffer can be given back and the reply has a slot and a buffer
+		 */
+		if (!nss_hal_emu_n2h_space(nss_ctx, NSS_IF_N2H_EMPTY_BUFFER_RETURN_QUEUE)
+				|| (((desc->buffer_type == H2N_BUFFER_CTRL) || echo)
+				&& (skb_queue_empty(&core->pool) || !nss_hal_emu_n2h_space(nss_ctx, reply_qid)))) {
+			core->stats.stall++;
+			break;
+		}
+
+		if (desc->buffer_type == H2N_BUFFER_CTRL) {
+			struct nss_cmn_msg *ncm = (struct nss_cmn_msg *)payload;
+
+			ncm->response = NSS_CMN_RESPONSE_ACK;
+			if (nss_hal_emu_reply(core, reply_qid, N2H_BUFFER_STATUS, 0, payload, desc->payload_len)) {
+				core->stats.cmd++;
+			} else {
+				core->stats.cmd_drop++;
+			}
+		} else if (echo && nss_hal_emu_reply(core, reply_qid, N2H_BUFFER_PACKET, desc->interface_num,
+							payload, desc->payload_len)) {
+			core->stats.pkt_echo++;
+		} else {
+			core->stats.pkt_consume++;
+		}
+
+		nss_hal_emu_dispose(core, desc);
+		nss_hal_emu_h2n_advance(nss_ctx, qid);
+		taken = true;
+	}
+
+	return taken;
+}
+
+/*
+ * nss_hal_emu_raise()
+ *	Raise the interrupts whose cause is asserted and unmasked
+ */
+static bool nss_hal_emu_raise(struct nss_hal_emu_core *core, uint32_t asserted)
+{
+	unsigned long flags;
+	bool raised = false;
+	int i;
+
+	for (i = 0; i < NSS_HAL_N2H_INTR_PURPOSE_MAX; i++) {
+		if (!(asserted & READ_ONCE(core->enabled) & nss_hal_emu_intr_cause[i])) {
+			continue;
+		}
+
+		/*
+		 * Enter the handler the way an interrupt would, NAPI runs on BH enable
+		 */
+		local_bh_disable();
+		local_irq_save(flags);
+		generic_handle_irq(core->irq[i]);
+		local_irq_restore(flags);
+		local_bh_enable();
+
+		core->stats.irq++;
+		raised = true;
+	}
+
+	return raised;
+}
+
+/*
+ * nss_hal_emu_round()
+ *	One pass of the emulated firmware, returns the asserted causes
+ */
+static uint32_t nss_hal_emu_round(struct nss_hal_emu_core *core)
+{
+	struct nss_ctx_instance *nss_ctx = core->nss_ctx;
+	uint32_t asserted = 0;
+	bool unblocked = false;
+	int i;
+
+	core->stats.rounds++;
+
+	nss_hal_emu_drain_empty(core, NSS_IF_H2N_EMPTY_BUFFER_QUEUE);
+	nss_hal_emu_drain_empty(core, NSS_IF_H2N_EMPTY_PAGED_BUFFER_QUEUE);
+	nss_hal_emu_process(core, NSS_IF_H2N_CMD_QUEUE);
+
+	for (i = NSS_IF_H2N_DATA_QUEUE; i < NSS_H2N_RING_COUNT; i++) {
+		unblocked |= nss_hal_emu_process(core, i);
+	}
+
+	/*
+	 * Interrupts are level triggered: kept asserted until the host catches up
+	 */
+	if (nss_hal_emu_n2h_pending(nss_ctx, NSS_IF_N2H_EMPTY_BUFFER_RETURN_QUEUE)) {
+		asserted |= NSS_N2H_INTR_EMPTY_BUFFER_QUEUE;
+	}
+
+	if (nss_hal_emu_n2h_pending(nss_ctx, NSS_IF_N2H_DATA_QUEUE_0)) {
+		asserted |= NSS_N2H_INTR_DATA_QUEUE_0;
+	}
+
+	if (nss_hal_emu_n2h_pending(nss_ctx, NSS_IF_N2H_DATA_QUEUE_1)) {
+		asserted |= NSS_N2H_INTR_DATA_QUEUE_1;
+	}
+
+	if (skb_queue_len(&core->pool) < NSS_HAL_EMU_POOL_LOW) {
+		asserted |= NSS_N2H_INTR_EMPTY_BUFFERS_SOS;
+	}
+
+	if (unblocked) {
+		asserted |= NSS_N2H_INTR_TX_UNBLOCKED;
+	}
+
+	return asserted;
+}
+
+/*
+ * nss_hal_emu_thread()
+ *	Emulated firmware
+ */
+static int nss_hal_emu_thread(void *arg)
+{
+	struct nss_hal_emu_core *core = (struct nss_hal_emu_core *)arg;
+	long timeout = NSS_HAL_EMU_BUSY_JIFFIES;
+
+	while (!kthread_should_stop()) {
+		wait_event_interruptible_timeout(core->wq, atomic_read(&core->doorbell) || kthread_should_stop(), timeout);
+		atomic_set(&core->doorbell, 0);
+
+		timeout = NSS_HAL_EMU_IDLE_JIFFIES;
+		if (nss_hal_emu_raise(core, nss_hal_emu_round(core))) {
+			timeout = NSS_HAL_EMU_BUSY_JIFFIES;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * nss_hal_emu_meminfo_start()
+ *	Meminfo start label of the emulated firmware image
+ */
+uint32_t *nss_hal_emu_meminfo_start(struct nss_ctx_instance *nss_ctx)
+{
+	return nss_hal_emu_core[nss_ctx->id].meminfo_start;
+}
+
+/*
+ * nss_hal_emu_meminfo_map()
+ *	Meminfo map of the emulated firmware image
+ */
+uint32_t *nss_hal_emu_meminfo_map(struct nss_ctx_instance *nss_ctx)
+{
+	return &nss_hal_emu_core[nss_ctx->id].meminfo.start_magic;
+}
+
+/*
+ * __nss_hal_of_get_pdata()
+ *	Build the platform data of the emulated core, there is no device node.
+ */
+static struct nss_platform_data *__nss_hal_of_get_pdata(struct platform_device *pdev)
+{
+	struct nss_platform_data *npd = &nss_hal_emu_pdata;
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[0];
+	int32_t i;
+
+	memset(npd, 0, sizeof(*npd));
+	npd->id = 0;
+	npd->num_queue = 1;
+	npd->num_irq = NSS_HAL_N2H_INTR_PURPOSE_MAX;
+	npd->nphys = NSS_HAL_EMU_NPHYS;
+	npd->ipv4_enabled = NSS_FEATURE_ENABLED;
+	npd->ipv6_enabled = NSS_FEATURE_ENABLED;
+
+	for (i = 0; i < npd->num_irq; i++) {
+		npd->irq[i] = core->irq[i];
+	}
+
+	return npd;
+}
+
+/*
+ * __nss_hal_core_reset()
+ *	Bring the emulated core out of reset
+ */
+static int __nss_hal_core_reset(struct platform_device *nss_dev, void __iomem *map, uint32_t addr, uint32_t clk_src)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[nss_dev->id];
+	struct nss_ctx_instance *nss_ctx = &nss_top_main.nss[nss_dev->id];
+	struct nss_if_mem_map *if_map = nss_ctx->meminfo_ctx.if_map;
+
+	/*
+	 * Firmware side of the interface map
+	 */
+	if_map->magic = DEV_MAGIC;
+	if_map->if_version = 1;
+	if_map->num_phys_ports = 0;
+
+	core->nss_ctx = nss_ctx;
+	core->thread = kthread_run(nss_hal_emu_thread, core, "nss_emu%d", nss_dev->id);
+	if (IS_ERR(core->thread)) {
+		pr_err("%px: cannot start emulated core %d\n", nss_dev, nss_dev->id);
+		core->thread = NULL;
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+/*
+ * __nss_hal_debug_enable()
+ *	Enable NSS debug
+ */
+static void __nss_hal_debug_enable(void)
+{
+
+}
+
+/*
+ * __nss_hal_common_reset
+ *	Do reset/clock configuration common to all cores
+ */
+static int __nss_hal_common_reset(struct platform_device *nss_dev)
+{
+	nss_top_main.nss_hal_common_init_done = true;
+	nss_info("nss_hal_common_reset Done\n");
+
+	return 0;
+}
+
+/*
+ * __nss_hal_clock_configure()
+ */
+static int __nss_hal_clock_configure(struct nss_ctx_instance *nss_ctx, struct platform_device *nss_dev, struct nss_platform_data *npd)
+{
+	return 0;
+}
+
+/*
+ * __nss_hal_firmware_load()
+ */
+static int __nss_hal_firmware_load(struct nss_ctx_instance *nss_ctx, struct platform_device *nss_dev, struct nss_platform_data *npd)
+{
+	return 0;
+}
+
+/*
+ * __nss_hal_read_interrupt_cause()
+ */
+static void __nss_hal_read_interrupt_cause(struct nss_ctx_instance *nss_ctx, uint32_t shift_factor, uint32_t *cause)
+{
+}
+
+/*
+ * __nss_hal_clear_interrupt_cause()
+ */
+static void __nss_hal_clear_interrupt_cause(struct nss_ctx_instance *nss_ctx, uint32_t shift_factor, uint32_t cause)
+{
+}
+
+/*
+ * __nss_hal_disable_interrupt()
+ */
+static void __nss_hal_disable_interrupt(struct nss_ctx_instance *nss_ctx, uint32_t shift_factor, uint32_t cause)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[nss_ctx->id];
+	unsigned long bits = cause;
+	int bit;
+
+	for_each_set_bit(bit, &bits, 32) {
+		clear_bit(bit, &core->enabled);
+	}
+}
+
+/*
+ * __nss_hal_enable_interrupt()
+ */
+static void __nss_hal_enable_interrupt(struct nss_ctx_instance *nss_ctx, uint32_t shift_factor, uint32_t cause)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[nss_ctx->id];
+	unsigned long bits = cause;
+	int bit;
+
+	for_each_set_bit(bit, &bits, 32) {
+		set_bit(bit, &core->enabled);
+	}
+
+	nss_hal_emu_kick(core);
+}
+
+/*
+ * __nss_hal_send_interrupt()
+ */
+static void __nss_hal_send_interrupt(struct nss_ctx_instance *nss_ctx, uint32_t type)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[nss_ctx->id];
+
+	/*
+	 * Check if core and type is Valid
+	 */
+	nss_assert(nss_ctx->id < nss_top_main.num_nss);
+	nss_assert(type < NSS_H2N_INTR_TYPE_MAX);
+
+	if (unlikely(!core->thread)) {
+		return;
+	}
+
+	nss_hal_emu_kick(core);
+}
+
+/*
+ * __nss_hal_request_irq()
+ */
+static int __nss_hal_request_irq(struct nss_ctx_instance *nss_ctx, struct nss_platform_data *npd, int irq_num)
+{
+	struct int_ctx_instance *int_ctx = &nss_ctx->int_ctx[irq_num];
+	uint32_t cause, napi_wgt;
+	int err = -1, irq = npd->irq[irq_num];
+	int (*napi_poll_cb)(struct napi_struct *, int) = NULL;
+	const char *irq_name;
+
+	irq_set_status_flags(irq, IRQ_DISABLE_UNLAZY);
+
+	switch (irq_num) {
+	case NSS_HAL_N2H_INTR_PURPOSE_EMPTY_BUFFER_SOS:
+		napi_poll_cb = nss_core_handle_napi_non_queue;
+		napi_wgt = NSS_EMPTY_BUFFER_SOS_PROCESSING_WEIGHT;
+		cause = NSS_N2H_INTR_EMPTY_BUFFERS_SOS;
+		irq_name = NSS_IRQ_NAME_EMPTY_BUF_SOS;
+		break;
+
+	case NSS_HAL_N2H_INTR_PURPOSE_EMPTY_BUFFER_QUEUE:
+		napi_poll_cb = nss_core_handle_napi_queue;
+		napi_wgt = NSS_EMPTY_BUFFER_RETURN_PROCESSING_WEIGHT;
+		cause = NSS_N2H_INTR_EMPTY_BUFFER_QUEUE;
+		irq_name = NSS_IRQ_NAME_EMPTY_BUF_QUEUE;
+		break;
+
+	case NSS_HAL_N2H_INTR_PURPOSE_TX_UNBLOCKED:
+		napi_poll_cb = nss_core_handle_napi_non_queue;
+		napi_wgt = NSS_TX_UNBLOCKED_PROCESSING_WEIGHT;
+		cause = NSS_N2H_INTR_TX_UNBLOCKED;
+		irq_name = NSS_IRQ_NAME_TX_UNBLOCK;
+		break;
+
+	case NSS_HAL_N2H_INTR_PURPOSE_DATA_QUEUE_0:
+		napi_poll_cb = nss_core_handle_napi_queue;
+		napi_wgt = NSS_DATA_COMMAND_BUFFER_PROCESSING_WEIGHT;
+		cause = NSS_N2H_INTR_DATA_QUEUE_0;
+		irq_name = NSS_IRQ_NAME_QUEUE0;
+		break;
+
+	case NSS_HAL_N2H_INTR_PURPOSE_DATA_QUEUE_1:
+		napi_poll_cb = nss_core_handle_napi_queue;
+		napi_wgt = NSS_DATA_COMMAND_BUFFER_PROCESSING_WEIGHT;
+		cause = NSS_N2H_INTR_DATA_QUEUE_1;
+		irq_name = NSS_IRQ_NAME_QUEUE1;
+		break;
+
+	default:
+		nss_warning("%px: nss%d: unsupported irq# %d\n", nss_ctx, nss_ctx->id, irq_num);
+		return err;
+	}
+
+	netif_napi_add(&nss_ctx->napi_ndev, &int_ctx->napi, napi_poll_cb, napi_wgt);
+	int_ctx->cause = cause;
+	err = request_irq(irq, nss_hal_handle_irq, 0, irq_name, int_ctx);
+	if (err) {
+		nss_warning("%px: nss%d: request_irq failed for irq# %d\n", nss_ctx, nss_ctx->id, irq_num);
+		return err;
+	}
+	int_ctx->irq = irq;
+	return 0;
+}
+
+/*
+ * __nss_hal_init_imem
+ */
+void __nss_hal_init_imem(struct nss_ctx_instance *nss_ctx)
+{
+	/*
+	 * Nothing to be done as there is no TCM on the emulated core
+	 */
+}
+
+/*
+ * __nss_hal_init_utcm_shared
+ */
+bool __nss_hal_init_utcm_shared(struct nss_ctx_instance *nss_ctx, uint32_t *meminfo_start)
+{
+	/*
+	 * Nothing to be done as there is no UTCM_SHARED on the emulated core
+	 */
+	return true;
+}
+
+/*
+ * nss_hal_emu_ops
+ */
+struct nss_hal_ops nss_hal_emu_ops = {
+	.common_reset = __nss_hal_common_reset,
+	.core_reset = __nss_hal_core_reset,
+	.clock_configure = __nss_hal_clock_configure,
+	.firmware_load = __nss_hal_firmware_load,
+	.debug_enable = __nss_hal_debug_enable,
+	.of_get_pdata = __nss_hal_of_get_pdata,
+	.request_irq = __nss_hal_request_irq,
+	.send_interrupt = __nss_hal_send_interrupt,
+	.enable_interrupt = __nss_hal_enable_interrupt,
+	.disable_interrupt = __nss_hal_disable_interrupt,
+	.clear_interrupt_cause = __nss_hal_clear_interrupt_cause,
+	.read_interrupt_cause = __nss_hal_read_interrupt_cause,
+	.init_imem = __nss_hal_init_imem,
+	.init_utcm_shared = __nss_hal_init_utcm_shared,
+};
+
+/*
+ * nss_hal_emu_stats_show()
+ */
+static int nss_hal_emu_stats_show(struct seq_file *m, void *v)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[0];
+	struct nss_hal_emu_stats *s = &core->stats;
+
+	seq_printf(m, "mode:         %s\n", (emu_mode == NSS_HAL_EMU_MODE_ECHO) ? "echo" : "consume");
+	seq_printf(m, "rounds:       %llu\n", s->rounds);
+	seq_printf(m, "cmd:          %llu\n", s->cmd);
+	seq_printf(m, "cmd_drop:     %llu\n", s->cmd_drop);
+	seq_printf(m, "pkt_echo:     %llu\n", s->pkt_echo);
+	seq_printf(m, "pkt_consume:  %llu\n", s->pkt_consume);
+	seq_printf(m, "empty_return: %llu\n", s->empty_return);
+	seq_printf(m, "empty_hold:   %llu\n", s->empty_hold);
+	seq_printf(m, "pool:         %u\n", skb_queue_len(&core->pool));
+	seq_printf(m, "stall:        %llu\n", s->stall);
+	seq_printf(m, "irq:          %llu\n", s->irq);
+
+	mutex_lock(&nss_hal_emu_bench_lock);
+	if (nss_hal_emu_bench.ns) {
+		struct nss_hal_emu_bench *b = &nss_hal_emu_bench;
+		uint32_t received = atomic_read(&b->received);
+
+		seq_printf(m, "bench:        %u/%u packets in %llu ns, %llu pps, %llu rounds, %llu irq, %u busy\n",
+				received, b->count, b->ns, div64_u64((uint64_t)received * NSEC_PER_SEC, b->ns),
+				b->rounds, b->irq, b->busy);
+	}
+	mutex_unlock(&nss_hal_emu_bench_lock);
+	return 0;
+}
+
+/*
+ * nss_hal_emu_bench_rx()
+ *	Echoed benchmark packet, called from NAPI
+ */
+static void nss_hal_emu_bench_rx(struct net_device *ndev, struct sk_buff *skb, struct napi_struct *napi)
+{
+	struct nss_hal_emu_bench *b = &nss_hal_emu_bench;
+
+	dev_kfree_skb_any(skb);
+	if (atomic_inc_return(&b->received) == b->count) {
+		complete(&b->done);
+	}
+}
+
+/*
+ * nss_hal_emu_bench_run()
+ *	Send count packets through the host Tx path and wait for their echo
+ */
+static int nss_hal_emu_bench_run(struct nss_ctx_instance *nss_ctx, uint32_t count)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[nss_ctx->id];
+	struct nss_hal_emu_bench *b = &nss_hal_emu_bench;
+	struct sk_buff *skb = NULL;
+	struct net_device *ndev;
+	uint64_t rounds, irq;
+	uint32_t sent = 0;
+	int32_t status;
+	ktime_t start;
+	int err = 0;
+
+	if (emu_mode != NSS_HAL_EMU_MODE_ECHO) {
+		return -EINVAL;
+	}
+
+	/*
+	 * Packets are only delivered to an interface with a net_device
+	 */
+	ndev = alloc_etherdev(0);
+	if (!ndev) {
+		return -ENOMEM;
+	}
+
+	b->count = count;
+	b->busy = 0;
+	atomic_set(&b->received, 0);
+	init_completion(&b->done);
+	nss_core_register_subsys_dp(nss_ctx, NSS_HAL_EMU_BENCH_IF, nss_hal_emu_bench_rx, NULL, NULL, ndev, 0);
+
+	rounds = core->stats.rounds;
+	irq = core->stats.irq;
+	start = ktime_get();
+
+	while (sent < count) {
+		if (!skb) {
+			skb = dev_alloc_skb(NSS_HAL_EMU_BENCH_LEN);
+			if (!skb) {
+				err = -ENOMEM;
+				break;
+			}
+			skb_put(skb, NSS_HAL_EMU_BENCH_LEN);
+		}
+
+		status = nss_core_send_packet(nss_ctx, skb, NSS_HAL_EMU_BENCH_IF, 0);
+		if (status == NSS_CORE_STATUS_SUCCESS) {
+			skb = NULL;
+			sent++;
+			continue;
+		}
+
+		if (status != NSS_CORE_STATUS_FAILURE_QUEUE) {
+			err = -EIO;
+			break;
+		}
+
+		b->busy++;
+		cond_resched();
+	}
+
+	if (skb) {
+		dev_kfree_skb_any(skb);
+	}
+
+	if (!err && !wait_for_completion_timeout(&b->done, NSS_HAL_EMU_BENCH_TIMEOUT)) {
+		err = -ETIMEDOUT;
+	}
+
+	b->ns = ktime_to_ns(ktime_sub(ktime_get(), start)) ? : 1;
+	b->rounds = core->stats.rounds - rounds;
+	b->irq = core->stats.irq - irq;
+
+	/*
+	 * A late echo may still be in NAPI with the old registration
+	 */
+	nss_core_unregister_subsys_dp(nss_ctx, NSS_HAL_EMU_BENCH_IF);
+	synchronize_net();
+	free_netdev(ndev);
+	return err;
+}
+
+/*
+ * nss_hal_emu_stats_write()
+ *	Run the loopback benchmark with the packet count written
+ */
+static ssize_t nss_hal_emu_stats_write(struct file *file, const char __user *buf, size_t len, loff_t *ppos)
+{
+	uint32_t count;
+	int err;
+
+	err = kstrtou32_from_user(buf, len, 0, &count);
+	if (err) {
+		return err;
+	}
+
+	if (!count) {
+		return -EINVAL;
+	}
+
+	mutex_lock(&nss_hal_emu_bench_lock);
+	err = nss_hal_emu_bench_run(&nss_top_main.nss[0], count);
+	mutex_unlock(&nss_hal_emu_bench_lock);
+
+	return err ? err : len;
+}
+
+/*
+ * nss_hal_emu_stats_open()
+ */
+static int nss_hal_emu_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, nss_hal_emu_stats_show, inode->i_private);
+}
+
+static const struct file_operations nss_hal_emu_stats_ops = {
+	.owner = THIS_MODULE,
+	.open = nss_hal_emu_stats_open,
+	.read = seq_read,
+	.write = nss_hal_emu_stats_write,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+
+/*
+ * nss_hal_emu_init()
+ *	Create the emulated core and its platform device
+ */
+int nss_hal_emu_init(void)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[0];
+	struct nss_meminfo_request *r = &core->meminfo.requests[0];
+	struct platform_device_info info = {
+		.name = "qca-nss",
+		.id = 0,
+
+		/*
+		 * DMA addresses are only cookies for the emulated core, a narrower
+		 * mask would bounce the buffers and lose what the core wrote.
+		 */
+		.dma_mask = DMA_BIT_MASK(64),
+	};
+	int i;
+
+	init_waitqueue_head(&core->wq);
+	__skb_queue_head_init(&core->pool);
+
+	/*
+	 * Meminfo map with the single request the host needs
+	 */
+	core->meminfo_start[0] = NSS_MEMINFO_RESERVE_AREA_MAGIC;
+	core->meminfo.start_magic = NSS_MEMINFO_MAP_START_MAGIC;
+	r->magic = NSS_MEMINFO_REQUEST_MAGIC;
+	strlcpy(r->name, "nss_if_mem_map_inst", sizeof(r->name));
+	r->memtype_default = NSS_MEMINFO_MEMTYPE_SDRAM;
+	r->alignment = L1_CACHE_BYTES;
+	r->size = sizeof(struct nss_if_mem_map);
+	core->meminfo.end_magic = NSS_MEMINFO_MAP_END_MAGIC;
+
+	for (i = 0; i < NSS_HAL_N2H_INTR_PURPOSE_MAX; i++) {
+		core->irq[i] = irq_alloc_desc(numa_node_id());
+		if (core->irq[i] < 0) {
+			pr_err("nss-emu: cannot allocate irq %d\n", i);
+			goto free_irq;
+		}
+
+		irq_set_chip_and_handler(core->irq[i], &nss_hal_emu_irq_chip, handle_simple_irq);
+		irq_set_chip_data(core->irq[i], core);
+		irq_clear_status_flags(core->irq[i], IRQ_NOREQUEST | IRQ_NOPROBE);
+	}
+
+	nss_hal_emu_pdev = platform_device_register_full(&info);
+	if (IS_ERR(nss_hal_emu_pdev)) {
+		pr_err("nss-emu: cannot register platform device\n");
+		nss_hal_emu_pdev = NULL;
+		goto free_irq;
+	}
+
+	if (nss_top_main.top_dentry) {
+		nss_hal_emu_dentry = debugfs_create_file("emu", 0600, nss_top_main.top_dentry, NULL, &nss_hal_emu_stats_ops);
+	}
+
+	return 0;
+
+free_irq:
+	while (i--) {
+		irq_free_desc(core->irq[i]);
+	}
+	return -EFAULT;
+}
+
+/*
+ * nss_hal_emu_exit()
+ *	Stop the emulated core and remove its platform device
+ */
+void nss_hal_emu_exit(void)
+{
+	struct nss_hal_emu_core *core = &nss_hal_emu_core[0];
+	int i;
+
+	/*
+	 * The stats directory goes away with the device
+	 */
+	debugfs_remove(nss_hal_emu_dentry);
+	nss_hal_emu_dentry = NULL;
+
+	if (core->thread) {
+		kthread_stop(core->thread);
+		core->thread = NULL;
+	}
+
+	if (nss_hal_emu_pdev) {
+		platform_device_unregister(nss_hal_emu_pdev);
+		nss_hal_emu_pdev = NULL;
+	}
+
+	__skb_queue_purge(&core->pool);
+
+	for (i = 0; i < NSS_HAL_N2H_INTR_PURPOSE_MAX; i++) {
+		irq_free_desc(core->irq[i]);
+	}
+}
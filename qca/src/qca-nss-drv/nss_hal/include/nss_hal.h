@@ -49,6 +49,13 @@ extern struct nss_hal_ops nss_hal_ipq50xx_ops;
 #if defined(NSS_HAL_FSM9010_SUPPORT)
 extern struct nss_hal_ops nss_hal_fsm9010_ops;
 #endif
+#if defined(NSS_HAL_EMU_SUPPORT)
+extern struct nss_hal_ops nss_hal_emu_ops;
+extern uint32_t *nss_hal_emu_meminfo_start(struct nss_ctx_instance *nss_ctx);
+extern uint32_t *nss_hal_emu_meminfo_map(struct nss_ctx_instance *nss_ctx);
+extern int nss_hal_emu_init(void);
+extern void nss_hal_emu_exit(void);
+#endif
 
 #define NSS_HAL_SUPPORTED_INTERRUPTS (NSS_N2H_INTR_EMPTY_BUFFER_QUEUE | \
 					NSS_N2H_INTR_DATA_QUEUE_0 | \
@@ -215,10 +215,12 @@ int nss_hal_probe(struct platform_device *nss_dev)
 	}
 
 #if (NSS_DT_SUPPORT == 1)
+#if !defined(NSS_HAL_EMU_SUPPORT)
 	if (!nss_dev->dev.of_node) {
 		pr_err("nss-driver: Device tree not available\n");
 		return -ENODEV;
 	}
+#endif
 
 	npd = nss_top->hal_ops->of_get_pdata(nss_dev);
 	if (!npd) {
@@ -633,12 +633,13 @@ static struct ctl_table_header *nss_dev_header;
  */
 static int __init nss_init(void)
 {
-#if (NSS_DT_SUPPORT == 1)
+#if (NSS_DT_SUPPORT == 1) && !defined(NSS_HAL_EMU_SUPPORT)
 	struct device_node *cmn = NULL;
 #endif
 	nss_info("Init NSS driver");
 
 #if (NSS_DT_SUPPORT == 1)
+#if !defined(NSS_HAL_EMU_SUPPORT)
 	/*
 	 * Get reference to NSS common device node
 	 */
@@ -648,6 +649,7 @@ static int __init nss_init(void)
 		return 0;
 	}
 	of_node_put(cmn);
+#endif
 
 	/*
 	 * Pick up HAL by target information
@@ -690,6 +692,11 @@ static int __init nss_init(void)
 		nss_top_main.data_plane_ops = &nss_data_plane_gmac_ops;
 		nss_top_main.num_nss = 1;
 	}
+#endif
+#if defined(NSS_HAL_EMU_SUPPORT)
+	nss_top_main.hal_ops = &nss_hal_emu_ops;
+	nss_top_main.data_plane_ops = &nss_data_plane_emu_ops;
+	nss_top_main.num_nss = 1;
 #endif
 	if (!nss_top_main.hal_ops) {
 		nss_info_always("No supported HAL compiled on this platform\n");
@@ -873,7 +880,23 @@ static int __init nss_init(void)
 	/*
 	 * Register platform_driver
 	 */
+#if defined(NSS_HAL_EMU_SUPPORT)
+	if (platform_driver_register(&nss_driver)) {
+		return -EFAULT;
+	}
+
+	/*
+	 * There is no device node for the emulated core, create its device here
+	 */
+	if (nss_hal_emu_init()) {
+		platform_driver_unregister(&nss_driver);
+		return -EFAULT;
+	}
+
+	return 0;
+#else
 	return platform_driver_register(&nss_driver);
+#endif
 }
 
 /*
@@ -931,6 +954,9 @@ static void __exit nss_cleanup(void)
 	nss_ppe_free();
 #endif
 
+#if defined(NSS_HAL_EMU_SUPPORT)
+	nss_hal_emu_exit();
+#endif
 	platform_driver_unregister(&nss_driver);
 }
 
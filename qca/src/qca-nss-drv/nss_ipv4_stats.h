@@ -20,6 +20,9 @@
 /*
  * NSS IPV4 statistics APIs
  */
+extern uint64_t nss_ipv4_stats[NSS_IPV4_STATS_MAX];
+extern uint64_t nss_ipv4_exception_stats[NSS_IPV4_EXCEPTION_EVENT_MAX];
+
 extern void nss_ipv4_stats_notify(struct nss_ctx_instance *nss_ctx);
 extern void nss_ipv4_stats_node_sync(struct nss_ctx_instance *nss_ctx, struct nss_ipv4_node_sync *nins);
 extern void nss_ipv4_stats_conn_sync(struct nss_ctx_instance *nss_ctx, struct nss_ipv4_conn_sync *nirs);
@@ -20,6 +20,9 @@
 /*
  * IPV6 statistics APIs
  */
+extern uint64_t nss_ipv6_stats[NSS_IPV6_STATS_MAX];
+extern uint64_t nss_ipv6_exception_stats[NSS_IPV6_EXCEPTION_EVENT_MAX];
+
 extern void nss_ipv6_stats_notify(struct nss_ctx_instance *nss_ctx);
 extern void nss_ipv6_stats_node_sync(struct nss_ctx_instance *nss_ctx, struct nss_ipv6_node_sync *nins);
 extern void nss_ipv6_stats_conn_sync(struct nss_ctx_instance *nss_ctx, struct nss_ipv6_conn_sync *nics);
@@ -727,9 +727,14 @@ bool nss_meminfo_init(struct nss_ctx_instance *nss_ctx)
 
 	/*
 	 * meminfo_start is the label where the start address of meminfo map is stored.
+	 * The emulated firmware image is built in host memory, which cannot be ioremapped.
 	 */
+#if defined(NSS_HAL_EMU_SUPPORT)
+	meminfo_start = nss_hal_emu_meminfo_start(nss_ctx);
+#else
 	meminfo_start = (uint32_t *)ioremap_nocache(nss_ctx->load + NSS_MEMINFO_MAP_START_OFFSET,
 							NSS_MEMINFO_RESERVE_AREA_SIZE);
+#endif
 	if (!meminfo_start) {
 		nss_info_always("%px: cannot remap meminfo start\n", nss_ctx);
 		return false;
@@ -744,7 +749,11 @@ bool nss_meminfo_init(struct nss_ctx_instance *nss_ctx)
 	}
 
 	map = &mem_ctx->meminfo_map;
+#if defined(NSS_HAL_EMU_SUPPORT)
+	map->start = nss_hal_emu_meminfo_map(nss_ctx);
+#else
 	map->start = (uint32_t *)ioremap_cache(meminfo_start[1], NSS_MEMINFO_MAP_SIZE);
+#endif
 	if (!map->start) {
 		nss_info_always("%px: failed to remap meminfo map\n", nss_ctx);
 		return false;
@@ -20,6 +20,8 @@
 /*
  * N2H statistics APIs
  */
+extern uint64_t nss_n2h_stats[NSS_MAX_CORES][NSS_N2H_STATS_MAX];
+
 extern void nss_n2h_stats_notify(struct nss_ctx_instance *nss_ctx);
 extern void nss_n2h_stats_sync(struct nss_ctx_instance *nss_ctx, struct nss_n2h_stats_sync *nnss);
 extern void nss_n2h_stats_dentry_create(void);
@@ -203,8 +203,8 @@ struct nss_profile_sdma_ctrl *nss_profile_dma_get_ctrl(struct nss_ctx_instance *
 		return ctrl;
 	}
 
-	dmac_inv_range(ctrl, &ctrl->cidx);
-	dsb(sy);
+	NSS_CORE_DMA_CACHE_MAINT(ctrl, (void *)&ctrl->cidx - (void *)ctrl, DMA_FROM_DEVICE);
+	NSS_CORE_DSB();
 	return ctrl;
 }
 EXPORT_SYMBOL(nss_profile_dma_get_ctrl);
@@ -14,9 +14,13 @@
  **************************************************************************
  */
 
+#include <linux/vmalloc.h>
 #include "nss_core.h"
 #include "nss_strings.h"
 #include "nss_drv_stats.h"
+#include "nss_ipv4_stats.h"
+#include "nss_ipv6_stats.h"
+#include "nss_n2h_stats.h"
 
 /*
  * Maximum banner length:
@@ -38,6 +42,31 @@
  */
 #define NSS_STATS_NODE_NAME_MAX 24
 
+/*
+ * Size of a binary snapshot section carrying n statistics.
+ */
+#define NSS_STATS_BIN_SECTION_SIZE(n) (sizeof(struct nss_stats_bin_section) + (n) * sizeof(uint64_t))
+
+/*
+ * Largest binary snapshot: every interface with node statistics plus
+ * the IPv4, IPv6 and per-core N2H sections.
+ */
+#define NSS_STATS_BIN_MAX_SIZE (sizeof(struct nss_stats_bin_header) + \
+		NSS_MAX_NET_INTERFACES * NSS_STATS_BIN_SECTION_SIZE(NSS_STATS_NODE_MAX) + \
+		NSS_STATS_BIN_SECTION_SIZE(NSS_IPV4_STATS_MAX) + \
+		NSS_STATS_BIN_SECTION_SIZE(NSS_IPV4_EXCEPTION_EVENT_MAX) + \
+		NSS_STATS_BIN_SECTION_SIZE(NSS_IPV6_STATS_MAX) + \
+		NSS_STATS_BIN_SECTION_SIZE(NSS_IPV6_EXCEPTION_EVENT_MAX) + \
+		NSS_MAX_CORES * NSS_STATS_BIN_SECTION_SIZE(NSS_N2H_STATS_MAX))
+
+/*
+ * Private data of the binary statistics file
+ */
+struct nss_stats_bin_data {
+	size_t len;		/* Length of the current snapshot */
+	uint8_t buf[];		/* Snapshot, rebuilt on every read from offset 0 */
+};
+
 int nonzero_stats_print = 0;
 
 /*
@@ -382,6 +411,136 @@ void nss_stats_create_dentry(char *name, const struct file_operations *ops)
 	}
 }
 
+/*
+ * nss_stats_bin_section()
+ *	Append one section to a binary snapshot.
+ */
+static size_t nss_stats_bin_section(uint8_t *buf, uint16_t type, uint16_t instance,
+					uint64_t *stats_val, uint16_t num_stats)
+{
+	struct nss_stats_bin_section *nsbs = (struct nss_stats_bin_section *)buf;
+
+	nsbs->type = type;
+	nsbs->instance = instance;
+	nsbs->num_stats = num_stats;
+	nsbs->reserved = 0;
+	memcpy(nsbs->stats, stats_val, num_stats * sizeof(uint64_t));
+	return NSS_STATS_BIN_SECTION_SIZE(num_stats);
+}
+
+/*
+ * nss_stats_bin_fill()
+ *	Build a binary snapshot of the node, IPv4, IPv6 and N2H statistics.
+ *
+ * All values are copied under a single hold of the stats lock so the
+ * snapshot is consistent across sections. Interfaces whose node
+ * statistics are all zero are left out.
+ */
+static size_t nss_stats_bin_fill(uint8_t *buf)
+{
+	struct nss_stats_bin_header *nsbh = (struct nss_stats_bin_header *)buf;
+	size_t len = sizeof(*nsbh);
+	uint16_t num_sections = 0;
+	uint32_t if_num;
+	int i, core;
+
+	spin_lock_bh(&nss_top_main.stats_lock);
+	for (if_num = 0; if_num < NSS_MAX_NET_INTERFACES; if_num++) {
+		for (i = 0; i < NSS_STATS_NODE_MAX; i++) {
+			if (nss_top_main.stats_node[if_num][i]) {
+				break;
+			}
+		}
+
+		if (i == NSS_STATS_NODE_MAX) {
+			continue;
+		}
+
+		len += nss_stats_bin_section(buf + len, NSS_STATS_BIN_SECTION_NODE, if_num,
+						nss_top_main.stats_node[if_num], NSS_STATS_NODE_MAX);
+		num_sections++;
+	}
+
+	len += nss_stats_bin_section(buf + len, NSS_STATS_BIN_SECTION_IPV4, 0,
+					nss_ipv4_stats, NSS_IPV4_STATS_MAX);
+	len += nss_stats_bin_section(buf + len, NSS_STATS_BIN_SECTION_IPV4_EXCEPTION, 0,
+					nss_ipv4_exception_stats, NSS_IPV4_EXCEPTION_EVENT_MAX);
+	len += nss_stats_bin_section(buf + len, NSS_STATS_BIN_SECTION_IPV6, 0,
+					nss_ipv6_stats, NSS_IPV6_STATS_MAX);
+	len += nss_stats_bin_section(buf + len, NSS_STATS_BIN_SECTION_IPV6_EXCEPTION, 0,
+					nss_ipv6_exception_stats, NSS_IPV6_EXCEPTION_EVENT_MAX);
+	num_sections += 4;
+
+	for (core = 0; core < nss_top_main.num_nss; core++) {
+		len += nss_stats_bin_section(buf + len, NSS_STATS_BIN_SECTION_N2H, core,
+						nss_n2h_stats[core], NSS_N2H_STATS_MAX);
+		num_sections++;
+	}
+	spin_unlock_bh(&nss_top_main.stats_lock);
+
+	nsbh->magic = NSS_STATS_BIN_MAGIC;
+	nsbh->version = NSS_STATS_BIN_VERSION;
+	nsbh->num_sections = num_sections;
+	nsbh->len = len;
+	nsbh->reserved = 0;
+	return len;
+}
+
+/*
+ * nss_stats_bin_open()
+ *	Opens the binary statistics file.
+ */
+static int nss_stats_bin_open(struct inode *inode, struct file *filp)
+{
+	struct nss_stats_bin_data *data;
+
+	data = vzalloc(sizeof(*data) + NSS_STATS_BIN_MAX_SIZE);
+	if (!data) {
+		return -ENOMEM;
+	}
+
+	filp->private_data = data;
+	return 0;
+}
+
+/*
+ * nss_stats_bin_read()
+ *	Reads the binary statistics snapshot.
+ *
+ * A read from offset 0 takes a fresh snapshot; a buffer of
+ * NSS_STATS_BIN_MAX_SIZE bytes always gets it in one call.
+ */
+static ssize_t nss_stats_bin_read(struct file *filp, char __user *ubuf, size_t sz, loff_t *ppos)
+{
+	struct nss_stats_bin_data *data = filp->private_data;
+
+	if (*ppos == 0) {
+		data->len = nss_stats_bin_fill(data->buf);
+	}
+
+	return simple_read_from_buffer(ubuf, sz, ppos, data->buf, data->len);
+}
+
+/*
+ * nss_stats_bin_release()
+ *	Releases the binary statistics file.
+ */
+static int nss_stats_bin_release(struct inode *inode, struct file *filp)
+{
+	vfree(filp->private_data);
+	return 0;
+}
+
+/*
+ * nss_stats_bin_ops
+ */
+static const struct file_operations nss_stats_bin_ops = {
+	.open = nss_stats_bin_open,
+	.read = nss_stats_bin_read,
+	.llseek = generic_file_llseek,
+	.release = nss_stats_bin_release,
+};
+
 /*
  * TODO: Move the rest of the code to (nss_wt_stats.c, nss_gmac_stats.c) accordingly.
  */
@@ -446,6 +605,11 @@ void nss_stats_init(void)
 	 */
 	nss_stats_create_dentry("gmac", &nss_gmac_stats_ops);
 
+	/*
+	 * Binary snapshot of node, IPv4, IPv6 and N2H stats
+	 */
+	nss_stats_create_dentry("bin", &nss_stats_bin_ops);
+
 	/*
 	 * Per-project stats
 	 */
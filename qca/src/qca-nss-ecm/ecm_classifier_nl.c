@@ -81,6 +81,11 @@
 #define ECM_CLASSIFIER_NL_F_ACCEL_OK	(1 << 1) /* acceleration confirmed */
 #define ECM_CLASSIFIER_NL_F_CLOSED	(1 << 2) /* close event issued */
 
+/*
+ * Maximum number of events coalesced into, or connections dumped in, one genl message
+ */
+#define ECM_CLASSIFIER_NL_EVENTS_MAX 32
+
 /*
  * struct ecm_classifier_nl_instance
  * 	State to allow tracking of dynamic qos for a connection
@@ -132,6 +137,17 @@ static int ecm_classifier_nl_count = 0;					/* Tracks number of instances alloca
  */
 struct ecm_db_listener_instance *ecm_classifier_nl_li = NULL;
 
+/*
+ * Event coalescing, protected by ecm_classifier_nl_lock.
+ * When ecm_classifier_nl_coalesce_ms is zero each event is sent in its own message.
+ */
+static uint32_t ecm_classifier_nl_coalesce_ms = 0;		/* Flush interval of pending events */
+static uint32_t ecm_classifier_nl_event_seq = 0;		/* Sequence number of the next event */
+static struct ecm_cl_nl_genl_attr_event ecm_classifier_nl_events[ECM_CLASSIFIER_NL_EVENTS_MAX];
+static int ecm_classifier_nl_event_count = 0;			/* Number of pending events */
+static uint32_t ecm_classifier_nl_event_first_seq;		/* Sequence number of the first pending event */
+static struct delayed_work ecm_classifier_nl_event_work;	/* Flushes pending events */
+
 /*
  * Generic Netlink family and multicast group names
  */
@@ -157,7 +173,8 @@ static struct genl_family ecm_cl_nl_genl_family = {
  */
 static int
 ecm_classifier_nl_send_genl_msg(enum ECM_CL_NL_GENL_CMD cmd,
-				struct ecm_cl_nl_genl_attr_tuple *tuple)
+				struct ecm_cl_nl_genl_attr_tuple *tuple,
+				uint32_t seq)
 {
 	int ret;
 	int buf_len;
@@ -175,6 +192,7 @@ ecm_classifier_nl_send_genl_msg(enum ECM_CL_NL_GENL_CMD cmd,
 	 * Add the nla_total_size of each attribute we're going to nla_put().
 	 */
 	buf_len += nla_total_size(sizeof(*tuple));
+	buf_len += nla_total_size(sizeof(seq));
 
 	/*
 	 * Lastly we need to add space for the NL message header since
@@ -210,6 +228,13 @@ ecm_classifier_nl_send_genl_msg(enum ECM_CL_NL_GENL_CMD cmd,
 		return ret;
 	}
 
+	ret = nla_put_u32(skb, ECM_CL_NL_GENL_ATTR_SEQ, seq);
+	if (ret != 0) {
+		DEBUG_WARN("failed to put seq into genl msg: %d\n", ret);
+		nlmsg_free(skb);
+		return ret;
+	}
+
 	ret = genlmsg_end(skb, msg_head);
 	if (ret < 0) {
 		DEBUG_WARN("failed to finalize genl msg: %d\n", ret);
@@ -231,6 +256,141 @@ ecm_classifier_nl_send_genl_msg(enum ECM_CL_NL_GENL_CMD cmd,
 	return 0;
 }
 
+/*
+ * ecm_classifier_nl_events_flush()
+ *	Send all pending events in one EVENTS message
+ */
+static void ecm_classifier_nl_events_flush(void)
+{
+	int ret;
+	int i;
+	int count;
+	uint32_t first_seq;
+	void *msg_head;
+	struct sk_buff *skb;
+
+	/*
+	 * Allocate for a full batch up front so the events can be moved
+	 * into the message while holding the lock.
+	 */
+	skb = genlmsg_new(nlmsg_total_size(ecm_cl_nl_genl_family.hdrsize
+					   + nla_total_size(sizeof(uint32_t))
+					   + (ECM_CLASSIFIER_NL_EVENTS_MAX * nla_total_size(sizeof(struct ecm_cl_nl_genl_attr_event)))),
+			  GFP_ATOMIC);
+	if (!skb) {
+		DEBUG_WARN("failed to alloc nlmsg\n");
+		return;
+	}
+
+	msg_head = genlmsg_put(skb, 0, 0, &ecm_cl_nl_genl_family, 0, ECM_CL_NL_GENL_CMD_EVENTS);
+	if (!msg_head) {
+		DEBUG_WARN("failed to add genl headers\n");
+		nlmsg_free(skb);
+		return;
+	}
+
+	spin_lock_bh(&ecm_classifier_nl_lock);
+	count = ecm_classifier_nl_event_count;
+	first_seq = ecm_classifier_nl_event_first_seq;
+	if (!count) {
+		spin_unlock_bh(&ecm_classifier_nl_lock);
+		nlmsg_free(skb);
+		return;
+	}
+
+	/*
+	 * The skb was sized for a full batch so none of these can fail
+	 */
+	ret = nla_put_u32(skb, ECM_CL_NL_GENL_ATTR_SEQ, first_seq);
+	for (i = 0; (ret == 0) && (i < count); i++) {
+		ret = nla_put(skb, ECM_CL_NL_GENL_ATTR_EVENT, sizeof(struct ecm_cl_nl_genl_attr_event), &ecm_classifier_nl_events[i]);
+	}
+	ecm_classifier_nl_event_count = 0;
+	spin_unlock_bh(&ecm_classifier_nl_lock);
+
+	if (ret != 0) {
+		DEBUG_WARN("failed to put events into genl msg: %d\n", ret);
+		nlmsg_free(skb);
+		return;
+	}
+
+	genlmsg_end(skb, msg_head);
+
+	/* genlmsg_multicast frees the skb in both success and error cases */
+	ret = genlmsg_multicast(&ecm_cl_nl_genl_family, skb, 0, 0, GFP_ATOMIC);
+	if (ret != 0) {
+		DEBUG_WARN("genl multicast of events %u..%u failed: %d\n", first_seq, first_seq + count - 1, ret);
+		return;
+	}
+
+	DEBUG_TRACE("sent events %u..%u\n", first_seq, first_seq + count - 1);
+}
+
+/*
+ * ecm_classifier_nl_events_work()
+ *	Flush interval expired
+ */
+static void ecm_classifier_nl_events_work(struct work_struct *work)
+{
+	ecm_classifier_nl_events_flush();
+}
+
+/*
+ * ecm_classifier_nl_event_send()
+ *	Send an ACCEL_OK or CONNECTION_CLOSED event, or queue it when coalescing.
+ *
+ * Once queued the event is considered delivered, failure to send the batch
+ * later shows up to the listener as a gap in the sequence numbers.
+ *
+ * The sequence number is taken under the lock but single messages are sent
+ * after dropping it, so events raised on different CPUs can reach the
+ * listener out of order. The listener orders them by ECM_CL_NL_GENL_ATTR_SEQ.
+ */
+static int ecm_classifier_nl_event_send(enum ECM_CL_NL_GENL_CMD cmd,
+					struct ecm_cl_nl_genl_attr_tuple *tuple)
+{
+	struct ecm_cl_nl_genl_attr_event *event;
+	uint32_t coalesce_ms;
+	uint32_t seq;
+	bool first;
+	bool full;
+
+	spin_lock_bh(&ecm_classifier_nl_lock);
+	seq = ecm_classifier_nl_event_seq++;
+	coalesce_ms = ecm_classifier_nl_coalesce_ms;
+	if (!coalesce_ms) {
+		spin_unlock_bh(&ecm_classifier_nl_lock);
+		return ecm_classifier_nl_send_genl_msg(cmd, tuple, seq);
+	}
+
+	/*
+	 * A full batch is flushed once its last event was queued but the flush
+	 * takes the lock again, until it has done so send the event on its own.
+	 */
+	if (ecm_classifier_nl_event_count >= ECM_CLASSIFIER_NL_EVENTS_MAX) {
+		spin_unlock_bh(&ecm_classifier_nl_lock);
+		return ecm_classifier_nl_send_genl_msg(cmd, tuple, seq);
+	}
+
+	first = (ecm_classifier_nl_event_count == 0);
+	if (first) {
+		ecm_classifier_nl_event_first_seq = seq;
+	}
+	event = &ecm_classifier_nl_events[ecm_classifier_nl_event_count++];
+	event->cmd = (uint8_t)cmd;
+	event->tuple = *tuple;
+	full = (ecm_classifier_nl_event_count == ECM_CLASSIFIER_NL_EVENTS_MAX);
+	spin_unlock_bh(&ecm_classifier_nl_lock);
+
+	if (full) {
+		ecm_classifier_nl_events_flush();
+	} else if (first) {
+		schedule_delayed_work(&ecm_classifier_nl_event_work, msecs_to_jiffies(coalesce_ms));
+	}
+
+	return 0;
+}
+
 /*
  * ecm_cl_nl_genl_attr_tuple_encode()
  *	Helper function to convert connection IP info into a genl_attr_tuple
@@ -351,8 +511,8 @@ static void ecm_classifier_nl_genl_msg_ACCEL_OK(struct ecm_classifier_nl_instanc
 		return;
 	}
 
-	ret = ecm_classifier_nl_send_genl_msg(ECM_CL_NL_GENL_CMD_ACCEL_OK,
-					      &tuple);
+	ret = ecm_classifier_nl_event_send(ECM_CL_NL_GENL_CMD_ACCEL_OK,
+					   &tuple);
 	if (ret != 0) {
 		DEBUG_WARN("failed to send ACCEL_OK: %px, serial %u\n",
 			   cnli, cnli->ci_serial);
@@ -395,7 +555,7 @@ static void ecm_classifier_nl_genl_msg_closed(struct ecm_db_connection_instance
 		return;
 	}
 
-	ecm_classifier_nl_send_genl_msg(ECM_CL_NL_GENL_CMD_CONNECTION_CLOSED, &tuple);
+	ecm_classifier_nl_event_send(ECM_CL_NL_GENL_CMD_CONNECTION_CLOSED, &tuple);
 }
 
 /*
@@ -407,6 +567,128 @@ static int ecm_classifier_nl_genl_msg_DUMP(struct sk_buff *skb,
 	return 0;
 }
 
+/*
+ * ecm_classifier_nl_genl_msg_DUMP_ACCEL_OK()
+ *	Dump the connections that had ACCEL_OK issued and are not yet closed.
+ *
+ * New instances are added at the head of the list so a position in it is not
+ * stable across calls. Each call instead sends the lowest serials not yet
+ * sent, cb->args[0] holds the serial to resume from and cb->args[1] is set
+ * once a message went out, or to 2 once no higher serial can follow. The first message always carries the SEQ, even
+ * when there is nothing to dump.
+ */
+static int ecm_classifier_nl_genl_msg_DUMP_ACCEL_OK(struct sk_buff *skb,
+						    struct netlink_callback *cb)
+{
+	uint32_t serials[ECM_CLASSIFIER_NL_EVENTS_MAX];
+	struct ecm_classifier_nl_instance *cnli;
+	struct ecm_cl_nl_genl_attr_event event;
+	void *msg_head;
+	uint32_t seq;
+	uint32_t next;
+	uint32_t serial;
+	int count = 0;
+	int ret;
+	int i;
+	int j;
+
+	if (cb->args[1] == 2) {
+		return 0;
+	}
+
+	/*
+	 * Collect the serials of the next batch of accelerated connections
+	 */
+	spin_lock_bh(&ecm_classifier_nl_lock);
+	seq = ecm_classifier_nl_event_seq;
+	next = (uint32_t)cb->args[0];
+	for (cnli = ecm_classifier_nl_instances; cnli; cnli = cnli->next) {
+		if ((cnli->flags & (ECM_CLASSIFIER_NL_F_ACCEL_OK | ECM_CLASSIFIER_NL_F_CLOSED)) != ECM_CLASSIFIER_NL_F_ACCEL_OK) {
+			continue;
+		}
+
+		serial = cnli->ci_serial;
+		if (serial < next) {
+			continue;
+		}
+
+		/*
+		 * Keep serials[] sorted, holding the lowest serials seen so far
+		 */
+		if (count == ECM_CLASSIFIER_NL_EVENTS_MAX) {
+			if (serial >= serials[count - 1]) {
+				continue;
+			}
+			count--;
+		}
+		for (j = count; (j > 0) && (serials[j - 1] > serial); j--) {
+			serials[j] = serials[j - 1];
+		}
+		serials[j] = serial;
+		count++;
+	}
+	spin_unlock_bh(&ecm_classifier_nl_lock);
+
+	if (!count && cb->args[1]) {
+		return 0;
+	}
+
+	msg_head = genlmsg_put(skb, NETLINK_CB(cb->skb).portid, cb->nlh->nlmsg_seq,
+			       &ecm_cl_nl_genl_family, NLM_F_MULTI, ECM_CL_NL_GENL_CMD_DUMP);
+	if (!msg_head) {
+		return -EMSGSIZE;
+	}
+
+	ret = nla_put_u32(skb, ECM_CL_NL_GENL_ATTR_SEQ, seq);
+	for (i = 0; (ret == 0) && (i < count); i++) {
+		struct ecm_db_connection_instance *ci;
+		ip_addr_t src_ip;
+		ip_addr_t dst_ip;
+
+		ci = ecm_db_connection_serial_find_and_ref(serials[i]);
+		if (!ci) {
+			continue;
+		}
+
+		ecm_db_connection_address_get(ci, ECM_DB_OBJ_DIR_FROM, src_ip);
+		ecm_db_connection_address_get(ci, ECM_DB_OBJ_DIR_TO, dst_ip);
+		ret = ecm_cl_nl_genl_attr_tuple_encode(&event.tuple,
+						       ecm_db_connection_ip_version_get(ci),
+						       ecm_db_connection_protocol_get(ci),
+						       src_ip,
+						       ecm_db_connection_port_get(ci, ECM_DB_OBJ_DIR_FROM),
+						       dst_ip,
+						       ecm_db_connection_port_get(ci, ECM_DB_OBJ_DIR_TO));
+		ecm_db_connection_deref(ci);
+		if (ret != 0) {
+			ret = 0;
+			continue;
+		}
+
+		event.cmd = ECM_CL_NL_GENL_CMD_ACCEL_OK;
+		ret = nla_put(skb, ECM_CL_NL_GENL_ATTR_EVENT, sizeof(event), &event);
+	}
+
+	if (ret != 0) {
+		DEBUG_WARN("failed to put dump into genl msg: %d\n", ret);
+		genlmsg_cancel(skb, msg_head);
+		return ret;
+	}
+
+	genlmsg_end(skb, msg_head);
+	cb->args[1] = 1;
+	if (count) {
+		/*
+		 * Nothing can follow the highest possible serial
+		 */
+		if (serials[count - 1] == U32_MAX) {
+			cb->args[1] = 2;
+		}
+		cb->args[0] = (long)(serials[count - 1] + 1);
+	}
+	return skb->len;
+}
+
 /*
  * ecm_classifier_nl_genl_msg_ACCEL()
  *	handles a ECM_CL_NL_ACCEL message
@@ -1371,6 +1653,11 @@ ecm_cl_nl_genl_policy[ECM_CL_NL_GENL_ATTR_COUNT] = {
 	[ECM_CL_NL_GENL_ATTR_TUPLE] = {
 		.type = NLA_UNSPEC,
 		.len = sizeof(struct ecm_cl_nl_genl_attr_tuple), },
+	[ECM_CL_NL_GENL_ATTR_SEQ] = {
+		.type = NLA_U32, },
+	[ECM_CL_NL_GENL_ATTR_EVENT] = {
+		.type = NLA_UNSPEC,
+		.len = sizeof(struct ecm_cl_nl_genl_attr_event), },
 };
 
 /*
@@ -1398,6 +1685,20 @@ static struct genl_ops ecm_cl_nl_genl_ops[] = {
 		.doit = NULL,
 		.dumpit = ecm_classifier_nl_genl_msg_DUMP,
 	},
+	{
+		.cmd = ECM_CL_NL_GENL_CMD_EVENTS,
+		.flags = 0,
+		.policy = ecm_cl_nl_genl_policy,
+		.doit = NULL,
+		.dumpit = ecm_classifier_nl_genl_msg_DUMP,
+	},
+	{
+		.cmd = ECM_CL_NL_GENL_CMD_DUMP,
+		.flags = 0,
+		.policy = ecm_cl_nl_genl_policy,
+		.doit = NULL,
+		.dumpit = ecm_classifier_nl_genl_msg_DUMP_ACCEL_OK,
+	},
 };
 
 static int ecm_classifier_nl_register_genl(void)
@@ -1441,6 +1742,15 @@ int ecm_classifier_nl_rules_init(struct dentry *dentry)
 		return -1;
 	}
 
+	if (!debugfs_create_u32("coalesce_ms", S_IRUGO | S_IWUSR, ecm_classifier_nl_dentry,
+					&ecm_classifier_nl_coalesce_ms)) {
+		DEBUG_ERROR("Failed to create ecm nl classifier coalesce_ms file in debugfs\n");
+		debugfs_remove_recursive(ecm_classifier_nl_dentry);
+		return -1;
+	}
+
+	INIT_DELAYED_WORK(&ecm_classifier_nl_event_work, ecm_classifier_nl_events_work);
+
 	result = ecm_classifier_nl_register_genl();
 	if (result) {
 		DEBUG_ERROR("Failed to register genl sockets\n");
@@ -1499,6 +1809,11 @@ void ecm_classifier_nl_rules_exit(void)
 	ecm_classifier_nl_terminate_pending = true;
 	spin_unlock_bh(&ecm_classifier_nl_lock);
 
+	/*
+	 * Drop any events still pending rather than send them while unregistering
+	 */
+	cancel_delayed_work_sync(&ecm_classifier_nl_event_work);
+
 	ecm_classifier_nl_unregister_genl();
 
 	/*
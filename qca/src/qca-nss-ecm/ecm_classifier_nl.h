@@ -42,6 +42,8 @@ enum ECM_CL_NL_GENL_CMD {
 	ECM_CL_NL_GENL_CMD_ACCEL,
 	ECM_CL_NL_GENL_CMD_ACCEL_OK,
 	ECM_CL_NL_GENL_CMD_CONNECTION_CLOSED,
+	ECM_CL_NL_GENL_CMD_EVENTS,		/* coalesced ACCEL_OK / CONNECTION_CLOSED events */
+	ECM_CL_NL_GENL_CMD_DUMP,		/* dump accelerated connections not yet closed */
 	ECM_CL_NL_GENL_CMD_COUNT,
 };
 #define ECM_CL_NL_GENL_CMD_MAX (ECM_CL_NL_GENL_CMD_COUNT - 1)
@@ -49,6 +51,8 @@ enum ECM_CL_NL_GENL_CMD {
 enum ECM_CL_NL_GENL_ATTR {
 	ECM_CL_NL_GENL_ATTR_UNSPEC,
 	ECM_CL_NL_GENL_ATTR_TUPLE,
+	ECM_CL_NL_GENL_ATTR_SEQ,		/* u32, event sequence number, see below */
+	ECM_CL_NL_GENL_ATTR_EVENT,		/* struct ecm_cl_nl_genl_attr_event */
 	ECM_CL_NL_GENL_ATTR_COUNT,
 };
 #define ECM_CL_NL_GENL_ATTR_MAX (ECM_CL_NL_GENL_ATTR_COUNT - 1)
@@ -70,3 +74,15 @@ struct ecm_cl_nl_genl_attr_tuple {
 	uint8_t		dest_mac[ETH_ALEN];
 };
 
+/*
+ * Every ACCEL_OK and CONNECTION_CLOSED event is given the next sequence
+ * number, whether it is sent on its own or coalesced. A message carries the
+ * sequence number of its first event, EVENTS messages carry one EVENT
+ * attribute per event in sequence order. A gap tells the listener events
+ * were lost and it should resynchronise with a DUMP, which carries the
+ * sequence number of the next event at the time of the dump.
+ */
+struct ecm_cl_nl_genl_attr_event {
+	uint8_t		cmd;		/* ECM_CL_NL_GENL_CMD_ACCEL_OK or _CONNECTION_CLOSED */
+	struct ecm_cl_nl_genl_attr_tuple tuple;
+};
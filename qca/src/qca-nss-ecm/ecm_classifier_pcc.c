@@ -103,6 +103,24 @@ struct ecm_classifier_pcc_instance {
 #endif
 };
 
+/*
+ * Bulk and wildcard operations gather up to this many connections and apply
+ * the state change to all of them under one hold of ecm_classifier_pcc_lock.
+ */
+#define ECM_CLASSIFIER_PCC_BATCH_MAX 16
+
+/*
+ * struct ecm_classifier_pcc_batch
+ *	Connections, and their PCC instances, pending a decision
+ */
+struct ecm_classifier_pcc_batch {
+	struct ecm_db_connection_instance *ci[ECM_CLASSIFIER_PCC_BATCH_MAX];
+	struct ecm_classifier_instance *classi[ECM_CLASSIFIER_PCC_BATCH_MAX];
+								/* NULL for ECM_CLASSIFIER_PCC_DECISION_DECEL */
+	int count;
+	int applied;						/* Total number of connections flushed */
+};
+
 static DEFINE_SPINLOCK(ecm_classifier_pcc_lock);		/* Concurrency control SMP access */
 static int ecm_classifier_pcc_count = 0;			/* Tracks number of instances allocated */
 static struct ecm_classifier_pcc_registrant *ecm_classifier_registrant = NULL;
@@ -594,6 +612,294 @@ void ecm_classifier_pcc_deny_accel_v6(uint8_t *src_mac, struct in6_addr *src_ip,
 }
 EXPORT_SYMBOL(ecm_classifier_pcc_deny_accel_v6);
 
+/*
+ * ecm_classifier_pcc_batch_flush()
+ *	Apply the decision to all connections in the batch and release them.
+ */
+static void ecm_classifier_pcc_batch_flush(struct ecm_classifier_pcc_batch *batch, ecm_classifier_pcc_decision_t decision)
+{
+	struct ecm_front_end_connection_instance *feci;
+	struct ecm_classifier_pcc_instance *pcci;
+	int i;
+
+	if (!batch->count) {
+		return;
+	}
+
+	/*
+	 * Set the permitted accel state of every connection in one go.
+	 * NOTE: When we next see activity on these connections they shall be (de)accelerated as per the state.
+	 */
+	if (decision != ECM_CLASSIFIER_PCC_DECISION_DECEL) {
+		spin_lock_bh(&ecm_classifier_pcc_lock);
+		for (i = 0; i < batch->count; i++) {
+			pcci = (struct ecm_classifier_pcc_instance *)batch->classi[i];
+			DEBUG_CHECK_MAGIC(pcci, ECM_CLASSIFIER_PCC_INSTANCE_MAGIC, "%px: magic failed", pcci);
+
+			if (decision == ECM_CLASSIFIER_PCC_DECISION_PERMIT) {
+				pcci->accel_permit_state = ECM_CLASSIFIER_PCC_RESULT_PERMITTED;
+				pcci->process_response.accel_mode = ECM_CLASSIFIER_ACCELERATION_MODE_ACCEL;
+			} else {
+				pcci->accel_permit_state = ECM_CLASSIFIER_PCC_RESULT_DENIED;
+				pcci->process_response.accel_mode = ECM_CLASSIFIER_ACCELERATION_MODE_NO;
+			}
+			pcci->process_response.relevance = ECM_CLASSIFIER_RELEVANCE_YES;
+			pcci->process_response.process_actions = ECM_CLASSIFIER_PROCESS_ACTION_ACCEL_MODE;
+			pcci->reg_calls_from++;
+		}
+		spin_unlock_bh(&ecm_classifier_pcc_lock);
+	}
+
+	for (i = 0; i < batch->count; i++) {
+		struct ecm_db_connection_instance *ci = batch->ci[i];
+
+		if (decision == ECM_CLASSIFIER_PCC_DECISION_DECEL) {
+			ecm_db_connection_make_defunct(ci);
+		} else if (decision == ECM_CLASSIFIER_PCC_DECISION_DENY) {
+			/*
+			 * If the connection is not accelerated anyway this will have no effect
+			 */
+			feci = ecm_db_connection_front_end_get_and_ref(ci);
+			feci->decelerate(feci);
+			feci->deref(feci);
+		}
+
+		if (batch->classi[i]) {
+			batch->classi[i]->deref(batch->classi[i]);
+		}
+		ecm_db_connection_deref(ci);
+	}
+
+	batch->applied += batch->count;
+	batch->count = 0;
+}
+
+/*
+ * ecm_classifier_pcc_batch_add()
+ *	Queue the connection for the decision, the batch takes over the callers reference to it.
+ */
+static void ecm_classifier_pcc_batch_add(struct ecm_classifier_pcc_batch *batch, struct ecm_db_connection_instance *ci,
+					ecm_classifier_pcc_decision_t decision)
+{
+	struct ecm_classifier_instance *classi = NULL;
+
+	if (decision != ECM_CLASSIFIER_PCC_DECISION_DECEL) {
+		classi = ecm_db_connection_assigned_classifier_find_and_ref(ci, ECM_CLASSIFIER_TYPE_PCC);
+		if (!classi) {
+			DEBUG_TRACE("%px: No PCC classi\n", ci);
+			ecm_db_connection_deref(ci);
+			return;
+		}
+	}
+
+	batch->ci[batch->count] = ci;
+	batch->classi[batch->count] = classi;
+	batch->count++;
+	if (batch->count == ECM_CLASSIFIER_PCC_BATCH_MAX) {
+		ecm_classifier_pcc_batch_flush(batch, decision);
+	}
+}
+
+/*
+ * ecm_classifier_pcc_bulk_v4()
+ *	Apply a decision to the connection of each tuple.
+ *
+ * Returns the number of connections the decision was applied to.
+ */
+int ecm_classifier_pcc_bulk_v4(struct ecm_classifier_pcc_tuple_v4 *tuples, int count, ecm_classifier_pcc_decision_t decision)
+{
+	struct ecm_classifier_pcc_batch batch;
+	int i;
+
+	batch.count = 0;
+	batch.applied = 0;
+
+	for (i = 0; i < count; i++) {
+		struct ecm_classifier_pcc_tuple_v4 *t = &tuples[i];
+		struct ecm_db_connection_instance *ci;
+		ip_addr_t ecm_src_ip;
+		ip_addr_t ecm_dest_ip;
+
+		ECM_NIN4_ADDR_TO_IP_ADDR(ecm_src_ip, t->src_ip);
+		ECM_NIN4_ADDR_TO_IP_ADDR(ecm_dest_ip, t->dest_ip);
+
+		ci = ecm_db_connection_find_and_ref(ecm_src_ip, ecm_dest_ip, t->protocol, ntohs(t->src_port), ntohs(t->dest_port));
+		if (!ci) {
+			DEBUG_TRACE("Bulk v4, not found: %d " ECM_IP_ADDR_DOT_FMT ":%d " ECM_IP_ADDR_DOT_FMT ":%d\n",
+					t->protocol,
+					ECM_IP_ADDR_TO_DOT(ecm_src_ip), ntohs(t->src_port),
+					ECM_IP_ADDR_TO_DOT(ecm_dest_ip), ntohs(t->dest_port));
+			continue;
+		}
+
+		ecm_classifier_pcc_batch_add(&batch, ci, decision);
+	}
+	ecm_classifier_pcc_batch_flush(&batch, decision);
+
+	DEBUG_INFO("Bulk v4, decision %d applied to %d of %d tuples\n", decision, batch.applied, count);
+	return batch.applied;
+}
+EXPORT_SYMBOL(ecm_classifier_pcc_bulk_v4);
+
+/*
+ * ecm_classifier_pcc_bulk_v6()
+ *	Apply a decision to the connection of each tuple.
+ *
+ * Returns the number of connections the decision was applied to.
+ *
+ * NOTE: If IPv6 is not supported in ECM this function must still exist as a stub to avoid compilation problems for registrants.
+ */
+int ecm_classifier_pcc_bulk_v6(struct ecm_classifier_pcc_tuple_v6 *tuples, int count, ecm_classifier_pcc_decision_t decision)
+{
+#ifdef ECM_IPV6_ENABLE
+	struct ecm_classifier_pcc_batch batch;
+	int i;
+
+	batch.count = 0;
+	batch.applied = 0;
+
+	for (i = 0; i < count; i++) {
+		struct ecm_classifier_pcc_tuple_v6 *t = &tuples[i];
+		struct ecm_db_connection_instance *ci;
+		struct in6_addr in6;
+		ip_addr_t ecm_src_ip;
+		ip_addr_t ecm_dest_ip;
+
+		in6 = t->src_ip;
+		ECM_NIN6_ADDR_TO_IP_ADDR(ecm_src_ip, in6);
+		in6 = t->dest_ip;
+		ECM_NIN6_ADDR_TO_IP_ADDR(ecm_dest_ip, in6);
+
+		ci = ecm_db_connection_find_and_ref(ecm_src_ip, ecm_dest_ip, t->protocol, ntohs(t->src_port), ntohs(t->dest_port));
+		if (!ci) {
+			DEBUG_TRACE("Bulk v6, not found: %d " ECM_IP_ADDR_OCTAL_FMT ":%d " ECM_IP_ADDR_OCTAL_FMT ":%d\n",
+					t->protocol,
+					ECM_IP_ADDR_TO_OCTAL(ecm_src_ip), ntohs(t->src_port),
+					ECM_IP_ADDR_TO_OCTAL(ecm_dest_ip), ntohs(t->dest_port));
+			continue;
+		}
+
+		ecm_classifier_pcc_batch_add(&batch, ci, decision);
+	}
+	ecm_classifier_pcc_batch_flush(&batch, decision);
+
+	DEBUG_INFO("Bulk v6, decision %d applied to %d of %d tuples\n", decision, batch.applied, count);
+	return batch.applied;
+#else
+	return 0;
+#endif
+}
+EXPORT_SYMBOL(ecm_classifier_pcc_bulk_v6);
+
+/*
+ * ecm_classifier_pcc_match_connection()
+ *	Returns true when the connection satisfies all criteria of the match.
+ *
+ * addr and mask are the match subnet already converted to ECM form.
+ */
+static bool ecm_classifier_pcc_match_connection(struct ecm_classifier_pcc_match *match, ip_addr_t addr, ip_addr_t mask,
+						struct ecm_db_connection_instance *ci)
+{
+	bool mac_found = !(match->flags & ECM_CLASSIFIER_PCC_MATCH_MAC);
+	bool subnet_found = !(match->flags & ECM_CLASSIFIER_PCC_MATCH_SUBNET);
+	bool port_found = !(match->flags & ECM_CLASSIFIER_PCC_MATCH_PORT);
+	ecm_db_obj_dir_t dir;
+
+	if (ecm_db_connection_ip_version_get(ci) != match->ip_version) {
+		return false;
+	}
+
+	if ((match->flags & ECM_CLASSIFIER_PCC_MATCH_PROTOCOL) && (ecm_db_connection_protocol_get(ci) != match->protocol)) {
+		return false;
+	}
+
+	for (dir = ECM_DB_OBJ_DIR_FROM; dir < ECM_DB_OBJ_DIR_MAX; dir++) {
+		if (!mac_found) {
+			uint8_t node_mac[ETH_ALEN];
+
+			ecm_db_connection_node_address_get(ci, dir, node_mac);
+			mac_found = ECM_MAC_ADDR_MATCH(node_mac, match->mac);
+		}
+
+		if (!subnet_found) {
+			ip_addr_t conn_addr;
+
+			ecm_db_connection_address_get(ci, dir, conn_addr);
+			subnet_found = ((conn_addr[0] & mask[0]) == addr[0]) && ((conn_addr[1] & mask[1]) == addr[1])
+					&& ((conn_addr[2] & mask[2]) == addr[2]) && ((conn_addr[3] & mask[3]) == addr[3]);
+		}
+
+		if (!port_found) {
+			int port = ecm_db_connection_port_get(ci, dir);
+
+			port_found = (port >= match->port_min) && (port <= match->port_max);
+		}
+	}
+
+	return mac_found && subnet_found && port_found;
+}
+
+/*
+ * ecm_classifier_pcc_match_apply()
+ *	Apply a decision to all connections selected by the match.
+ *
+ * The connection database is walked once. Returns the number of connections the decision was applied to.
+ */
+int ecm_classifier_pcc_match_apply(struct ecm_classifier_pcc_match *match, ecm_classifier_pcc_decision_t decision)
+{
+	struct ecm_classifier_pcc_batch batch;
+	struct ecm_db_connection_instance *ci;
+	ip_addr_t addr;
+	ip_addr_t mask;
+	int i;
+
+	if (match->ip_version == 4) {
+		ECM_NIN4_ADDR_TO_IP_ADDR(addr, match->addr.v4);
+		ECM_NIN4_ADDR_TO_IP_ADDR(mask, match->mask.v4);
+#ifdef ECM_IPV6_ENABLE
+	} else if (match->ip_version == 6) {
+		struct in6_addr in6;
+
+		in6 = match->addr.v6;
+		ECM_NIN6_ADDR_TO_IP_ADDR(addr, in6);
+		in6 = match->mask.v6;
+		ECM_NIN6_ADDR_TO_IP_ADDR(mask, in6);
+#endif
+	} else {
+		DEBUG_WARN("Match, unsupported IP version %d\n", match->ip_version);
+		return 0;
+	}
+
+	/*
+	 * Pre-mask the subnet so each connection needs one AND per word
+	 */
+	for (i = 0; i < 4; i++) {
+		addr[i] &= mask[i];
+	}
+
+	batch.count = 0;
+	batch.applied = 0;
+
+	ci = ecm_db_connections_get_and_ref_first();
+	while (ci) {
+		struct ecm_db_connection_instance *cin;
+
+		cin = ecm_db_connection_get_and_ref_next(ci);
+		if (ecm_classifier_pcc_match_connection(match, addr, mask, ci)) {
+			DEBUG_TRACE("%px: matched, decision %d\n", ci, decision);
+			ecm_classifier_pcc_batch_add(&batch, ci, decision);
+		} else {
+			ecm_db_connection_deref(ci);
+		}
+		ci = cin;
+	}
+	ecm_classifier_pcc_batch_flush(&batch, decision);
+
+	DEBUG_INFO("Match flags 0x%x, decision %d applied to %d connections\n", match->flags, decision, batch.applied);
+	return batch.applied;
+}
+EXPORT_SYMBOL(ecm_classifier_pcc_match_apply);
+
 /*
  * ecm_classifier_pcc_unregister_force()
  *	Unregister the registrant, if any
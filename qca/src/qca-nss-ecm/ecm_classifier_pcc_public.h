@@ -131,3 +131,73 @@ extern void ecm_classifier_pcc_deny_accel_v6(uint8_t *src_mac, struct in6_addr *
 extern bool ecm_classifier_pcc_decel_v6(uint8_t *src_mac, struct in6_addr *src_ip,
 		 int src_port, uint8_t *dest_mac, struct in6_addr *dest_ip,
 		 int dest_port, int protocol);
+
+/*
+ * Decision applied by the bulk and wildcard APIs below.
+ */
+enum ecm_classifier_pcc_decisions {
+	ECM_CLASSIFIER_PCC_DECISION_PERMIT,		/* As ecm_classifier_pcc_permit_accel_v4/_v6() */
+	ECM_CLASSIFIER_PCC_DECISION_DENY,		/* As ecm_classifier_pcc_deny_accel_v4/_v6() */
+	ECM_CLASSIFIER_PCC_DECISION_DECEL,		/* As ecm_classifier_pcc_decel_v4/_v6() */
+};
+typedef enum ecm_classifier_pcc_decisions ecm_classifier_pcc_decision_t;
+
+/*
+ * Connection tuples for the bulk APIs.
+ * Big endian fields apart from protocol, as the per connection APIs.
+ */
+struct ecm_classifier_pcc_tuple_v4 {
+	__be32 src_ip;
+	__be32 dest_ip;
+	__be16 src_port;
+	__be16 dest_port;
+	int protocol;
+};
+
+struct ecm_classifier_pcc_tuple_v6 {
+	struct in6_addr src_ip;
+	struct in6_addr dest_ip;
+	__be16 src_port;
+	__be16 dest_port;
+	int protocol;
+};
+
+/*
+ * Apply the decision to the connection of each tuple.
+ * Returns the number of connections the decision was applied to.
+ */
+extern int ecm_classifier_pcc_bulk_v4(struct ecm_classifier_pcc_tuple_v4 *tuples, int count, ecm_classifier_pcc_decision_t decision);
+extern int ecm_classifier_pcc_bulk_v6(struct ecm_classifier_pcc_tuple_v6 *tuples, int count, ecm_classifier_pcc_decision_t decision);
+
+/*
+ * Wildcard match flags.
+ * Each selected criteria must hold, and holds when any side of the connection
+ * (including its NAT sides) satisfies it.
+ */
+#define ECM_CLASSIFIER_PCC_MATCH_MAC		0x1	/* A node has the address 'mac' */
+#define ECM_CLASSIFIER_PCC_MATCH_SUBNET		0x2	/* An address is within 'addr' / 'mask' */
+#define ECM_CLASSIFIER_PCC_MATCH_PORT		0x4	/* A port is within 'port_min' .. 'port_max' */
+#define ECM_CLASSIFIER_PCC_MATCH_PROTOCOL	0x8	/* The protocol is 'protocol' */
+
+/*
+ * struct ecm_classifier_pcc_match
+ *	Selects the connections of one IP version for ecm_classifier_pcc_match_apply()
+ */
+struct ecm_classifier_pcc_match {
+	uint32_t flags;				/* ECM_CLASSIFIER_PCC_MATCH_XXX */
+	int ip_version;				/* 4 or 6 */
+	uint8_t mac[ETH_ALEN];
+	union {
+		__be32 v4;
+		struct in6_addr v6;
+	} addr, mask;				/* Big endian, as per ip_version */
+	uint16_t port_min;			/* Host order */
+	uint16_t port_max;			/* Host order */
+	int protocol;
+};
+
+/*
+ * Apply the decision to all connections selected by the match in one pass over the connection database.
+ * Returns the number of connections the decision was applied to.
+ */
+extern int ecm_classifier_pcc_match_apply(struct ecm_classifier_pcc_match *match, ecm_classifier_pcc_decision_t decision);
@@ -191,6 +191,11 @@ static int __init ecm_init(void)
 		goto err_iface;
 	}
 
+	ret = ecm_front_end_setup_init(ecm_dentry);
+	if (0 != ret) {
+		goto err_fe_setup;
+	}
+
 #ifdef ECM_INTERFACE_BOND_ENABLE
 	ret = ecm_front_end_bond_notifier_init(ecm_dentry);
 	if (0 != ret) {
@@ -240,6 +245,8 @@ err_fe_ipv4:
 	ecm_front_end_bond_notifier_exit();
 err_bond:
 #endif
+	ecm_front_end_setup_exit();
+err_fe_setup:
 	ecm_interface_exit();
 err_iface:
 #ifdef ECM_CLASSIFIER_EMESH_ENABLE
@@ -324,6 +331,8 @@ static void __exit ecm_exit(void)
 	DEBUG_INFO("exit bond notifier\n");
 	ecm_front_end_bond_notifier_exit();
 #endif
+	DEBUG_INFO("exit front end setup\n");
+	ecm_front_end_setup_exit();
 	DEBUG_INFO("exit interface\n");
 	ecm_interface_exit();
 
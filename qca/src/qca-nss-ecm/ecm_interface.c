@@ -42,6 +42,7 @@
 #include <linux/kernel.h>
 #include <linux/netlink.h>
 #include <linux/rtnetlink.h>
+#include <linux/jhash.h>
 #include <linux/socket.h>
 #include <linux/wireless.h>
 #include <net/gre.h>
@@ -156,6 +157,36 @@ static DEFINE_SPINLOCK(ecm_interface_lock);			/* Protect against SMP access betw
  */
 static bool ecm_interface_terminate_pending = false;		/* True when the user has signalled we should quit */
 
+/*
+ * Interface heirarchy cache.
+ *	Heirarchies are kept keyed by the egress device the walk starts from and the next hop, the
+ *	gateway or the destination itself when it is on link, so new connections through a known next
+ *	hop skip the walk. An entry is valid for the generation it was built in, which every netdev,
+ *	neighbour and fdb event advances, and for at most ECM_INTERFACE_HEIRARCHY_CACHE_TTL. A timer
+ *	releases the interfaces of entries that are no longer valid.
+ */
+#define ECM_INTERFACE_HEIRARCHY_CACHE_SLOTS 256
+#define ECM_INTERFACE_HEIRARCHY_CACHE_TTL HZ
+
+struct ecm_interface_heirarchy_cache_entry {
+	struct net_device *dev;				/* Egress device the walk started from (not held), NULL when unused */
+	int ifindex;					/* ifindex of dev, guards against the pointer being reused */
+	ip_addr_t addr;					/* Next hop address */
+	int ip_version;					/* IP version of addr */
+	ecm_front_end_connection_ae_interface_number_by_dev_get_method_t ae_get;
+							/* Front end the interfaces were established for */
+	uint32_t generation;				/* Cache generation the heirarchy was built in */
+	unsigned long expires;				/* Jiffies after which the entry is stale */
+	int32_t first;					/* Index of the first interface in interfaces[] */
+	struct ecm_db_iface_instance *interfaces[ECM_DB_IFACE_HEIRARCHY_MAX];
+							/* Referenced interfaces */
+};
+
+static struct ecm_interface_heirarchy_cache_entry ecm_interface_heirarchy_cache[ECM_INTERFACE_HEIRARCHY_CACHE_SLOTS];
+static DEFINE_SPINLOCK(ecm_interface_heirarchy_cache_lock);	/* Protects ecm_interface_heirarchy_cache[] */
+static atomic_t ecm_interface_heirarchy_cache_generation = ATOMIC_INIT(0);
+static struct timer_list ecm_interface_heirarchy_cache_timer;	/* Releases expired entries */
+
 /*
  * Source interface check flag.
  *	If it is enabled, the acceleration engine will check the flow's interface to see
@@ -4605,6 +4636,179 @@ static inline bool ecm_interface_is_tunnel_endpoint(struct sk_buff *skb, struct
 	return false;
 }
 
+/*
+ * ecm_interface_heirarchy_cache_invalidate()
+ *	Make every cached heirarchy stale.
+ */
+static inline void ecm_interface_heirarchy_cache_invalidate(void)
+{
+	atomic_inc(&ecm_interface_heirarchy_cache_generation);
+}
+
+/*
+ * ecm_interface_heirarchy_cache_slot()
+ *	Return the cache slot for a walk from dev to addr.
+ */
+static inline struct ecm_interface_heirarchy_cache_entry *ecm_interface_heirarchy_cache_slot(struct net_device *dev, ip_addr_t addr)
+{
+	uint32_t hash;
+
+	ECM_IP_ADDR_HASH(hash, addr);
+	hash = jhash_2words(hash, dev->ifindex, 0);
+	return &ecm_interface_heirarchy_cache[hash & (ECM_INTERFACE_HEIRARCHY_CACHE_SLOTS - 1)];
+}
+
+/*
+ * ecm_interface_heirarchy_cache_lookup_and_ref()
+ *	Copy a cached heirarchy for a walk from dev to addr into interfaces[], taking a reference on each.
+ *
+ * Returns the index of the first interface, or ECM_DB_IFACE_HEIRARCHY_MAX on a miss.
+ */
+static int32_t ecm_interface_heirarchy_cache_lookup_and_ref(struct ecm_front_end_connection_instance *feci,
+						struct ecm_db_iface_instance *interfaces[],
+						struct net_device *dev, ip_addr_t addr, int ip_version)
+{
+	struct ecm_interface_heirarchy_cache_entry *hce = ecm_interface_heirarchy_cache_slot(dev, addr);
+	int32_t first = ECM_DB_IFACE_HEIRARCHY_MAX;
+	int32_t i;
+
+	spin_lock_bh(&ecm_interface_heirarchy_cache_lock);
+	if ((hce->dev == dev) && (hce->ifindex == dev->ifindex)
+			&& (hce->ip_version == ip_version)
+			&& (hce->ae_get == feci->ae_interface_number_by_dev_get)
+			&& ECM_IP_ADDR_MATCH(hce->addr, addr)
+			&& (hce->generation == atomic_read(&ecm_interface_heirarchy_cache_generation))
+			&& time_before(jiffies, hce->expires)) {
+		first = hce->first;
+		for (i = first; i < ECM_DB_IFACE_HEIRARCHY_MAX; ++i) {
+			ecm_db_iface_ref(hce->interfaces[i]);
+			interfaces[i] = hce->interfaces[i];
+		}
+	}
+	spin_unlock_bh(&ecm_interface_heirarchy_cache_lock);
+
+	return first;
+}
+
+/*
+ * ecm_interface_heirarchy_cache_release()
+ *	Empty a cache slot, moving its interface references into interfaces[].
+ *
+ * Returns the index of the first interface moved. Caller holds the cache lock.
+ */
+static int32_t ecm_interface_heirarchy_cache_release(struct ecm_interface_heirarchy_cache_entry *hce,
+						struct ecm_db_iface_instance *interfaces[])
+{
+	int32_t first = ECM_DB_IFACE_HEIRARCHY_MAX;
+
+	if (hce->dev) {
+		first = hce->first;
+		memcpy(&interfaces[first], &hce->interfaces[first],
+			sizeof(struct ecm_db_iface_instance *) * (ECM_DB_IFACE_HEIRARCHY_MAX - first));
+		hce->dev = NULL;
+	}
+
+	return first;
+}
+
+/*
+ * ecm_interface_heirarchy_cache_insert()
+ *	Cache a heirarchy constructed for a walk from dev to addr.
+ *
+ * generation is the cache generation read before the walk started; a heirarchy built while an
+ * event was being processed is not cached.
+ */
+static void ecm_interface_heirarchy_cache_insert(struct ecm_front_end_connection_instance *feci,
+						struct ecm_db_iface_instance *interfaces[], int32_t first,
+						struct net_device *dev, int ifindex, ip_addr_t addr, int ip_version,
+						uint32_t generation)
+{
+	struct ecm_interface_heirarchy_cache_entry *hce = ecm_interface_heirarchy_cache_slot(dev, addr);
+	struct ecm_db_iface_instance *old[ECM_DB_IFACE_HEIRARCHY_MAX];
+	int32_t old_first;
+	int32_t i;
+
+	spin_lock_bh(&ecm_interface_heirarchy_cache_lock);
+	if (generation != atomic_read(&ecm_interface_heirarchy_cache_generation)) {
+		spin_unlock_bh(&ecm_interface_heirarchy_cache_lock);
+		return;
+	}
+
+	old_first = ecm_interface_heirarchy_cache_release(hce, old);
+
+	hce->dev = dev;
+	hce->ifindex = ifindex;
+	ECM_IP_ADDR_COPY(hce->addr, addr);
+	hce->ip_version = ip_version;
+	hce->ae_get = feci->ae_interface_number_by_dev_get;
+	hce->generation = generation;
+	hce->expires = jiffies + ECM_INTERFACE_HEIRARCHY_CACHE_TTL;
+	hce->first = first;
+	for (i = first; i < ECM_DB_IFACE_HEIRARCHY_MAX; ++i) {
+		ecm_db_iface_ref(interfaces[i]);
+		hce->interfaces[i] = interfaces[i];
+	}
+	spin_unlock_bh(&ecm_interface_heirarchy_cache_lock);
+
+	/*
+	 * Release the replaced heirarchy outside of the cache lock
+	 */
+	ecm_db_connection_interfaces_deref(old, old_first);
+}
+
+/*
+ * ecm_interface_heirarchy_cache_flush()
+ *	Release every cached heirarchy.
+ */
+static void ecm_interface_heirarchy_cache_flush(void)
+{
+	struct ecm_db_iface_instance *old[ECM_DB_IFACE_HEIRARCHY_MAX];
+	int32_t old_first;
+	int i;
+
+	ecm_interface_heirarchy_cache_invalidate();
+
+	for (i = 0; i < ECM_INTERFACE_HEIRARCHY_CACHE_SLOTS; ++i) {
+		spin_lock_bh(&ecm_interface_heirarchy_cache_lock);
+		old_first = ecm_interface_heirarchy_cache_release(&ecm_interface_heirarchy_cache[i], old);
+		spin_unlock_bh(&ecm_interface_heirarchy_cache_lock);
+
+		ecm_db_connection_interfaces_deref(old, old_first);
+	}
+}
+
+/*
+ * ecm_interface_heirarchy_cache_timer_callback()
+ *	Release the cached heirarchies that have expired or were built in an older generation.
+ */
+#if (LINUX_VERSION_CODE < KERNEL_VERSION(4, 15, 0))
+static void ecm_interface_heirarchy_cache_timer_callback(unsigned long data)
+#else
+static void ecm_interface_heirarchy_cache_timer_callback(struct timer_list *arg)
+#endif
+{
+	struct ecm_interface_heirarchy_cache_entry *hce;
+	struct ecm_db_iface_instance *old[ECM_DB_IFACE_HEIRARCHY_MAX];
+	int32_t old_first;
+	int i;
+
+	for (i = 0; i < ECM_INTERFACE_HEIRARCHY_CACHE_SLOTS; ++i) {
+		hce = &ecm_interface_heirarchy_cache[i];
+		old_first = ECM_DB_IFACE_HEIRARCHY_MAX;
+
+		spin_lock_bh(&ecm_interface_heirarchy_cache_lock);
+		if (hce->dev && ((hce->generation != atomic_read(&ecm_interface_heirarchy_cache_generation))
+				|| !time_before(jiffies, hce->expires))) {
+			old_first = ecm_interface_heirarchy_cache_release(hce, old);
+		}
+		spin_unlock_bh(&ecm_interface_heirarchy_cache_lock);
+
+		ecm_db_connection_interfaces_deref(old, old_first);
+	}
+
+	mod_timer(&ecm_interface_heirarchy_cache_timer, jiffies + ECM_INTERFACE_HEIRARCHY_CACHE_TTL);
+}
+
 /*
  * ecm_interface_heirarchy_construct()
  *	Construct an interface heirarchy.
@@ -4630,6 +4834,9 @@ static inline bool ecm_interface_is_tunnel_endpoint(struct sk_buff *skb, struct
  *
  * IMPORTANT: This function will return any known interfaces in the database, when interfaces do not exist in the database
  * they will be created and added automatically to the database.
+ *
+ * Heirarchies made only of ethernet, VLAN, MAC-VLAN, bridge and PPPoE devices do not depend on the flow and are
+ * cached per (egress device, next hop address); see ecm_interface_heirarchy_cache_lookup_and_ref().
  */
 int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instance *feci,
 						struct ecm_db_iface_instance *interfaces[],
@@ -4661,6 +4868,11 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 	uint8_t next_dest_node_addr[ETH_ALEN] = {0};
 	struct net_device *bridge;
 	struct net_device *top_dev = NULL;
+	struct net_device *walk_dev;
+	int walk_ifindex;
+	ip_addr_t next_hop_addr;
+	uint32_t cache_generation;
+	bool cacheable = true;
 	uint32_t serial = ecm_db_connection_serial_get(feci->ci);
 
 	/*
@@ -4910,6 +5122,25 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 		dev_put(bridge);
 	}
 
+	/*
+	 * A walk from this device to the next hop may already be known.
+	 * The next hop is the gateway of a routed destination, otherwise the destination itself.
+	 * The generation is read first so that a heirarchy built across an event is not cached.
+	 */
+	if (!is_routed || from_local_addr || !ecm_interface_find_gateway(dest_addr, next_hop_addr)) {
+		ECM_IP_ADDR_COPY(next_hop_addr, dest_addr);
+	}
+	walk_dev = dest_dev;
+	walk_ifindex = dest_dev->ifindex;
+	cache_generation = atomic_read(&ecm_interface_heirarchy_cache_generation);
+	current_interface_index = ecm_interface_heirarchy_cache_lookup_and_ref(feci, interfaces, dest_dev, next_hop_addr, ip_version);
+	if (current_interface_index != ECM_DB_IFACE_HEIRARCHY_MAX) {
+		DEBUG_INFO("%px: Cached interface heirarchy for %s with first interface @: %d\n", feci, dest_dev_name, current_interface_index);
+		dev_put(src_dev);
+		dev_put(dest_dev);
+		return current_interface_index;
+	}
+
 	next_dest_addr_valid = true;
 	ECM_IP_ADDR_COPY(next_dest_addr, dest_addr);
 
@@ -4922,6 +5153,8 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 	while (current_interface_index > 0) {
 		struct ecm_db_iface_instance *ii;
 		struct net_device *next_dev;
+		bool step_cacheable = false;
+
 		/*
 		 * Get the ecm db interface instance for the device at hand
 		 */
@@ -4986,6 +5219,7 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 					if (current_interface_index == (ECM_DB_IFACE_HEIRARCHY_MAX - 1)) {
 						top_dev = dest_dev;
 					}
+					step_cacheable = true;
 					break;
 				}
 #endif
@@ -5011,6 +5245,7 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 						if (current_interface_index == (ECM_DB_IFACE_HEIRARCHY_MAX - 1)) {
 							top_dev = dest_dev;
 						}
+						step_cacheable = true;
 						break;
 					}
 
@@ -5029,6 +5264,10 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 					 */
 					uint8_t mac_addr[ETH_ALEN];
 
+					/*
+					 * The port depends on the flow only when the source address has to be used for the lookup
+					 */
+					step_cacheable = true;
 					if (next_dest_node_addr_valid) {
 						memcpy(mac_addr, next_dest_node_addr, ETH_ALEN);
 					} else if (!next_dest_addr_valid) {
@@ -5057,6 +5296,7 @@ int32_t ecm_interface_heirarchy_construct(struct ecm_front_end_connection_instan
 						tmp_dev = ecm_interface_dev_find_by_local_addr(dest_addr);
 						if (tmp_dev) {
 							ECM_IP_ADDR_COPY(look_up_addr, src_addr);
+							step_cacheable = false;
 							dev_put(tmp_dev);
 						}
 
@@ -5275,8 +5515,15 @@ lag_success:
 				/*
 				 * ETHERNET!
 				 * Just plain ethernet it seems.
+				 * VxLAN devices are established from the skb's addressing so are not cached.
 				 */
 				DEBUG_TRACE("%px: Net device: %px is ETHERNET\n", feci, dest_dev);
+				step_cacheable = true;
+#ifdef ECM_INTERFACE_VXLAN_ENABLE
+				if (netif_is_vxlan(dest_dev)) {
+					step_cacheable = false;
+				}
+#endif
 				break;
 			}
 
@@ -5448,6 +5695,7 @@ lag_success:
 				next_dest_addr_valid = false;
 				next_dest_node_addr_valid = true;
 				memcpy(next_dest_node_addr, addressing.pa.remote, ETH_ALEN);
+				step_cacheable = true;
 
 				/*
 				 * Release the channel.  Note that next_dev is still (correctly) held.
@@ -5468,6 +5716,8 @@ lag_success:
 #endif
 		} while (false);
 
+		cacheable = cacheable && step_cacheable;
+
 		/*
 		 * No longer need dest_dev as it may become next_dev
 		 */
@@ -5487,6 +5737,12 @@ lag_success:
 			}
 #endif
 
+			if (cacheable) {
+				ecm_interface_heirarchy_cache_insert(feci, interfaces, current_interface_index,
+									walk_dev, walk_ifindex, next_hop_addr, ip_version,
+									cache_generation);
+			}
+
 			/*
 			 * Release src_dev now
 			 */
@@ -6758,6 +7014,8 @@ void ecm_interface_dev_defunct_connections(struct net_device *dev)
 
 	DEBUG_INFO("defunct connections for: %px (%s)\n", dev, dev->name);
 
+	ecm_interface_heirarchy_cache_invalidate();
+
 	/*
 	 * Filter interface instances matching dev and defunct connections
 	 */
@@ -6843,7 +7101,17 @@ static int ecm_interface_netdev_notifier_callback(struct notifier_block *this, u
 
 	DEBUG_INFO("Net device notifier for: %px, name: %s, event: %lx\n", dev, dev->name, event);
 
+	/*
+	 * Any change to a device may change the heirarchies it is part of
+	 */
+	ecm_interface_heirarchy_cache_invalidate();
+
 	switch (event) {
+	case NETDEV_UNREGISTER:
+		DEBUG_INFO("Net device: %px, UNREGISTER\n", dev);
+		ecm_interface_heirarchy_cache_flush();
+		break;
+
 	case NETDEV_DOWN:
 		DEBUG_INFO("Net device: %px, DOWN\n", dev);
 		if (netif_is_bond_slave(dev)) {
@@ -6897,6 +7165,11 @@ void ecm_interface_node_connections_defunct(uint8_t *mac, int ip_version)
 		return;
 	}
 
+	/*
+	 * The node may now be reached through a different port
+	 */
+	ecm_interface_heirarchy_cache_invalidate();
+
 	/*
 	 * Disable frontend processing until defunct function call is completed.
 	 */
@@ -8232,6 +8505,19 @@ int ecm_interface_init(void)
 #endif
 	ecm_interface_wifi_event_start();
 
+	/*
+	 * Periodically release expired heirarchy cache entries
+	 */
+#if (LINUX_VERSION_CODE < KERNEL_VERSION(4, 15, 0))
+	init_timer(&ecm_interface_heirarchy_cache_timer);
+	ecm_interface_heirarchy_cache_timer.function = ecm_interface_heirarchy_cache_timer_callback;
+	ecm_interface_heirarchy_cache_timer.data = 0;
+#else
+	timer_setup(&ecm_interface_heirarchy_cache_timer, ecm_interface_heirarchy_cache_timer_callback, 0);
+#endif
+	ecm_interface_heirarchy_cache_timer.expires = jiffies + ECM_INTERFACE_HEIRARCHY_CACHE_TTL;
+	add_timer(&ecm_interface_heirarchy_cache_timer);
+
 	return 0;
 }
 EXPORT_SYMBOL(ecm_interface_init);
@@ -8264,6 +8550,12 @@ void ecm_interface_exit(void)
 #ifdef ECM_INTERFACE_OVS_BRIDGE_ENABLE
 	ovsmgr_notifier_unregister(&ecm_interface_ovs_notifier);
 #endif
+
+	/*
+	 * Release the interfaces held by the heirarchy cache
+	 */
+	del_timer_sync(&ecm_interface_heirarchy_cache_timer);
+	ecm_interface_heirarchy_cache_flush();
 	/*
 	 * Unregister sysctl table.
 	 */
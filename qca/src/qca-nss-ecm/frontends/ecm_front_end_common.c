@@ -21,6 +21,7 @@
 #include <linux/inet.h>
 #include <linux/etherdevice.h>
 #include <linux/inetdevice.h>
+#include <linux/workqueue.h>
 #include <net/netfilter/nf_conntrack.h>
 #ifdef ECM_CLASSIFIER_DSCP_ENABLE
 #include <linux/netfilter/xt_dscp.h>
@@ -337,3 +338,318 @@ void ecm_front_end_fill_ovs_params(struct ecm_front_end_ovs_params ovs_params[],
 	}
 }
 
+
+/*
+ * Deferred connection setup.
+ *
+ * When enabled, the post routing hooks hand the first packets of a new
+ * conntrack connection to a per-CPU queue rather than establishing the ECM
+ * connection inline. The packet itself continues on the slow path, a clone
+ * of it is processed later by a work item bound to the same CPU.
+ * It stays disabled by default until its effect on the connection setup
+ * rate has been measured on target hardware.
+ */
+#define ECM_FRONT_END_SETUP_BATCH 32			/* Entries processed per run of the work item */
+
+/*
+ * struct ecm_front_end_setup_entry
+ *	A packet pending connection setup
+ */
+struct ecm_front_end_setup_entry {
+	struct list_head list;
+	ecm_front_end_setup_method_t setup;		/* Front end processing of the packet */
+	struct sk_buff *skb;				/* Clone of the packet */
+	struct net_device *in_dev;			/* Held */
+	struct net_device *out_dev;			/* Held */
+	bool can_accel;
+};
+
+/*
+ * struct ecm_front_end_setup_cpu
+ *	Per-CPU queue of packets pending connection setup
+ */
+struct ecm_front_end_setup_cpu {
+	spinlock_t lock;				/* Protects the entries and stats */
+	struct list_head entries;
+	int count;					/* Number of queued entries */
+	int cpu;					/* CPU the work is queued on */
+	struct work_struct work;
+	uint64_t deferred;				/* Entries queued */
+	uint64_t processed;				/* Entries processed by the work */
+	uint64_t overflows;				/* Packets processed inline as the queue was full */
+};
+
+static DEFINE_PER_CPU(struct ecm_front_end_setup_cpu, ecm_front_end_setup_cpus);
+static uint32_t ecm_front_end_setup_enabled = 0;	/* Defer connection setup when non-zero */
+static uint32_t ecm_front_end_setup_queue_max = 1024;	/* Per-CPU queue limit */
+static struct dentry *ecm_front_end_setup_dentry;
+
+/*
+ * ecm_front_end_setup_entry_free()
+ *	Release an entry and everything it holds
+ */
+static void ecm_front_end_setup_entry_free(struct ecm_front_end_setup_entry *se)
+{
+	dev_put(se->in_dev);
+	dev_put(se->out_dev);
+	consume_skb(se->skb);
+	kfree(se);
+}
+
+/*
+ * ecm_front_end_setup_work()
+ *	Establish the connections of a bounded batch of queued packets
+ */
+static void ecm_front_end_setup_work(struct work_struct *work)
+{
+	struct ecm_front_end_setup_cpu *sc = container_of(work, struct ecm_front_end_setup_cpu, work);
+	struct ecm_front_end_setup_entry *se;
+	struct ecm_front_end_setup_entry *tmp;
+	LIST_HEAD(batch);
+	bool more;
+	int n = 0;
+
+	spin_lock_bh(&sc->lock);
+	while (!list_empty(&sc->entries) && (n < ECM_FRONT_END_SETUP_BATCH)) {
+		list_move_tail(sc->entries.next, &batch);
+		n++;
+	}
+	sc->count -= n;
+	more = !list_empty(&sc->entries);
+	spin_unlock_bh(&sc->lock);
+
+	list_for_each_entry_safe(se, tmp, &batch, list) {
+		/*
+		 * The front ends expect to be called from the netfilter hook,
+		 * i.e. with bottom halves disabled and under RCU.
+		 */
+		local_bh_disable();
+		rcu_read_lock();
+		se->setup(se->out_dev, se->in_dev, se->can_accel, se->skb);
+		rcu_read_unlock();
+		local_bh_enable();
+
+		ecm_front_end_setup_entry_free(se);
+	}
+
+	spin_lock_bh(&sc->lock);
+	sc->processed += n;
+	spin_unlock_bh(&sc->lock);
+
+	/*
+	 * Give way to other work before the next batch
+	 */
+	if (more) {
+		queue_work_on(sc->cpu, system_wq, &sc->work);
+	}
+}
+
+/*
+ * ecm_front_end_setup_defer()
+ *	Queue the packet for connection setup on this CPU.
+ *
+ * Returns true when queued, the caller should then accept the packet without processing it.
+ * Returns false when the packet should be processed inline as usual.
+ */
+bool ecm_front_end_setup_defer(ecm_front_end_setup_method_t setup, struct net_device *out_dev,
+				struct net_device *in_dev, bool can_accel, struct sk_buff *skb)
+{
+	struct ecm_front_end_setup_cpu *sc;
+	struct ecm_front_end_setup_entry *se;
+	enum ip_conntrack_info ctinfo;
+
+	if (!ecm_front_end_setup_enabled) {
+		return false;
+	}
+
+	/*
+	 * Only packets of connections conntrack has just seen are deferred,
+	 * anything later most likely has its ECM connection already.
+	 */
+	if (!nf_ct_get(skb, &ctinfo) || (ctinfo != IP_CT_NEW)) {
+		return false;
+	}
+
+	se = (struct ecm_front_end_setup_entry *)kmalloc(sizeof(struct ecm_front_end_setup_entry), GFP_ATOMIC | __GFP_NOWARN);
+	if (!se) {
+		return false;
+	}
+
+	se->skb = skb_clone(skb, GFP_ATOMIC);
+	if (!se->skb) {
+		kfree(se);
+		return false;
+	}
+
+	/*
+	 * The clone may carry a noref dst that is only valid within the caller's
+	 * RCU section, take a reference as the work runs well after it.
+	 */
+	skb_dst_force(se->skb);
+	if (!skb_dst(se->skb)) {
+		consume_skb(se->skb);
+		kfree(se);
+		return false;
+	}
+	se->setup = setup;
+	se->in_dev = in_dev;
+	se->out_dev = out_dev;
+	se->can_accel = can_accel;
+
+	sc = get_cpu_ptr(&ecm_front_end_setup_cpus);
+	spin_lock_bh(&sc->lock);
+	if (sc->count >= ecm_front_end_setup_queue_max) {
+		sc->overflows++;
+		spin_unlock_bh(&sc->lock);
+		put_cpu_ptr(&ecm_front_end_setup_cpus);
+		DEBUG_TRACE("%px: setup queue full, processing inline\n", skb);
+		consume_skb(se->skb);
+		kfree(se);
+		return false;
+	}
+
+	dev_hold(in_dev);
+	dev_hold(out_dev);
+	list_add_tail(&se->list, &sc->entries);
+	sc->count++;
+	sc->deferred++;
+	spin_unlock_bh(&sc->lock);
+
+	queue_work_on(sc->cpu, system_wq, &sc->work);
+	put_cpu_ptr(&ecm_front_end_setup_cpus);
+
+	DEBUG_TRACE("%px: connection setup deferred\n", skb);
+	return true;
+}
+
+/*
+ * ecm_front_end_setup_drain()
+ *	Stop the work on all CPUs and drop the queued packets.
+ *
+ * Called by a front end once its hooks are unregistered.
+ */
+void ecm_front_end_setup_drain(void)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		struct ecm_front_end_setup_cpu *sc = per_cpu_ptr(&ecm_front_end_setup_cpus, cpu);
+		struct ecm_front_end_setup_entry *se;
+		struct ecm_front_end_setup_entry *tmp;
+		LIST_HEAD(drop);
+
+		cancel_work_sync(&sc->work);
+
+		spin_lock_bh(&sc->lock);
+		list_splice_init(&sc->entries, &drop);
+		sc->count = 0;
+		spin_unlock_bh(&sc->lock);
+
+		list_for_each_entry_safe(se, tmp, &drop, list) {
+			ecm_front_end_setup_entry_free(se);
+		}
+	}
+}
+
+/*
+ * ecm_front_end_setup_stats_read()
+ *	Per-CPU counters of the deferred setup
+ */
+static ssize_t ecm_front_end_setup_stats_read(struct file *file, char __user *user_buf,
+						size_t sz, loff_t *ppos)
+{
+	char *buf;
+	int len = 0;
+	int cpu;
+	int ret;
+
+	buf = kmalloc(PAGE_SIZE, GFP_KERNEL);
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	for_each_online_cpu(cpu) {
+		struct ecm_front_end_setup_cpu *sc = per_cpu_ptr(&ecm_front_end_setup_cpus, cpu);
+		uint64_t deferred, processed, overflows;
+		int count;
+
+		spin_lock_bh(&sc->lock);
+		count = sc->count;
+		deferred = sc->deferred;
+		processed = sc->processed;
+		overflows = sc->overflows;
+		spin_unlock_bh(&sc->lock);
+
+		len += scnprintf(buf + len, PAGE_SIZE - len, "cpu=%d\tqueued=%d\tdeferred=%llu\tprocessed=%llu\toverflows=%llu\n",
+				cpu, count, deferred, processed, overflows);
+	}
+
+	ret = simple_read_from_buffer(user_buf, sz, ppos, buf, len);
+	kfree(buf);
+	return ret;
+}
+
+/*
+ * File operations for the deferred setup stats.
+ */
+static struct file_operations ecm_front_end_setup_stats_fops = {
+	.read = ecm_front_end_setup_stats_read,
+};
+
+/*
+ * ecm_front_end_setup_init()
+ */
+int ecm_front_end_setup_init(struct dentry *dentry)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		struct ecm_front_end_setup_cpu *sc = per_cpu_ptr(&ecm_front_end_setup_cpus, cpu);
+
+		spin_lock_init(&sc->lock);
+		INIT_LIST_HEAD(&sc->entries);
+		INIT_WORK(&sc->work, ecm_front_end_setup_work);
+		sc->cpu = cpu;
+	}
+
+	ecm_front_end_setup_dentry = debugfs_create_dir("front_end_setup", dentry);
+	if (!ecm_front_end_setup_dentry) {
+		DEBUG_ERROR("Failed to create front end setup directory in debugfs\n");
+		return -1;
+	}
+
+	if (!debugfs_create_u32("enabled", S_IRUGO | S_IWUSR, ecm_front_end_setup_dentry,
+				&ecm_front_end_setup_enabled)) {
+		DEBUG_ERROR("Failed to create front end setup enabled file in debugfs\n");
+		debugfs_remove_recursive(ecm_front_end_setup_dentry);
+		return -1;
+	}
+
+	if (!debugfs_create_u32("queue_max", S_IRUGO | S_IWUSR, ecm_front_end_setup_dentry,
+				&ecm_front_end_setup_queue_max)) {
+		DEBUG_ERROR("Failed to create front end setup queue_max file in debugfs\n");
+		debugfs_remove_recursive(ecm_front_end_setup_dentry);
+		return -1;
+	}
+
+	if (!debugfs_create_file("stats", S_IRUGO, ecm_front_end_setup_dentry,
+				NULL, &ecm_front_end_setup_stats_fops)) {
+		DEBUG_ERROR("Failed to create front end setup stats file in debugfs\n");
+		debugfs_remove_recursive(ecm_front_end_setup_dentry);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * ecm_front_end_setup_exit()
+ */
+void ecm_front_end_setup_exit(void)
+{
+	ecm_front_end_setup_drain();
+
+	if (ecm_front_end_setup_dentry) {
+		debugfs_remove_recursive(ecm_front_end_setup_dentry);
+	}
+}
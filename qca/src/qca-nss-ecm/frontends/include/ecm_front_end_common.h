@@ -296,6 +296,19 @@ static inline bool ecm_front_end_destroy_failure_handle(struct ecm_front_end_con
 	return false;
 }
 
+/*
+ * Front end processing of a packet whose connection setup was deferred,
+ * as called from its post routing hook.
+ */
+typedef unsigned int (*ecm_front_end_setup_method_t)(struct net_device *out_dev, struct net_device *in_dev,
+						      bool can_accel, struct sk_buff *skb);
+
+extern bool ecm_front_end_setup_defer(ecm_front_end_setup_method_t setup, struct net_device *out_dev,
+				      struct net_device *in_dev, bool can_accel, struct sk_buff *skb);
+extern void ecm_front_end_setup_drain(void);
+extern int ecm_front_end_setup_init(struct dentry *dentry);
+extern void ecm_front_end_setup_exit(void);
+
 extern void ecm_front_end_bond_notifier_stop(int num);
 extern int ecm_front_end_bond_notifier_init(struct dentry *dentry);
 extern void ecm_front_end_bond_notifier_exit(void);
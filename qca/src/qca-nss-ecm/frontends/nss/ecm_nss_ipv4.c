@@ -1590,6 +1590,28 @@ vxlan_done:
 #endif
 }
 
+/*
+ * ecm_nss_ipv4_setup_process()
+ *	Process a packet whose connection setup was deferred by the post routing hook.
+ */
+static unsigned int ecm_nss_ipv4_setup_process(struct net_device *out, struct net_device *in,
+						bool can_accel, struct sk_buff *skb)
+{
+	/*
+	 * The front end may have stopped since the packet was queued
+	 */
+	spin_lock_bh(&ecm_nss_ipv4_lock);
+	if (unlikely(ecm_front_end_ipv4_stopped)) {
+		spin_unlock_bh(&ecm_nss_ipv4_lock);
+		DEBUG_TRACE("Front end stopped\n");
+		return NF_ACCEPT;
+	}
+	spin_unlock_bh(&ecm_nss_ipv4_lock);
+
+	return ecm_nss_ipv4_ip_process(out, in, NULL, NULL,
+							can_accel, true, false, skb, 0);
+}
+
 /*
  * ecm_nss_ipv4_post_routing_hook()
  *	Called for IP packets that are going out to interfaces after IP routing stage.
@@ -1670,6 +1692,14 @@ static unsigned int ecm_nss_ipv4_post_routing_hook(void *priv,
 	}
 #endif
 
+	/*
+	 * New connections may be set up off the packet path
+	 */
+	if (ecm_front_end_setup_defer(ecm_nss_ipv4_setup_process, (struct net_device *)out, in, can_accel, skb)) {
+		dev_put(in);
+		return NF_ACCEPT;
+	}
+
 	DEBUG_TRACE("Post routing process skb %px, out: %px (%s), in: %px (%s)\n", skb, out, out->name, in, in->name);
 	result = ecm_nss_ipv4_ip_process((struct net_device *)out, in, NULL, NULL,
 							can_accel, true, false, skb, 0);
@@ -2968,6 +2998,11 @@ void ecm_nss_ipv4_exit(void)
 	nf_unregister_net_hooks(&init_net, ecm_nss_ipv4_netfilter_hooks,
 				ARRAY_SIZE(ecm_nss_ipv4_netfilter_hooks));
 #endif
+
+	/*
+	 * Drop connection setups still queued by the post routing hook
+	 */
+	ecm_front_end_setup_drain();
 	/*
 	 * Unregister from the Linux NSS Network driver
 	 */
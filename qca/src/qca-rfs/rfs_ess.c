@@ -37,6 +37,7 @@
 #include "rfs_nbr.h"
 #include "rfs_cm.h"
 #include "rfs_dev.h"
+#include "rfs_soft.h"
 
 /*
  * RSS key base address
@@ -72,6 +73,10 @@ struct rfs_ess {
         struct notifier_block dev_notifier;
         struct notifier_block inet_notifier;
 	int    is_running;
+	/*
+	 * No ESS switch, rules are applied by the software backend
+	 */
+	int    soft;
 };
 
 static struct rfs_ess __ess = {
@@ -146,6 +151,13 @@ uint32_t rfs_ess_get_rxhash(__be32 sip, __be32 dip,
 	char buf[64];
 	char *pos;
 
+	/*
+	 * Without ESS the flow hash comes from the NIC or the stack and
+	 * can't be computed here, the software backend learns it per packet.
+	 */
+	if (__ess.soft)
+		return 0;
+
 	pos = buf;
 	memcpy(pos, &sip, sizeof(sip));
 	pos += sizeof(sip);
@@ -704,6 +716,8 @@ int rfs_ess_update_mac_rule(struct rfs_rule_entry *re, uint16_t cpu)
 	uint32_t nvif;
 	uint32_t ifvid[MAX_VLAN_PORT];
 
+	if (__ess.soft)
+		return rfs_soft_update_mac_rule(re, cpu);
 
 	/*
 	 * Clear the old entries when CPU is RPS_NO_CPU
@@ -786,6 +800,9 @@ int rfs_ess_update_ip_rule(struct rfs_rule_entry *re, uint16_t cpu)
 	uint8_t  ifmac[MAX_VLAN_PORT * ETH_ALEN];
 	int ret;
 
+	if (__ess.soft)
+		return rfs_soft_update_ip_rule(re, cpu);
+
 	/*
 	 * Get VLAN ID of routing interface
 	 */
@@ -1060,6 +1077,9 @@ int rfs_ess_start(void)
 {
 	struct rfs_ess *ess = &__ess;
 
+	if (ess->soft)
+		return rfs_soft_start();
+
 	if (ess->is_running)
 		return 0;
 
@@ -1079,6 +1099,9 @@ int rfs_ess_stop(void)
 {
 	struct rfs_ess *ess = &__ess;
 
+	if (ess->soft)
+		return rfs_soft_stop();
+
 	if (!ess->is_running)
 		return 0;
 
@@ -1107,13 +1130,17 @@ int rfs_ess_init(void)
 	int i;
 
 	RFS_DEBUG("RFS ess init\n");
+	spin_lock_init(&__ess.vif_lock);
+	spin_lock_init(&__ess.dev_lock);
+
 	/*
 	 * Parse DT node of switch
 	 */
 	switch_node = of_find_node_by_name(NULL, "edma");
 	if (!switch_node) {
-		RFS_ERROR("Cannot find ess-switch\n");
-		return -1;
+		RFS_INFO("Cannot find ess-switch, use software steering\n");
+		ess->soft = 1;
+		return rfs_soft_init();
 	}
 
 	reg_cfg = of_get_property(switch_node, "reg", &len);
@@ -1148,8 +1175,6 @@ int rfs_ess_init(void)
 
 	iounmap(virt_base_addr);
 
-	spin_lock_init(&__ess.vif_lock);
-	spin_lock_init(&__ess.dev_lock);
 	__ess.proc_vif = proc_create("vif", S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH,
 				    rfs_proc_entry, &ess_vif_proc_fops);
 
@@ -1173,6 +1198,11 @@ void rfs_ess_exit(void)
 	struct rfs_ess *ess = &__ess;
 
 	RFS_DEBUG("RFS ess exit\n");
+	if (ess->soft) {
+		rfs_soft_exit();
+		return;
+	}
+
 	if (ess->proc_vif)
 		remove_proc_entry("vif", rfs_proc_entry);
 
@@ -23,8 +23,12 @@
 #include <linux/skbuff.h>
 #include <linux/jhash.h>
 #include <linux/inetdevice.h>
+#include <linux/inet.h>
 #include <linux/netfilter_bridge.h>
 #include <linux/proc_fs.h>
+#include <linux/mm.h>
+#include <linux/seqlock.h>
+#include <linux/workqueue.h>
 #include <net/route.h>
 #include <net/sock.h>
 #include <net/netfilter/nf_conntrack_acct.h>
@@ -40,20 +44,53 @@
 
 #define RFS_RULE_HASH_SHIFT 8
 #define RFS_RULE_HASH_SIZE (1 << RFS_RULE_HASH_SHIFT)
-#define RFS_RULE_HASH_MASK (RFS_RULE_HASH_SIZE - 1)
+#define RFS_RULE_HASH_SHIFT_MAX 14
 
 
+/*
+ * Rule hash table.
+ *	hash indexes all rules by their key, mac_hash indexes the IP rules by
+ *	the MAC address of their host. Both have 1 << shift buckets.
+ */
+struct rfs_rule_table {
+	unsigned int shift;
+	struct hlist_head *hash;
+	struct hlist_head *mac_hash;
+};
+
 /*
  * Per-module structure.
  */
 struct rfs_rule {
 	spinlock_t hash_lock;
-	struct hlist_head hash[RFS_RULE_HASH_SIZE];
+	seqcount_t hash_seq;
+	struct rfs_rule_table __rcu *table;
+	uint32_t count;
+	struct work_struct resize_work;
+
+	/*
+	 * MAC rule event statistics, protected by hash_lock
+	 */
+	uint32_t mac_events;
+	uint32_t mac_ip_updates;
+	uint64_t mac_event_ns;
+	uint64_t mac_event_max_ns;
+
 	struct proc_dir_entry *proc_rule;
 };
 
 static struct rfs_rule __rr;
 
+/*
+ * Initial table, replaced by a larger allocated one as the rule count grows
+ */
+static struct hlist_head rfs_rule_buckets[2 * RFS_RULE_HASH_SIZE];
+static struct rfs_rule_table rfs_rule_table0 = {
+	.shift = RFS_RULE_HASH_SHIFT,
+	.hash = rfs_rule_buckets,
+	.mac_hash = rfs_rule_buckets + RFS_RULE_HASH_SIZE,
+};
+
 
 /*
  * rfs_rule_hash
@@ -62,17 +99,176 @@ unsigned int rfs_rule_hash(uint32_t type, uint8_t *data)
 {
 	switch (type) {
 	case RFS_RULE_TYPE_MAC_RULE:
-		return jhash(data, ETH_ALEN, 0) & RFS_RULE_HASH_MASK;
+		return jhash(data, ETH_ALEN, 0);
 	case RFS_RULE_TYPE_IP4_RULE:
-		return jhash(data, 4, 0) & RFS_RULE_HASH_MASK;
+		return jhash(data, 4, 0);
 	case RFS_RULE_TYPE_IP6_RULE:
-		return jhash(data, sizeof(struct in6_addr), 0) & RFS_RULE_HASH_MASK;
+		return jhash(data, sizeof(struct in6_addr), 0);
 	default:
 		return 0;
 	}
 }
 
 
+/*
+ * rfs_rule_head
+ *	Bucket of a rule key in the rule hash
+ */
+static inline struct hlist_head *rfs_rule_head(struct rfs_rule_table *tbl,
+					       uint32_t type, uint8_t *data)
+{
+	return &tbl->hash[rfs_rule_hash(type, data) & ((1 << tbl->shift) - 1)];
+}
+
+
+/*
+ * rfs_rule_mac_head
+ *	Bucket of a host MAC address in the IP rule index
+ */
+static inline struct hlist_head *rfs_rule_mac_head(struct rfs_rule_table *tbl,
+						   uint8_t *mac)
+{
+	return &tbl->mac_hash[jhash(mac, ETH_ALEN, 0) & ((1 << tbl->shift) - 1)];
+}
+
+
+/*
+ * rfs_rule_entry_key
+ */
+static inline uint8_t *rfs_rule_entry_key(struct rfs_rule_entry *re)
+{
+	if (re->type == RFS_RULE_TYPE_MAC_RULE)
+		return re->mac;
+
+	return (uint8_t *)&re->u;
+}
+
+
+/*
+ * rfs_rule_table_locked
+ *	The caller should hold hash_lock
+ */
+static inline struct rfs_rule_table *rfs_rule_table_locked(struct rfs_rule *rr)
+{
+	return rcu_dereference_protected(rr->table,
+					 lockdep_is_held(&rr->hash_lock));
+}
+
+
+/*
+ * rfs_rule_table_alloc
+ */
+static struct rfs_rule_table *rfs_rule_table_alloc(unsigned int shift)
+{
+	struct rfs_rule_table *tbl;
+
+	tbl = kvzalloc(sizeof(*tbl) + (2UL << shift) * sizeof(struct hlist_head),
+		       GFP_KERNEL);
+	if (!tbl)
+		return NULL;
+
+	tbl->shift = shift;
+	tbl->hash = (struct hlist_head *)(tbl + 1);
+	tbl->mac_hash = tbl->hash + (1 << shift);
+	return tbl;
+}
+
+
+/*
+ * rfs_rule_table_free
+ */
+static void rfs_rule_table_free(struct rfs_rule_table *tbl)
+{
+	if (tbl != &rfs_rule_table0)
+		kvfree(tbl);
+}
+
+
+/*
+ * rfs_rule_resize_work
+ *	Grow the rule table to keep the chains short. Lookups running
+ *	concurrently are retried through hash_seq.
+ */
+static void rfs_rule_resize_work(struct work_struct *work)
+{
+	struct rfs_rule *rr = container_of(work, struct rfs_rule, resize_work);
+	struct rfs_rule_table *old, *new;
+	struct rfs_rule_entry *re;
+	struct hlist_node *n;
+	unsigned int shift, index;
+
+	rcu_read_lock();
+	shift = rcu_dereference(rr->table)->shift;
+	rcu_read_unlock();
+
+	while (shift < RFS_RULE_HASH_SHIFT_MAX && READ_ONCE(rr->count) > (2U << shift))
+		shift++;
+
+	new = rfs_rule_table_alloc(shift);
+	if (!new)
+		return;
+
+	spin_lock_bh(&rr->hash_lock);
+	old = rfs_rule_table_locked(rr);
+	if (old->shift >= shift) {
+		spin_unlock_bh(&rr->hash_lock);
+		rfs_rule_table_free(new);
+		return;
+	}
+
+	write_seqcount_begin(&rr->hash_seq);
+	for (index = 0; index < (1 << old->shift); index++) {
+		hlist_for_each_entry_safe(re, n, &old->hash[index], hlist) {
+			hlist_del_rcu(&re->hlist);
+			hlist_add_head_rcu(&re->hlist,
+				rfs_rule_head(new, re->type, rfs_rule_entry_key(re)));
+
+			if (re->type == RFS_RULE_TYPE_MAC_RULE)
+				continue;
+
+			hlist_del(&re->mac_hlist);
+			hlist_add_head(&re->mac_hlist, rfs_rule_mac_head(new, re->mac));
+		}
+	}
+	rcu_assign_pointer(rr->table, new);
+	write_seqcount_end(&rr->hash_seq);
+	spin_unlock_bh(&rr->hash_lock);
+
+	RFS_INFO("rule table resized to %u buckets\n", 1 << shift);
+
+	synchronize_rcu();
+	rfs_rule_table_free(old);
+}
+
+
+/*
+ * rfs_rule_count_inc
+ *	The caller should hold hash_lock
+ */
+static void rfs_rule_count_inc(struct rfs_rule *rr, struct rfs_rule_table *tbl)
+{
+	rr->count++;
+	if (tbl->shift < RFS_RULE_HASH_SHIFT_MAX && rr->count > (2U << tbl->shift))
+		schedule_work(&rr->resize_work);
+}
+
+
+/*
+ * rfs_rule_mac_event_done
+ *	Account a MAC rule event, the caller should hold hash_lock
+ */
+static void rfs_rule_mac_event_done(struct rfs_rule *rr, u64 start, int updated)
+{
+	u64 delta = ktime_get_ns() - start;
+
+	rr->mac_events++;
+	rr->mac_ip_updates += updated;
+	rr->mac_event_ns += delta;
+	if (delta > rr->mac_event_max_ns)
+		rr->mac_event_max_ns = delta;
+}
+
+
 /*
  * rfs_rule_rcu_free
  */
@@ -105,9 +301,14 @@ static uint16_t __rfs_rule_get_cpu(uint32_t type, uint8_t *addr)
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
 	uint16_t cpu = RPS_NO_CPU;
+	unsigned int seq;
 
-	head = &rr->hash[rfs_rule_hash(type, addr)];
+retry:
+	seq = read_seqcount_begin(&rr->hash_seq);
+	tbl = rcu_dereference_check(rr->table, lockdep_is_held(&rr->hash_lock));
+	head = rfs_rule_head(tbl, type, addr);
 	hlist_for_each_entry_rcu(re, head, hlist) {
 		if (type != re->type)
 			continue;
@@ -129,6 +330,12 @@ static uint16_t __rfs_rule_get_cpu(uint32_t type, uint8_t *addr)
 		}
 	}
 
+	/*
+	 * A resize may have moved the entry while we walked the chain
+	 */
+	if (!re && read_seqcount_retry(&rr->hash_seq, seq))
+		goto retry;
+
 	if (re)
 		cpu = re->cpu;
 
@@ -153,38 +360,64 @@ uint16_t rfs_rule_get_cpu_by_ipaddr(__be32 ipaddr)
 
 
 /*
- * rfs_rule_update_iprule_by_mac
- *	Caller should hold rcu_read_lock
+ * rfs_rule_get_cpu_by_ip6addr
  */
-static void __rfs_rule_update_iprule_by_mac(uint8_t *addr, uint16_t cpu)
+uint16_t rfs_rule_get_cpu_by_ip6addr(const struct in6_addr *ip6addr)
 {
-	int index;
-	struct hlist_head *head;
-	struct rfs_rule_entry *re;
-	struct rfs_rule *rr = &__rr;
+	uint16_t cpu;
+	uint32_t type = RFS_RULE_TYPE_IP6_RULE;
 
-	for ( index = 0; index < RFS_RULE_HASH_SIZE; index++) {
-		struct hlist_node *n;
-		head = &rr->hash[index];
-		hlist_for_each_entry_safe(re, n, head, hlist) {
-			if (re->type != RFS_RULE_TYPE_IP4_RULE
-				&& re->type != RFS_RULE_TYPE_IP6_RULE)
-				continue;
+	rcu_read_lock();
+	cpu = __rfs_rule_get_cpu(type, (uint8_t *)ip6addr);
+	rcu_read_unlock();
 
-			if (re->is_static)
-				continue;
+	return cpu;
+}
 
-			if (memcmp(re->mac, addr, ETH_ALEN))
-				continue;
 
-			if (re->cpu == cpu)
-				continue;
+/*
+ * rfs_rule_get_cpu_by_mac
+ */
+uint16_t rfs_rule_get_cpu_by_mac(uint8_t *addr)
+{
+	uint16_t cpu;
+	uint32_t type = RFS_RULE_TYPE_MAC_RULE;
 
-			rfs_ess_update_ip_rule(re, cpu);
-			re->cpu = cpu;
+	rcu_read_lock();
+	cpu = __rfs_rule_get_cpu(type, addr);
+	rcu_read_unlock();
 
-		}
+	return cpu;
+}
+
+
+/*
+ * rfs_rule_update_iprule_by_mac
+ *	Caller should hold hash_lock
+ *	Returns the number of IP rules updated
+ */
+static int __rfs_rule_update_iprule_by_mac(struct rfs_rule_table *tbl,
+					   uint8_t *addr, uint16_t cpu)
+{
+	struct rfs_rule_entry *re;
+	int updated = 0;
+
+	hlist_for_each_entry(re, rfs_rule_mac_head(tbl, addr), mac_hlist) {
+		if (re->is_static)
+			continue;
+
+		if (memcmp(re->mac, addr, ETH_ALEN))
+			continue;
+
+		if (re->cpu == cpu)
+			continue;
+
+		rfs_ess_update_ip_rule(re, cpu);
+		re->cpu = cpu;
+		updated++;
 	}
+
+	return updated;
 }
 
 
@@ -197,9 +430,12 @@ int rfs_rule_create_mac_rule(uint8_t *addr, uint16_t cpu, struct net_device *to,
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
 	uint32_t type = RFS_RULE_TYPE_MAC_RULE;
 	struct net_device *brdev;
 	int brindex = 0;
+	int updated;
+	u64 start = ktime_get_ns();
 
 	rcu_read_lock();
 	brdev = netdev_master_upper_dev_get_rcu(to);
@@ -208,9 +444,9 @@ int rfs_rule_create_mac_rule(uint8_t *addr, uint16_t cpu, struct net_device *to,
 	}
 	rcu_read_unlock();
 
-	head = &rr->hash[rfs_rule_hash(type, addr)];
-
 	spin_lock_bh(&rr->hash_lock);
+	tbl = rfs_rule_table_locked(rr);
+	head = rfs_rule_head(tbl, type, addr);
 	hlist_for_each_entry_rcu(re, head, hlist) {
 		if (type != re->type)
 			continue;
@@ -246,6 +482,7 @@ int rfs_rule_create_mac_rule(uint8_t *addr, uint16_t cpu, struct net_device *to,
 		re->to = to;
 		re->brindex = brindex;
 		hlist_add_head_rcu(&re->hlist, head);
+		rfs_rule_count_inc(rr, tbl);
 		RFS_DEBUG("New MAC rule %pM, cpu %d to:%s\n", addr, cpu, to->name);
 	}
 
@@ -259,7 +496,8 @@ int rfs_rule_create_mac_rule(uint8_t *addr, uint16_t cpu, struct net_device *to,
 	re->cpu = cpu;
 
 	RFS_DEBUG("update Mac: %pM, cpu %d to:%s\n", addr, re->cpu, re->to->name);
-	__rfs_rule_update_iprule_by_mac(addr, cpu);
+	updated = __rfs_rule_update_iprule_by_mac(tbl, addr, cpu);
+	rfs_rule_mac_event_done(rr, start, updated);
 	spin_unlock_bh(&rr->hash_lock);
 	return 0;
 }
@@ -273,12 +511,14 @@ int rfs_rule_destroy_mac_rule(uint8_t *addr, struct net_device *to, uint32_t is_
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
 	uint16_t cpu;
 	uint32_t type = RFS_RULE_TYPE_MAC_RULE;
 	struct net_device *brdev;
 	int brindex = 0;
+	int updated;
+	u64 start = ktime_get_ns();
 
-	head = &rr->hash[rfs_rule_hash(type, addr)];
 	rcu_read_lock();
 	brdev = netdev_master_upper_dev_get_rcu(to);
 	if (brdev) {
@@ -287,6 +527,8 @@ int rfs_rule_destroy_mac_rule(uint8_t *addr, struct net_device *to, uint32_t is_
 	rcu_read_unlock();
 
 	spin_lock_bh(&rr->hash_lock);
+	tbl = rfs_rule_table_locked(rr);
+	head = rfs_rule_head(tbl, type, addr);
 	hlist_for_each_entry_rcu(re, head, hlist) {
 		if (type != re->type)
 			continue;
@@ -302,6 +544,7 @@ int rfs_rule_destroy_mac_rule(uint8_t *addr, struct net_device *to, uint32_t is_
 	}
 
 	hlist_del_rcu(&re->hlist);
+	rr->count--;
 	cpu = re->cpu;
 
 	RFS_DEBUG("Remove rules: %pM, cpu %d\n", addr, cpu);
@@ -310,7 +553,8 @@ int rfs_rule_destroy_mac_rule(uint8_t *addr, struct net_device *to, uint32_t is_
 	re->cpu = RPS_NO_CPU;
 	call_rcu(&re->rcu, rfs_rule_rcu_free);
 
-	__rfs_rule_update_iprule_by_mac(addr, RPS_NO_CPU);
+	updated = __rfs_rule_update_iprule_by_mac(tbl, addr, RPS_NO_CPU);
+	rfs_rule_mac_event_done(rr, start, updated);
 	spin_unlock_bh(&rr->hash_lock);
 
 	return 0;
@@ -336,9 +580,8 @@ int rfs_rule_find_mac_rule(uint8_t *addr, struct net_device *to, uint32_t is_sta
 	}
 	rcu_read_unlock();
 
-	head = &rr->hash[rfs_rule_hash(type, addr)];
-
 	spin_lock_bh(&rr->hash_lock);
+	head = rfs_rule_head(rfs_rule_table_locked(rr), type, addr);
 	hlist_for_each_entry_rcu(re, head, hlist) {
 		if (type != re->type)
 			continue;
@@ -367,6 +610,7 @@ int rfs_rule_create_ip_rule(int family, uint8_t *ipaddr, uint8_t *maddr,
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
 	uint32_t type;
 
 
@@ -375,9 +619,9 @@ int rfs_rule_create_ip_rule(int family, uint8_t *ipaddr, uint8_t *maddr,
 	else
 		type = RFS_RULE_TYPE_IP6_RULE;
 
-	head = &rr->hash[rfs_rule_hash(type, ipaddr)];
-
 	spin_lock_bh(&rr->hash_lock);
+	tbl = rfs_rule_table_locked(rr);
+	head = rfs_rule_head(tbl, type, ipaddr);
 	hlist_for_each_entry_rcu(re, head, hlist) {
 		if (type != re->type)
 			continue;
@@ -414,6 +658,8 @@ int rfs_rule_create_ip_rule(int family, uint8_t *ipaddr, uint8_t *maddr,
 		re->cpu  = RPS_NO_CPU;
 		memcpy(re->mac, maddr, ETH_ALEN);
 		hlist_add_head_rcu(&re->hlist, head);
+		hlist_add_head(&re->mac_hlist, rfs_rule_mac_head(tbl, re->mac));
+		rfs_rule_count_inc(rr, tbl);
 	}
 
 	/*
@@ -450,12 +696,16 @@ int rfs_rule_destroy_ip_rule(int family, uint8_t *ipaddr, uint32_t is_static)
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
-	uint32_t type = RFS_RULE_TYPE_IP4_RULE;
+	uint32_t type;
 	uint16_t cpu;
 
-	head = &rr->hash[rfs_rule_hash(type, ipaddr)];
+	if (family == AF_INET)
+		type = RFS_RULE_TYPE_IP4_RULE;
+	else
+		type = RFS_RULE_TYPE_IP6_RULE;
 
 	spin_lock_bh(&rr->hash_lock);
+	head = rfs_rule_head(rfs_rule_table_locked(rr), type, ipaddr);
 	hlist_for_each_entry_rcu(re, head, hlist) {
 		if (type != re->type)
 			continue;
@@ -470,6 +720,8 @@ int rfs_rule_destroy_ip_rule(int family, uint8_t *ipaddr, uint32_t is_static)
 	}
 
 	hlist_del_rcu(&re->hlist);
+	hlist_del(&re->mac_hlist);
+	rr->count--;
 	cpu = re->cpu;
 
 	if (family ==AF_INET)
@@ -499,11 +751,13 @@ void rfs_rule_reset_all(void)
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
 
 	spin_lock_bh(&rr->hash_lock);
-	for ( index = 0; index < RFS_RULE_HASH_SIZE; index++) {
+	tbl = rfs_rule_table_locked(rr);
+	for ( index = 0; index < (1 << tbl->shift); index++) {
 		struct hlist_node *n;
-		head = &rr->hash[index];
+		head = &tbl->hash[index];
 		hlist_for_each_entry_safe(re, n, head, hlist) {
 			if (re->cpu == RPS_NO_CPU)
 				continue;
@@ -530,11 +784,13 @@ void rfs_rule_destroy_all(void)
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
 
 	spin_lock_bh(&rr->hash_lock);
-	for ( index = 0; index < RFS_RULE_HASH_SIZE; index++) {
+	tbl = rfs_rule_table_locked(rr);
+	for ( index = 0; index < (1 << tbl->shift); index++) {
 		struct hlist_node *n;
-		head = &rr->hash[index];
+		head = &tbl->hash[index];
 		hlist_for_each_entry_safe(re, n, head, hlist) {
 			if (re->cpu != RPS_NO_CPU) {
 				if (re->type == RFS_RULE_TYPE_MAC_RULE)
@@ -543,10 +799,13 @@ void rfs_rule_destroy_all(void)
 					rfs_ess_update_ip_rule(re, RPS_NO_CPU);
 			}
 			hlist_del_rcu(&re->hlist);
+			if (re->type != RFS_RULE_TYPE_MAC_RULE)
+				hlist_del(&re->mac_hlist);
 			re->cpu = RPS_NO_CPU;
 			call_rcu(&re->rcu, rfs_rule_rcu_free);
 		}
 	}
+	rr->count = 0;
 	spin_unlock_bh(&rr->hash_lock);
 }
 
@@ -562,12 +821,16 @@ static int rfs_rule_proc_show(struct seq_file *m, void *v)
 	struct hlist_head *head;
 	struct rfs_rule_entry *re;
 	struct rfs_rule *rr = &__rr;
+	struct rfs_rule_table *tbl;
+	uint32_t rules, events, updates;
+	uint64_t event_ns, event_max_ns;
 
 	seq_printf(m, "RFS rule table:\n");
 
 	rcu_read_lock();
-	for ( index = 0; index < RFS_RULE_HASH_SIZE; index++) {
-		head = &rr->hash[index];
+	tbl = rcu_dereference(rr->table);
+	for ( index = 0; index < (1 << tbl->shift); index++) {
+		head = &tbl->hash[index];
 		hlist_for_each_entry_rcu(re, head, hlist) {
 			seq_printf(m, "%03d %04x", ++count, index);
 			if (re->type == RFS_RULE_TYPE_MAC_RULE)
@@ -602,6 +865,20 @@ static int rfs_rule_proc_show(struct seq_file *m, void *v)
 	}
 	seq_putc(m, '\n');
 	rcu_read_unlock();
+
+	spin_lock_bh(&rr->hash_lock);
+	index = 1 << rfs_rule_table_locked(rr)->shift;
+	rules = rr->count;
+	events = rr->mac_events;
+	updates = rr->mac_ip_updates;
+	event_ns = rr->mac_event_ns;
+	event_max_ns = rr->mac_event_max_ns;
+	spin_unlock_bh(&rr->hash_lock);
+
+	seq_printf(m, "%u rules in %d buckets\n", rules, index);
+	seq_printf(m, "MAC events %u, IP rules updated %u, latency avg %llu ns max %llu ns\n",
+		   events, updates, events ? div_u64(event_ns, events) : 0,
+		   event_max_ns);
 	return 0;
 }
 
@@ -618,6 +895,8 @@ static ssize_t rfs_rule_proc_write(struct file *file, const char __user *buffer,
 	int nvar;
 	int cpu;
 	char devname[IFNAMSIZ];
+	char addr6[INET6_ADDRSTRLEN];
+	uint8_t ip6[sizeof(struct in6_addr)];
 	struct net_device *dev;
 
 	count = min(count, sizeof(buf) - 1);
@@ -666,6 +945,16 @@ static ssize_t rfs_rule_proc_write(struct file *file, const char __user *buffer,
 		return count;
 	}
 
+	nvar = sscanf(buf, "%45s %d", addr6, &cpu);
+	if (nvar == 2 && in6_pton(addr6, -1, ip6, -1, NULL)) {
+		uint8_t  mac[6] = {0};
+		if ((uint16_t)cpu != RPS_NO_CPU)
+			rfs_rule_create_ip_rule(AF_INET6, ip6, mac, (uint16_t)cpu, 1);
+		else
+			rfs_rule_destroy_ip_rule(AF_INET6, ip6, 1);
+		return count;
+	}
+
 	return -EFAULT;
 
 }
@@ -702,7 +991,9 @@ int rfs_rule_init(void)
 
 	RFS_DEBUG("RFS Rule init\n");
 	spin_lock_init(&rr->hash_lock);
-	memset(&rr->hash, 0, RFS_RULE_HASH_SIZE);
+	seqcount_init(&rr->hash_seq);
+	RCU_INIT_POINTER(rr->table, &rfs_rule_table0);
+	INIT_WORK(&rr->resize_work, rfs_rule_resize_work);
 
 	rr->proc_rule = proc_create("rule", S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH,
 				    rfs_proc_entry, &rule_proc_fops);
@@ -719,7 +1010,15 @@ void rfs_rule_exit(void)
 	RFS_DEBUG("RFS Rule exit\n");
 	if (rr->proc_rule);
 		remove_proc_entry("rule", rfs_proc_entry);
+	cancel_work_sync(&rr->resize_work);
 	rfs_rule_destroy_all();
+
+	/*
+	 * Wait for the entries to be freed before the table and the module go
+	 */
+	rcu_barrier();
+	rfs_rule_table_free(rcu_dereference_protected(rr->table, 1));
+	RCU_INIT_POINTER(rr->table, &rfs_rule_table0);
 }
 
 
@@ -25,6 +25,7 @@
 
 struct rfs_rule_entry {
         struct hlist_node hlist;
+	struct hlist_node mac_hlist;	/* IP rules only, indexed by host MAC */
 	struct rcu_head rcu;
 	uint32_t type;
 	uint8_t mac[ETH_ALEN];
@@ -58,6 +59,8 @@ int rfs_rule_find_mac_rule(uint8_t *addr, struct net_device *to, uint32_t is_sta
 int rfs_rule_create_ip_rule(int family, uint8_t *ipaddr, uint8_t *maddr, uint16_t cpu, uint32_t is_static);
 int rfs_rule_destroy_ip_rule(int family, uint8_t *addr, uint32_t is_static);
 uint16_t rfs_rule_get_cpu_by_ipaddr(__be32 ipaddr);
+uint16_t rfs_rule_get_cpu_by_ip6addr(const struct in6_addr *ip6addr);
+uint16_t rfs_rule_get_cpu_by_mac(uint8_t *addr);
 void rfs_rule_reset_all(void);
 void rfs_rule_destroy_all(void);
 
@@ -0,0 +1,414 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * rfs_soft.c
+ *	Receiving Flow Streering - software backend
+ *
+ * Used when there is no ESS switch to program. Instead of VLAN/ACL rules,
+ * the CPU of a host is written into the kernel RFS flow table
+ * (rps_sock_flow_table) for every flow seen going to or coming from that
+ * host, IPv4 and IPv6 alike. The stack then steers the following packets
+ * of the flow to that CPU through RPS, and through ndo_rx_flow_steer on NICs supporting
+ * accelerated RFS. It works on any multiqueue NIC with rps_sock_flow_entries
+ * and the per queue rps_flow_cnt configured.
+ */
+
+#include <linux/module.h>
+#include <linux/skbuff.h>
+#include <linux/netdevice.h>
+#include <linux/etherdevice.h>
+#include <linux/ip.h>
+#include <linux/ipv6.h>
+#include <linux/percpu.h>
+#include <linux/proc_fs.h>
+#include <linux/seq_file.h>
+#include <linux/netfilter.h>
+#include <linux/netfilter_ipv4.h>
+#include <linux/netfilter_ipv6.h>
+#include <linux/netfilter_bridge.h>
+#include <net/netfilter/nf_conntrack.h>
+
+#include "rfs.h"
+#include "rfs_rule.h"
+#include "rfs_cm.h"
+#include "rfs_soft.h"
+
+/*
+ * Per-CPU counters
+ */
+struct rfs_soft_stats {
+	uint64_t hits;		/* packets of a host having a rule */
+	uint64_t remote;	/* hits received on another CPU than the rule CPU */
+	uint64_t steered;	/* flow table entries rewritten */
+	uint64_t no_hash;	/* hits without a flow hash, can't be steered */
+	uint64_t rules;		/* MAC/IP rule updates */
+};
+
+/*
+ * Per-module structure.
+ */
+struct rfs_soft {
+	struct rfs_soft_stats __percpu *stats;
+	struct proc_dir_entry *proc_soft;
+	int is_running;
+};
+
+static struct rfs_soft __soft;
+
+
+/*
+ * rfs_soft_update_flow
+ *	Point the RFS flow table entry of rxhash at cpu
+ *	Return 1 if the entry was changed
+ */
+static int rfs_soft_update_flow(uint32_t rxhash, uint16_t cpu)
+{
+	struct rps_sock_flow_table *sock_flow_table;
+	uint32_t index, ident;
+	int changed = 0;
+
+	rcu_read_lock();
+	sock_flow_table = rcu_dereference(rps_sock_flow_table);
+	if (sock_flow_table) {
+		index = rxhash & sock_flow_table->mask;
+		/*
+		 * The upper bits of an entry hold the flow hash,
+		 * get_rps_cpu() ignores the entry if they don't match.
+		 */
+		ident = (rxhash & ~rps_cpu_mask) | cpu;
+		if (READ_ONCE(sock_flow_table->ents[index]) != ident) {
+			WRITE_ONCE(sock_flow_table->ents[index], ident);
+			changed = 1;
+		}
+	}
+	rcu_read_unlock();
+
+	return changed;
+}
+
+
+/*
+ * rfs_soft_steer
+ *	Called from the receive path for a packet of a host on cpu
+ */
+static void rfs_soft_steer(struct sk_buff *skb, uint16_t cpu)
+{
+	struct rfs_soft_stats *stats = this_cpu_ptr(__soft.stats);
+
+	if (cpu >= nr_cpu_ids)
+		return;
+
+	stats->hits++;
+	if (cpu != smp_processor_id())
+		stats->remote++;
+
+	if (!skb->hash) {
+		stats->no_hash++;
+		return;
+	}
+
+	if (rfs_soft_update_flow(skb->hash, cpu))
+		stats->steered++;
+}
+
+
+/*
+ * rfs_soft_bridge_hook
+ *	Bridged packets, steered by MAC rules
+ */
+static unsigned int rfs_soft_bridge_hook(void *priv, struct sk_buff *skb,
+					 const struct nf_hook_state *state)
+{
+	struct ethhdr *eth = eth_hdr(skb);
+	uint16_t cpu;
+
+	if (unlikely(!is_unicast_ether_addr(eth->h_dest)))
+		return NF_ACCEPT;
+
+	cpu = rfs_rule_get_cpu_by_mac(eth->h_dest);
+	if (cpu == RPS_NO_CPU)
+		cpu = rfs_rule_get_cpu_by_mac(eth->h_source);
+
+	if (cpu != RPS_NO_CPU)
+		rfs_soft_steer(skb, cpu);
+
+	return NF_ACCEPT;
+}
+
+
+/*
+ * rfs_soft_ipv4_hook
+ *	Routed packets, steered by IP rules
+ *	For NAT connections the host is the private side of the connection.
+ */
+static unsigned int rfs_soft_ipv4_hook(void *priv, struct sk_buff *skb,
+				       const struct nf_hook_state *state)
+{
+	struct iphdr *iph = ip_hdr(skb);
+	struct nf_conn *ct;
+	enum ip_conntrack_info ctinfo;
+	uint16_t cpu;
+
+	if (unlikely(skb->pkt_type != PACKET_HOST))
+		return NF_ACCEPT;
+
+	ct = nf_ct_get(skb, &ctinfo);
+	if (ct && test_bit(IPS_SRC_NAT_BIT, &ct->status)) {
+		cpu = rfs_rule_get_cpu_by_ipaddr(ct->tuplehash[IP_CT_DIR_ORIGINAL].tuple.src.u3.ip);
+	} else if (ct && test_bit(IPS_DST_NAT_BIT, &ct->status)) {
+		cpu = rfs_rule_get_cpu_by_ipaddr(ct->tuplehash[IP_CT_DIR_REPLY].tuple.src.u3.ip);
+	} else {
+		cpu = rfs_rule_get_cpu_by_ipaddr(iph->daddr);
+		if (cpu == RPS_NO_CPU)
+			cpu = rfs_rule_get_cpu_by_ipaddr(iph->saddr);
+	}
+
+	if (cpu != RPS_NO_CPU)
+		rfs_soft_steer(skb, cpu);
+
+	return NF_ACCEPT;
+}
+
+
+/*
+ * rfs_soft_ipv6_hook
+ *	Routed IPv6 packets, steered by the IPv6 rules of the neighbours
+ */
+static unsigned int rfs_soft_ipv6_hook(void *priv, struct sk_buff *skb,
+				       const struct nf_hook_state *state)
+{
+	struct ipv6hdr *ip6h = ipv6_hdr(skb);
+	struct nf_conn *ct;
+	enum ip_conntrack_info ctinfo;
+	uint16_t cpu;
+
+	if (unlikely(skb->pkt_type != PACKET_HOST))
+		return NF_ACCEPT;
+
+	ct = nf_ct_get(skb, &ctinfo);
+	if (ct && test_bit(IPS_SRC_NAT_BIT, &ct->status)) {
+		cpu = rfs_rule_get_cpu_by_ip6addr(&ct->tuplehash[IP_CT_DIR_ORIGINAL].tuple.src.u3.in6);
+	} else if (ct && test_bit(IPS_DST_NAT_BIT, &ct->status)) {
+		cpu = rfs_rule_get_cpu_by_ip6addr(&ct->tuplehash[IP_CT_DIR_REPLY].tuple.src.u3.in6);
+	} else {
+		cpu = rfs_rule_get_cpu_by_ip6addr(&ip6h->daddr);
+		if (cpu == RPS_NO_CPU)
+			cpu = rfs_rule_get_cpu_by_ip6addr(&ip6h->saddr);
+	}
+
+	if (cpu != RPS_NO_CPU)
+		rfs_soft_steer(skb, cpu);
+
+	return NF_ACCEPT;
+}
+
+static struct nf_hook_ops rfs_soft_nf_hooks[] __read_mostly = {
+	{
+		.hook = rfs_soft_bridge_hook,
+		.pf = NFPROTO_BRIDGE,
+		.hooknum = NF_BR_PRE_ROUTING,
+		.priority = NF_BR_PRI_FIRST,
+	},
+	{
+		.hook = rfs_soft_ipv4_hook,
+		.pf = NFPROTO_IPV4,
+		.hooknum = NF_INET_PRE_ROUTING,
+		.priority = NF_IP_PRI_CONNTRACK + 1,
+	},
+	{
+		.hook = rfs_soft_ipv6_hook,
+		.pf = NFPROTO_IPV6,
+		.hooknum = NF_INET_PRE_ROUTING,
+		.priority = NF_IP6_PRI_CONNTRACK + 1,
+	},
+};
+
+
+/*
+ * rfs_soft_update_mac_rule
+ *	Nothing to program, the hooks look the rules up per packet and
+ *	move the flows of the host with the next packet.
+ */
+int rfs_soft_update_mac_rule(struct rfs_rule_entry *re, uint16_t cpu)
+{
+	this_cpu_inc(__soft.stats->rules);
+	RFS_DEBUG("Soft MAC rule : address %pM cpu %d\n", re->mac, cpu);
+	return 0;
+}
+
+
+/*
+ * rfs_soft_update_ip_rule
+ *	IPv4 and IPv6 rules are looked up per packet by the pre-routing
+ *	hooks, only IPv4 connections are tracked by rfs_cm.
+ */
+int rfs_soft_update_ip_rule(struct rfs_rule_entry *re, uint16_t cpu)
+{
+	this_cpu_inc(__soft.stats->rules);
+
+	/*
+	 * Apply the rule to layer 4(TCP/UDP)
+	 */
+	if (re->type == RFS_RULE_TYPE_IP4_RULE && re->cpu != cpu)
+		rfs_cm_update_rules(re->u.ip4addr, cpu);
+
+	return 0;
+}
+
+
+/*
+ * rfs_soft_proc_show
+ */
+static int rfs_soft_proc_show(struct seq_file *m, void *v)
+{
+	struct rps_sock_flow_table *sock_flow_table;
+	struct rfs_soft_stats sum, *stats;
+	int cpu;
+
+	seq_printf(m, "Software steering:\n");
+
+	rcu_read_lock();
+	sock_flow_table = rcu_dereference(rps_sock_flow_table);
+	if (sock_flow_table)
+		seq_printf(m, "flow table entries %u\n", sock_flow_table->mask + 1);
+	else
+		seq_printf(m, "flow table disabled, set net.core.rps_sock_flow_entries\n");
+	rcu_read_unlock();
+
+	memset(&sum, 0, sizeof(sum));
+	seq_printf(m, "cpu %12s %12s %12s %12s %12s\n",
+		   "hits", "remote", "steered", "no_hash", "rules");
+	for_each_possible_cpu(cpu) {
+		stats = per_cpu_ptr(__soft.stats, cpu);
+		seq_printf(m, "%3d %12llu %12llu %12llu %12llu %12llu\n", cpu,
+			   stats->hits, stats->remote, stats->steered,
+			   stats->no_hash, stats->rules);
+		sum.hits += stats->hits;
+		sum.remote += stats->remote;
+		sum.steered += stats->steered;
+		sum.no_hash += stats->no_hash;
+		sum.rules += stats->rules;
+	}
+	seq_printf(m, "all %12llu %12llu %12llu %12llu %12llu\n",
+		   sum.hits, sum.remote, sum.steered, sum.no_hash, sum.rules);
+
+	return 0;
+}
+
+
+/*
+ * rfs_soft_proc_write
+ *	Any write clears the counters
+ */
+static ssize_t rfs_soft_proc_write(struct file *file, const char __user *buffer,
+			size_t count, loff_t *ppos)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu)
+		memset(per_cpu_ptr(__soft.stats, cpu), 0, sizeof(struct rfs_soft_stats));
+
+	return count;
+}
+
+
+/*
+ * rfs_soft_proc_open
+ */
+static int rfs_soft_proc_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, rfs_soft_proc_show, NULL);
+}
+
+
+/*
+ * struct file_operations soft_proc_fops
+ */
+static const struct file_operations soft_proc_fops = {
+	.owner = THIS_MODULE,
+	.open  = rfs_soft_proc_open,
+	.read  = seq_read,
+	.llseek = seq_lseek,
+	.write  = rfs_soft_proc_write,
+	.release = single_release,
+};
+
+
+/*
+ * rfs_soft_start
+ */
+int rfs_soft_start(void)
+{
+	struct rfs_soft *soft = &__soft;
+	int ret;
+
+	if (soft->is_running)
+		return 0;
+
+	RFS_DEBUG("RFS soft start\n");
+	ret = nf_register_net_hooks(&init_net, rfs_soft_nf_hooks,
+				    ARRAY_SIZE(rfs_soft_nf_hooks));
+	if (ret < 0) {
+		RFS_ERROR("can't register nf hooks: %d\n", ret);
+		return -1;
+	}
+
+	soft->is_running = 1;
+	return 0;
+}
+
+
+/*
+ * rfs_soft_stop
+ */
+int rfs_soft_stop(void)
+{
+	struct rfs_soft *soft = &__soft;
+
+	if (!soft->is_running)
+		return 0;
+
+	RFS_DEBUG("RFS soft stop\n");
+	nf_unregister_net_hooks(&init_net, rfs_soft_nf_hooks,
+				ARRAY_SIZE(rfs_soft_nf_hooks));
+	soft->is_running = 0;
+	return 0;
+}
+
+
+/*
+ * rfs_soft_init()
+ */
+int rfs_soft_init(void)
+{
+	struct rfs_soft *soft = &__soft;
+
+	RFS_DEBUG("RFS soft init\n");
+	soft->stats = alloc_percpu(struct rfs_soft_stats);
+	if (!soft->stats) {
+		RFS_ERROR("Failed to allocate soft stats\n");
+		return -1;
+	}
+
+	soft->proc_soft = proc_create("soft", S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH,
+				      rfs_proc_entry, &soft_proc_fops);
+	soft->is_running = 0;
+	return 0;
+}
+
+
+/*
+ * rfs_soft_exit()
+ */
+void rfs_soft_exit(void)
+{
+	struct rfs_soft *soft = &__soft;
+
+	RFS_DEBUG("RFS soft exit\n");
+	if (soft->proc_soft)
+		remove_proc_entry("soft", rfs_proc_entry);
+
+	rfs_soft_stop();
+	free_percpu(soft->stats);
+	soft->stats = NULL;
+}
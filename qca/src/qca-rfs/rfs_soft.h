@@ -0,0 +1,20 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * rfs_soft.h
+ *	Receiving Flow Streering - software backend
+ */
+
+#ifndef __RFS_SOFT_H
+#define __RFS_SOFT_H
+struct rfs_rule_entry;
+
+int rfs_soft_update_mac_rule(struct rfs_rule_entry *re, uint16_t cpu);
+int rfs_soft_update_ip_rule(struct rfs_rule_entry *re, uint16_t cpu);
+
+int rfs_soft_start(void);
+int rfs_soft_stop(void);
+
+int rfs_soft_init(void);
+void rfs_soft_exit(void);
+#endif
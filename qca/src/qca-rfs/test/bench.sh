@@ -0,0 +1,157 @@
+#!/bin/sh
+# Routed throughput with and without the software steering backend,
+# over veth pairs with several rx queues:
+#
+#   rfs_cli: veth0a --- veth0b =router= veth1b --- veth1a :rfs_srv
+#
+# iperf3 runs from rfs_cli to rfs_srv, once over IPv4 and once over IPv6,
+# with /proc/qrfs/enable off and on. The client address gets a static rule
+# to the CPU given with -c. For every run the script reports the rate, the
+# /proc/qrfs/soft counters, the NET_RX softirqs and function call IPIs
+# (the remote CPU wakeups of RPS), the context switches and, when perf is
+# installed, the cache misses of the whole system.
+#
+# Needs root, iperf3 and qrfs.ko (loaded, or given with -m) running the
+# software backend. Usage: bench.sh [-m qrfs.ko] [-c cpu] [-t seconds]
+
+CPU=1
+TIME=10
+MODULE=
+QUEUES=4
+QRFS=/proc/qrfs
+
+while getopts "c:m:t:" opt; do
+	case "$opt" in
+		c) CPU="$OPTARG";;
+		m) MODULE="$OPTARG";;
+		t) TIME="$OPTARG";;
+		*) echo "usage: $0 [-m qrfs.ko] [-c cpu] [-t seconds]" >&2; exit 1;;
+	esac
+done
+
+die() {
+	echo "$*" >&2
+	exit 1
+}
+
+# sum of the per-cpu columns of the /proc/softirqs or /proc/interrupts line
+irq_sum() {
+	awk -v key="$2" '$1 == key { s = 0; for (i = 2; i <= NF; i++) if ($i ~ /^[0-9]+$/) s += $i; print s }' "$1"
+}
+
+counters() {
+	echo "$(irq_sum /proc/softirqs NET_RX:) $(irq_sum /proc/interrupts CAL:)" \
+	     "$(awk '$1 == "ctxt" { print $2 }' /proc/stat)"
+}
+
+# rps_cpus mask of all CPUs, in the comma separated 32 bit words it wants
+cpu_mask() {
+	n=$(nproc)
+	mask=
+	while [ "$n" -gt 0 ]; do
+		bits=$((n > 32 ? 32 : n))
+		word=$(printf '%x' $(( (1 << bits) - 1 )))
+		mask="$word${mask:+,}$mask"
+		n=$((n - bits))
+	done
+	echo "$mask"
+}
+
+cleanup() {
+	[ -n "$SRV" ] && kill "$SRV" 2>/dev/null
+	[ -n "$OLD_FLOWS" ] && sysctl -qw net.core.rps_sock_flow_entries="$OLD_FLOWS"
+	[ -f "$QRFS/rule" ] && {
+		echo "10.1.0.2 65535" > "$QRFS/rule"
+		echo "fd01::2 65535" > "$QRFS/rule"
+	}
+	ip netns del rfs_cli 2>/dev/null
+	ip netns del rfs_srv 2>/dev/null
+	ip link del veth0b 2>/dev/null
+	ip link del veth1b 2>/dev/null
+}
+
+run() {
+	family=$1
+	dst=$2
+	enable=$3
+
+	echo "$enable" > "$QRFS/enable"
+	echo > "$QRFS/soft"
+	set -- $(counters)
+	if command -v perf >/dev/null; then
+		perf stat -a -x, -e cache-misses -o /tmp/rfs_perf.$$ \
+			ip netns exec rfs_cli iperf3 -$family -c "$dst" -t "$TIME" -P 4 -J > /tmp/rfs_iperf.$$
+		misses=$(awk -F, '/cache-misses/ { print $1 }' /tmp/rfs_perf.$$)
+	else
+		ip netns exec rfs_cli iperf3 -$family -c "$dst" -t "$TIME" -P 4 -J > /tmp/rfs_iperf.$$
+		misses="n/a"
+	fi
+	set -- $1 $2 $3 $(counters)
+	bps=$(awk '/"sum_received"/ { f = 1 } f && /"bits_per_second"/ { gsub(/[,}]/, "", $2); print int($2 / 1000000); exit }' /tmp/rfs_iperf.$$)
+	rm -f /tmp/rfs_iperf.$$ /tmp/rfs_perf.$$
+
+	echo "IPv$family enable $enable: $bps Mbit/s, net_rx $(($4 - $1))," \
+	     "ipi $(($5 - $2)), ctxt $(($6 - $3)), cache-misses $misses"
+	tail -n 1 "$QRFS/soft"
+}
+
+command -v iperf3 >/dev/null || die "iperf3 is not installed"
+[ -n "$MODULE" ] && { insmod "$MODULE" || exit 1; }
+[ -f "$QRFS/soft" ] || die "qrfs is not loaded or has no software backend"
+
+trap cleanup EXIT INT TERM
+cleanup
+
+OLD_FLOWS=$(sysctl -n net.core.rps_sock_flow_entries)
+sysctl -qw net.core.rps_sock_flow_entries=32768
+sysctl -qw net.ipv4.ip_forward=1
+sysctl -qw net.ipv6.conf.all.forwarding=1
+
+ip netns add rfs_cli || exit 1
+ip netns add rfs_srv || exit 1
+ip link add veth0a numtxqueues $QUEUES numrxqueues $QUEUES netns rfs_cli type veth \
+	peer name veth0b numtxqueues $QUEUES numrxqueues $QUEUES
+ip link add veth1a numtxqueues $QUEUES numrxqueues $QUEUES netns rfs_srv type veth \
+	peer name veth1b numtxqueues $QUEUES numrxqueues $QUEUES
+
+ip addr add 10.1.0.1/24 dev veth0b
+ip addr add fd01::1/64 dev veth0b nodad
+ip addr add 10.2.0.1/24 dev veth1b
+ip addr add fd02::1/64 dev veth1b nodad
+ip link set veth0b up
+ip link set veth1b up
+
+ip netns exec rfs_cli sh -e -c "
+	ip link set lo up
+	ip addr add 10.1.0.2/24 dev veth0a
+	ip addr add fd01::2/64 dev veth0a nodad
+	ip link set veth0a up
+	ip route add default via 10.1.0.1
+	ip -6 route add default via fd01::1"
+ip netns exec rfs_srv sh -e -c "
+	ip link set lo up
+	ip addr add 10.2.0.2/24 dev veth1a
+	ip addr add fd02::2/64 dev veth1a nodad
+	ip link set veth1a up
+	ip route add default via 10.2.0.1
+	ip -6 route add default via fd02::1"
+
+# RPS over all CPUs on the router side, the flow table picks the CPU
+for dev in veth0b veth1b; do
+	for q in /sys/class/net/$dev/queues/rx-*; do
+		cpu_mask > "$q/rps_cpus"
+		echo $((32768 / QUEUES)) > "$q/rps_flow_cnt"
+	done
+done
+
+echo "10.1.0.2 $CPU" > "$QRFS/rule"
+echo "fd01::2 $CPU" > "$QRFS/rule"
+
+ip netns exec rfs_srv iperf3 -s >/dev/null 2>&1 &
+SRV=$!
+sleep 1
+
+for enable in 0 1; do
+	run 4 10.2.0.2 $enable
+	run 6 fd02::2 $enable
+done
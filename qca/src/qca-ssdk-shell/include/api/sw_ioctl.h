@@ -976,6 +976,9 @@ extern "C" {
 #define SW_API_SHAPER_IPG_PRE_GET               (19  + SW_API_SHAPER_OFFSET)
 /*qca808x_start*/
 #define SW_API_MAX                 0xffff
+/* batch message: args[2] = call count, args[3] = SW_API_BATCH_* flags,
+ * args[4] = call blocks of SW_MAX_API_PARAM words, args[5] = calls done */
+#define SW_API_BATCH               (SW_API_MAX - 1)
 #ifdef __cplusplus
 }
 #endif                          /* __cplusplus */
@@ -24,10 +24,33 @@ extern "C" {
 #include "sw.h"
 #include "fal_type.h"
 #include "ssdk_init.h"
+#include "sw_api.h"
 
     sw_error_t
     sw_uk_exec(a_uint32_t api_id, ...);
 
+    /* run up to SW_API_BATCH_MAX prepared calls, args[1] of each call points
+     * to its own return slot, nr_done reports how many calls were run */
+    sw_error_t
+    sw_uk_exec_batch(unsigned long (*calls)[SW_MAX_API_PARAM], a_uint32_t nr_call,
+                     a_uint32_t flags, a_uint32_t *nr_done);
+
+    /* pipeline mode, calls without output parameters are queued and sent
+     * together, failures are reported through err_func with the current tag */
+    typedef void (*sw_uk_pipe_err_func)(a_uint32_t tag, sw_error_t rv);
+
+    void
+    sw_uk_pipe_start(sw_uk_pipe_err_func err_func);
+
+    void
+    sw_uk_pipe_tag(a_uint32_t tag);
+
+    sw_error_t
+    sw_uk_pipe_flush(void);
+
+    sw_error_t
+    sw_uk_pipe_stop(void);
+
     sw_error_t
     ssdk_init(a_uint32_t dev_id, ssdk_init_cfg * cfg);
 
@@ -29,6 +29,10 @@ extern "C" {
 
     sw_error_t sw_uk_if(unsigned long arg_val[SW_MAX_API_PARAM]);
 
+    sw_error_t sw_uk_if_batch(unsigned long (*calls)[SW_MAX_API_PARAM],
+                              a_uint32_t nr_call, a_uint32_t flags,
+                              a_uint32_t *nr_done);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -32,6 +32,7 @@ extern "C" {
 #define CMDSTR_ARGS_MAX 128
 #define dprintf cmd_print
     extern sw_error_t cmd_exec_api(a_ulong_t *arg_val);
+    extern sw_error_t cmd_api_show(a_uint32_t api_id, a_uint32_t index, void *buf);
     extern void cmd_print(char *fmt, ...);
     void cmd_print_error(sw_error_t rtn);
 
@@ -43,7 +43,8 @@ extern "C" {
 #define SW_CMD_FLOW_IPV45T_SHOW       (SW_API_MAX + 18)
 #define SW_CMD_FLOW_IPV65T_SHOW       (SW_API_MAX + 19)
 #define SW_CMD_PT_VLAN_TRANS_ADV_SHOW (SW_API_MAX + 20)
-#define SW_CMD_MAX                    (SW_API_MAX + 21)
+#define SW_CMD_ACL_RULE_SHOW          (SW_API_MAX + 21)
+#define SW_CMD_MAX                    (SW_API_MAX + 22)
 
 #define MAX_SUB_CMD_DES_NUM  120
 
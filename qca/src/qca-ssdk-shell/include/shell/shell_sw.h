@@ -44,6 +44,7 @@ extern "C" {
     sw_error_t cmd_show_flow(a_ulong_t *arg_val);
     sw_error_t cmd_show_ctrlpkt(a_ulong_t *arg_val);
     sw_error_t cmd_show_ptvlan_entry(a_ulong_t *arg_val);
+    sw_error_t cmd_show_acl_rule(a_ulong_t *arg_val);
 /*qca808x_start*/
 #ifdef __cplusplus
 }
@@ -19,6 +19,242 @@
 #include "sw_api.h"
 #include "sw_api_us.h"
 #include "api_access.h"
+#include "fal_uk_if.h"
+
+#define SW_UK_PIPE_BUF     (8 * SW_MAX_API_BUF)
+
+/* calls without output parameters queued by the pipeline mode */
+static struct
+{
+    a_bool_t            enable;
+    a_uint32_t          tag;
+    a_uint32_t          nr_call;
+    a_uint32_t          buf_used;
+    sw_uk_pipe_err_func err_func;
+    a_uint32_t          tags[SW_API_BATCH_MAX];
+    unsigned long       rtn[SW_API_BATCH_MAX];
+    unsigned long       args[SW_API_BATCH_MAX][SW_MAX_API_PARAM];
+    unsigned long       buf[SW_UK_PIPE_BUF / sizeof(unsigned long)];
+} uk_pipe;
+
+/* cleared once the transport turns out not to support batch messages */
+static a_bool_t uk_batch_support = A_TRUE;
+
+static sw_error_t
+sw_uk_chain(unsigned long *prev, unsigned long *cur)
+{
+    a_uint32_t i, chain = SW_PARAM_PTR | SW_PARAM_IN | SW_PARAM_OUT;
+    sw_api_param_t *pp, *cp;
+    sw_api_t prev_api, cur_api;
+
+    prev_api.api_id = prev[0];
+    SW_RTN_ON_ERROR(sw_api_get(&prev_api));
+    cur_api.api_id = cur[0];
+    SW_RTN_ON_ERROR(sw_api_get(&cur_api));
+
+    if (prev_api.api_nr != cur_api.api_nr)
+    {
+        return SW_BAD_PARAM;
+    }
+
+    for (i = 0; i < cur_api.api_nr; i++)
+    {
+        pp = prev_api.api_pp + i;
+        cp = cur_api.api_pp + i;
+        if ((pp->param_type != cp->param_type) || (pp->data_size != cp->data_size))
+        {
+            return SW_BAD_PARAM;
+        }
+
+        if ((cp->param_type & chain) == chain)
+        {
+            aos_mem_copy((void *)cur[i + 2], (void *)prev[i + 2], cp->data_size);
+        }
+    }
+
+    return SW_OK;
+}
+
+sw_error_t
+sw_uk_exec_batch(unsigned long (*calls)[SW_MAX_API_PARAM], a_uint32_t nr_call,
+                 a_uint32_t flags, a_uint32_t *nr_done)
+{
+    sw_error_t rv;
+    a_uint32_t i;
+
+    if (nr_call > SW_API_BATCH_MAX)
+    {
+        return SW_OUT_OF_RANGE;
+    }
+
+    *nr_done = 0;
+    sw_uk_pipe_flush();
+
+    if (uk_batch_support)
+    {
+        rv = sw_uk_if_batch(calls, nr_call, flags, nr_done);
+        if (SW_NOT_SUPPORTED != rv)
+        {
+            return rv;
+        }
+        uk_batch_support = A_FALSE;
+    }
+
+    /* one round trip per call, same semantics as the batch message */
+    for (i = 0; i < nr_call; i++)
+    {
+        rv = SW_OK;
+        if ((flags & SW_API_BATCH_CHAIN) && i)
+        {
+            rv = sw_uk_chain(calls[i - 1], calls[i]);
+        }
+
+        if (SW_OK == rv)
+        {
+            sw_uk_if(calls[i]);
+        }
+        else
+        {
+            *(unsigned long *)calls[i][1] = rv;
+        }
+
+        if ((flags & SW_API_BATCH_CHAIN) &&
+                (SW_OK != (sw_error_t) *(unsigned long *)calls[i][1]))
+        {
+            i++;
+            break;
+        }
+    }
+    *nr_done = i;
+
+    return SW_OK;
+}
+
+static a_bool_t
+sw_uk_pipe_add(unsigned long *value)
+{
+    a_uint32_t i, size, nr_word = 0;
+    sw_api_param_t *pp;
+    unsigned long *call;
+    sw_api_t sw_api;
+
+    sw_api.api_id = value[0];
+    if (SW_OK != sw_api_get(&sw_api))
+    {
+        return A_FALSE;
+    }
+
+    /* anything reporting data back has to run now */
+    for (i = 0, pp = sw_api.api_pp; i < sw_api.api_nr; i++, pp++)
+    {
+        if (pp->param_type & SW_PARAM_OUT)
+        {
+            return A_FALSE;
+        }
+        if (pp->param_type & SW_PARAM_PTR)
+        {
+            nr_word += (pp->data_size + sizeof(unsigned long) - 1) / sizeof(unsigned long);
+        }
+    }
+
+    if ((uk_pipe.nr_call == SW_API_BATCH_MAX) ||
+            (uk_pipe.buf_used + nr_word > SW_UK_PIPE_BUF / sizeof(unsigned long)))
+    {
+        sw_uk_pipe_flush();
+    }
+
+    if (nr_word > SW_UK_PIPE_BUF / sizeof(unsigned long))
+    {
+        return A_FALSE;
+    }
+
+    /* the caller may reuse its buffers as soon as we return, keep a copy */
+    call = uk_pipe.args[uk_pipe.nr_call];
+    aos_mem_copy(call, value, sizeof(uk_pipe.args[0]));
+    for (i = 0, pp = sw_api.api_pp; i < sw_api.api_nr; i++, pp++)
+    {
+        if (pp->param_type & SW_PARAM_PTR)
+        {
+            size = (pp->data_size + sizeof(unsigned long) - 1) / sizeof(unsigned long);
+            aos_mem_copy(&uk_pipe.buf[uk_pipe.buf_used], (void *)value[i + 2], pp->data_size);
+            call[i + 2] = (unsigned long)&uk_pipe.buf[uk_pipe.buf_used];
+            uk_pipe.buf_used += size;
+        }
+    }
+
+    uk_pipe.rtn[uk_pipe.nr_call] = SW_OK;
+    call[1] = (unsigned long)&uk_pipe.rtn[uk_pipe.nr_call];
+    uk_pipe.tags[uk_pipe.nr_call] = uk_pipe.tag;
+    uk_pipe.nr_call++;
+
+    return A_TRUE;
+}
+
+void
+sw_uk_pipe_start(sw_uk_pipe_err_func err_func)
+{
+    sw_uk_pipe_flush();
+    uk_pipe.err_func = err_func;
+    uk_pipe.tag = 0;
+    uk_pipe.enable = A_TRUE;
+}
+
+void
+sw_uk_pipe_tag(a_uint32_t tag)
+{
+    uk_pipe.tag = tag;
+}
+
+sw_error_t
+sw_uk_pipe_flush(void)
+{
+    a_uint32_t i, nr_call = uk_pipe.nr_call, nr_done = 0;
+    sw_error_t rv = SW_OK, ret = SW_OK;
+
+    if (!nr_call)
+    {
+        return SW_OK;
+    }
+
+    /* sw_uk_exec_batch flushes first, empty the queue before calling it */
+    uk_pipe.nr_call = 0;
+    uk_pipe.buf_used = 0;
+
+    rv = sw_uk_exec_batch(uk_pipe.args, nr_call, 0, &nr_done);
+    for (i = 0; i < nr_call; i++)
+    {
+        if (i >= nr_done)
+        {
+            uk_pipe.rtn[i] = (SW_OK != rv) ? rv : SW_FAIL;
+        }
+
+        if (SW_OK != (sw_error_t) uk_pipe.rtn[i])
+        {
+            if (SW_OK == ret)
+            {
+                ret = (sw_error_t) uk_pipe.rtn[i];
+            }
+            if (uk_pipe.err_func)
+            {
+                uk_pipe.err_func(uk_pipe.tags[i], (sw_error_t) uk_pipe.rtn[i]);
+            }
+        }
+    }
+
+    return ret;
+}
+
+sw_error_t
+sw_uk_pipe_stop(void)
+{
+    sw_error_t rv;
+
+    rv = sw_uk_pipe_flush();
+    uk_pipe.enable = A_FALSE;
+    uk_pipe.err_func = NULL;
+
+    return rv;
+}
 
 sw_error_t
 sw_uk_exec(a_uint32_t api_id, ...)
@@ -42,6 +278,16 @@ sw_uk_exec(a_uint32_t api_id, ...)
         value[i + 2] = va_arg(arg_ptr, unsigned long);
     }
     va_end(arg_ptr);
+
+    if (uk_pipe.enable)
+    {
+        /* queued calls report their result through sw_uk_pipe_flush */
+        if (sw_uk_pipe_add(value))
+        {
+            return SW_OK;
+        }
+        sw_uk_pipe_flush();
+    }
     sw_uk_if(value);
 
     return rtn;
@@ -61,6 +307,7 @@ ssdk_cleanup(void)
 {
     sw_error_t rv;
 
+    sw_uk_pipe_stop();
     rv = sw_uk_cleanup();
     return rv;
 }
@@ -20,6 +20,7 @@
 #include <sys/sysmacros.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
 #include "sw.h"
 #include "sw_api.h"
 #include "sw_api_us.h"
@@ -34,6 +35,36 @@ sw_uk_if(unsigned long arg_val[SW_MAX_API_PARAM])
     return SW_OK;
 }
 
+sw_error_t
+sw_uk_if_batch(unsigned long (*calls)[SW_MAX_API_PARAM], a_uint32_t nr_call,
+               a_uint32_t flags, a_uint32_t *nr_done)
+{
+    unsigned long value[SW_MAX_API_PARAM] = { 0 };
+    unsigned long rtn = SW_OK, done = 0;
+
+    value[0] = SW_API_BATCH;
+    value[1] = (unsigned long)&rtn;
+    value[2] = nr_call;
+    value[3] = flags;
+    value[4] = (unsigned long)calls;
+    value[5] = (unsigned long)&done;
+
+    if (ioctl(glb_socket_fd, SIOCDEVPRIVATE, value) < 0)
+    {
+        if ((ENOTTY == errno) || (EOPNOTSUPP == errno))
+            return SW_NOT_SUPPORTED;
+        return SW_FAIL;
+    }
+
+    /* an older module rejects the unknown api id before running any call,
+       any other error is reported for this batch only */
+    *nr_done = done;
+    if ((SW_NOT_SUPPORTED == (sw_error_t) rtn) && !done)
+        return SW_NOT_SUPPORTED;
+
+    return rtn;
+}
+
 #ifndef SHELL_DEV
 #define SHELL_DEV "/dev/switch_ssdk"
 #endif
@@ -0,0 +1,224 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * Loopback stand-in for the ssdk module: every call is answered inside the
+ * shell with the same copy in / copy out the ioctl handler does, so the
+ * user-kernel transport can be exercised without a switch. The FDB is a
+ * synthetic table of SSDK_LOOPBACK_FDB entries (1024 by default), other
+ * calls succeed with zeroed output. SSDK_LOOPBACK_STATS prints the number
+ * of messages and calls on cleanup.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "sw.h"
+#include "sw_api.h"
+#include "sw_api_us.h"
+#include "api_access.h"
+#include "ssdk_init.h"
+#include "fal_fdb.h"
+
+#define LOOPBACK_FDB_DEF    1024
+
+static unsigned long lb_buf[SW_MAX_API_BUF / sizeof(unsigned long)];
+static a_uint32_t lb_fdb_nr = LOOPBACK_FDB_DEF;
+static a_uint32_t lb_nr_msg = 0, lb_nr_call = 0;
+
+static sw_error_t
+lb_fdb_entry(a_uint32_t idx, fal_fdb_entry_t *entry)
+{
+    if (idx >= lb_fdb_nr)
+        return SW_NO_MORE;
+
+    aos_mem_zero(entry, sizeof(fal_fdb_entry_t));
+    entry->addr.uc[1] = 0x03;
+    entry->addr.uc[2] = 0x7f;
+    entry->addr.uc[3] = (idx >> 16) & 0xff;
+    entry->addr.uc[4] = (idx >> 8) & 0xff;
+    entry->addr.uc[5] = idx & 0xff;
+    entry->fid = 1;
+    entry->dacmd = FAL_MAC_FRWRD;
+    entry->sacmd = FAL_MAC_FRWRD;
+    entry->portmap_en = A_TRUE;
+    entry->port.map = 1 << (1 + idx % 6);
+    entry->entry_valid = A_TRUE;
+
+    return SW_OK;
+}
+
+static sw_error_t
+lb_fdb_next(fal_fdb_entry_t *entry)
+{
+    a_uint32_t idx;
+
+    idx = (entry->addr.uc[3] << 16) | (entry->addr.uc[4] << 8) | entry->addr.uc[5];
+    return lb_fdb_entry(idx + 1, entry);
+}
+
+static sw_error_t
+lb_api_cmd(unsigned long *args, unsigned long *p)
+{
+    ssdk_cfg_t *cfg;
+
+    switch (args[0])
+    {
+        case SW_API_SSDK_CFG:
+            cfg = (ssdk_cfg_t *) p[1];
+            cfg->init_cfg.chip_type = CHIP_HPPE;
+            return SW_OK;
+        case SW_API_FDB_EXTEND_FIRST:
+            return lb_fdb_entry(0, (fal_fdb_entry_t *) p[2]);
+        case SW_API_FDB_EXTEND_NEXT:
+            return lb_fdb_next((fal_fdb_entry_t *) p[2]);
+        default:
+            return SW_OK;
+    }
+}
+
+static sw_error_t
+lb_call(unsigned long *args)
+{
+    a_uint32_t i, size, buf_head;
+    unsigned long p[SW_MAX_API_PARAM] = { 0 };
+    sw_api_param_t *pp;
+    sw_api_t sw_api;
+    sw_error_t rv;
+
+    lb_nr_call++;
+
+    sw_api.api_id = args[0];
+    SW_RTN_ON_ERROR(sw_api_get(&sw_api));
+
+    /* same parameter staging as input_parser/output_parser in the module */
+    aos_mem_zero(lb_buf, sizeof(lb_buf));
+    buf_head = 0;
+    for (i = 0, pp = sw_api.api_pp; i < sw_api.api_nr; i++, pp++)
+    {
+        if (!(pp->param_type & SW_PARAM_PTR))
+        {
+            p[i] = args[i + 2];
+            continue;
+        }
+
+        size = (pp->data_size + sizeof(unsigned long) - 1) / sizeof(unsigned long);
+        if (buf_head + size > SW_MAX_API_BUF / sizeof(unsigned long))
+            return SW_NO_RESOURCE;
+
+        p[i] = (unsigned long) &lb_buf[buf_head];
+        buf_head += size;
+        if (pp->param_type & SW_PARAM_IN)
+            aos_mem_copy((void *) p[i], (void *) args[i + 2], pp->data_size);
+    }
+
+    rv = lb_api_cmd(args, p);
+    SW_RTN_ON_ERROR(rv);
+
+    for (i = 0, pp = sw_api.api_pp; i < sw_api.api_nr; i++, pp++)
+    {
+        if ((pp->param_type & SW_PARAM_PTR) && (pp->param_type & SW_PARAM_OUT))
+            aos_mem_copy((void *) args[i + 2], (void *) p[i], pp->data_size);
+    }
+
+    return SW_OK;
+}
+
+static sw_error_t
+lb_chain(unsigned long *prev, unsigned long *cur)
+{
+    a_uint32_t i, chain = SW_PARAM_PTR | SW_PARAM_IN | SW_PARAM_OUT;
+    sw_api_param_t *pp, *cp;
+    sw_api_t prev_api, cur_api;
+
+    prev_api.api_id = prev[0];
+    SW_RTN_ON_ERROR(sw_api_get(&prev_api));
+    cur_api.api_id = cur[0];
+    SW_RTN_ON_ERROR(sw_api_get(&cur_api));
+
+    if (prev_api.api_nr != cur_api.api_nr)
+        return SW_BAD_PARAM;
+
+    for (i = 0; i < cur_api.api_nr; i++)
+    {
+        pp = prev_api.api_pp + i;
+        cp = cur_api.api_pp + i;
+        if ((pp->param_type != cp->param_type) || (pp->data_size != cp->data_size))
+            return SW_BAD_PARAM;
+
+        if ((cp->param_type & chain) == chain)
+            aos_mem_copy((void *) cur[i + 2], (void *) prev[i + 2], cp->data_size);
+    }
+
+    return SW_OK;
+}
+
+static void
+lb_msg(void)
+{
+    /* one real kernel crossing per message, as the ioctl would cost */
+    lb_nr_msg++;
+    syscall(SYS_getppid);
+}
+
+sw_error_t
+sw_uk_if(unsigned long arg_val[SW_MAX_API_PARAM])
+{
+    lb_msg();
+    *(unsigned long *) arg_val[1] = lb_call(arg_val);
+    return SW_OK;
+}
+
+sw_error_t
+sw_uk_if_batch(unsigned long (*calls)[SW_MAX_API_PARAM], a_uint32_t nr_call,
+               a_uint32_t flags, a_uint32_t *nr_done)
+{
+    sw_error_t rv;
+    a_uint32_t i;
+
+    if (nr_call > SW_API_BATCH_MAX)
+        return SW_OUT_OF_RANGE;
+
+    lb_msg();
+    for (i = 0; i < nr_call; i++)
+    {
+        rv = SW_OK;
+        if ((flags & SW_API_BATCH_CHAIN) && i)
+            rv = lb_chain(calls[i - 1], calls[i]);
+
+        if (SW_OK == rv)
+            rv = lb_call(calls[i]);
+        *(unsigned long *) calls[i][1] = rv;
+
+        if ((SW_OK != rv) && (flags & SW_API_BATCH_CHAIN))
+        {
+            i++;
+            break;
+        }
+    }
+    *nr_done = i;
+
+    return SW_OK;
+}
+
+sw_error_t
+sw_uk_init(a_uint32_t nl_prot)
+{
+    char *fdb_nr = getenv("SSDK_LOOPBACK_FDB");
+
+    if (fdb_nr)
+        lb_fdb_nr = strtoul(fdb_nr, NULL, 0);
+    lb_nr_msg = 0;
+    lb_nr_call = 0;
+
+    return SW_OK;
+}
+
+sw_error_t
+sw_uk_cleanup(void)
+{
+    if (getenv("SSDK_LOOPBACK_STATS"))
+        printf("loopback: %u messages, %u calls\n", lb_nr_msg, lb_nr_call);
+
+    return SW_OK;
+}
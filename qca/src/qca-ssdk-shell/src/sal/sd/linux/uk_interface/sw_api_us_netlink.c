@@ -226,3 +226,10 @@ sw_uk_cleanup(void)
     return SW_OK;
 }
 
+sw_error_t
+sw_uk_if_batch(unsigned long (*calls)[SW_MAX_API_PARAM], a_uint32_t nr_call,
+               a_uint32_t flags, a_uint32_t *nr_done)
+{
+    /* the netlink message carries a single call, fal_uk falls back to sw_uk_if */
+    return SW_NOT_SUPPORTED;
+}
@@ -225,6 +225,31 @@ cmd_api_output(sw_api_param_t *pp, a_uint32_t nr_param, a_ulong_t * args)
     return SW_OK;
 }
 
+/* print an output parameter of a call made outside cmd_exec_api */
+sw_error_t
+cmd_api_show(a_uint32_t api_id, a_uint32_t index, void *buf)
+{
+    sw_data_type_t *data_type;
+    sw_api_param_t *pptmp;
+    sw_api_t sw_api;
+
+    sw_api.api_id = api_id;
+    SW_RTN_ON_ERROR(sw_api_get(&sw_api));
+    if (index >= sw_api.api_nr)
+        return SW_OUT_OF_RANGE;
+
+    pptmp = sw_api.api_pp + index;
+    if (!(data_type = cmd_data_type_find(pptmp->data_type)))
+        return SW_NO_SUCH;
+
+    if (data_type->show_func)
+        data_type->show_func(pptmp->param_name, buf, pptmp->data_size);
+    else
+        dprintf("\n Error, not define output print function!");
+
+    return SW_OK;
+}
+
 void
 cmd_strtol(char *str, a_uint32_t * arg_val)
 {
@@ -351,7 +376,8 @@ cmd_parse_sw(char **cmd_str, a_ulong_t * arg_val)
                               api_id == SW_CMD_INTFMAC_SHOW ||
                               api_id == SW_CMD_PUBADDR_SHOW )) ||
 		    ( arg_index == 1 && api_id == SW_CMD_SET_DEVID) ||
-		    ( arg_index == 2 && api_id == SW_CMD_PT_VLAN_TRANS_ADV_SHOW) )
+		    ( arg_index == 2 && api_id == SW_CMD_PT_VLAN_TRANS_ADV_SHOW) ||
+		    ( arg_index == 3 && api_id == SW_CMD_ACL_RULE_SHOW) )
         return SW_OK;
 
     return SW_BAD_PARAM;
@@ -670,6 +696,12 @@ cmd_is_batch(const char *cmd_str)
     return 0;
 }
 
+static void
+cmd_batch_error(a_uint32_t line_nr, sw_error_t rtn)
+{
+    dprintf("line %d: %s\n", line_nr, err_info[abs(rtn)]);
+}
+
 static void
 cmd_batch_help(void)
 {
@@ -712,10 +744,15 @@ cmd_run_batch (char *cmd_str)
 
     size_t len = 0;
     ssize_t read;
+    a_uint32_t line_nr = 0;
 
     set_talk_mode(0);
+    /* set commands are sent to the switch in batches, failures show up
+       with their line number once the batch has run */
+    sw_uk_pipe_start(cmd_batch_error);
     while ((read = getline(&line, &len, in_fd)) != -1)
     {
+        line_nr++;
         //dprintf("(%d)%s",read, line);
         if (read <= 1 )
 	{
@@ -736,8 +773,10 @@ cmd_run_batch (char *cmd_str)
         {
             dprintf("%s\n", line);
         }
+        sw_uk_pipe_tag(line_nr);
         cmd_run_one(line);
     }
+    sw_uk_pipe_stop();
     set_talk_mode(1);
 
     if (line) free(line);
@@ -13,8 +13,10 @@
  */
 /*qca808x_start*/
 #include <stdio.h>
+#include <stdlib.h>
 #include "shell.h"
 #include "fal.h"
+#include "fal_uk_if.h"
 
 static int sw_devid = 0;
 
@@ -53,71 +55,88 @@ set_devid(int dev_id)
 	return SW_OK;
 }
 /*qca808x_end*/
-sw_error_t
-cmd_show_fdb(a_ulong_t *arg_val)
+/* walk the FDB with chained getnext calls, SW_API_BATCH_MAX entries per
+   round trip, the output matches one cmd_exec_api call per entry */
+static void
+cmd_show_fdb_extend(void)
 {
-    if (ssdk_cfg.init_cfg.chip_type == CHIP_ISIS) {
-	    sw_error_t rtn;
-	    a_uint32_t cnt = 0;
-	    fal_fdb_op_t    *fdb_op    = (fal_fdb_op_t *)    (ioctl_buf + sizeof(sw_error_t) / 4);
-	    fal_fdb_entry_t *fdb_entry = (fal_fdb_entry_t *) (ioctl_buf + sizeof(sw_error_t) / 4 + sizeof(fal_fdb_op_t) / 4);
+    unsigned long calls[SW_API_BATCH_MAX][SW_MAX_API_PARAM];
+    unsigned long rtn[SW_API_BATCH_MAX];
+    fal_fdb_entry_t *fdb_entry;
+    fal_fdb_op_t fdb_op;
+    a_uint32_t i, nr_done, cnt = 0;
+    a_uint32_t api_id = SW_API_FDB_EXTEND_FIRST;
+    sw_error_t rv = SW_OK;
+
+    fdb_entry = malloc(SW_API_BATCH_MAX * sizeof (fal_fdb_entry_t));
+    if (!fdb_entry)
+    {
+        cmd_print_error(SW_OUT_OF_MEM);
+        return;
+    }
 
-	    aos_mem_zero(fdb_op,    sizeof (fal_fdb_op_t));
-	    aos_mem_zero(fdb_entry, sizeof (fal_fdb_entry_t));
-	    arg_val[0] = SW_API_FDB_EXTEND_FIRST;
+    aos_mem_zero(&fdb_op, sizeof (fal_fdb_op_t));
+    aos_mem_zero(fdb_entry, sizeof (fal_fdb_entry_t));
 
-	    while (1)
-	    {
-	        arg_val[1] = (a_ulong_t) ioctl_buf;
-	        arg_val[2] = get_devid();
-	        arg_val[3] = (a_ulong_t) fdb_op;
-	        arg_val[4] = (a_ulong_t) fdb_entry;
+    while (SW_OK == rv)
+    {
+        for (i = 0; i < SW_API_BATCH_MAX; i++)
+        {
+            calls[i][0] = i ? SW_API_FDB_EXTEND_NEXT : api_id;
+            calls[i][1] = (unsigned long) &rtn[i];
+            calls[i][2] = get_devid();
+            calls[i][3] = (unsigned long) &fdb_op;
+            calls[i][4] = (unsigned long) &fdb_entry[i];
+            rtn[i] = SW_OK;
+        }
 
-	        rtn = cmd_exec_api(arg_val);
-	        if ((SW_OK != rtn)  || (SW_OK != (sw_error_t) (*ioctl_buf)))
-	        {
-	            break;
-	        }
-	        arg_val[0] = SW_API_FDB_EXTEND_NEXT;
-	        cnt++;
-	    }
+        rv = sw_uk_exec_batch(calls, SW_API_BATCH_MAX, SW_API_BATCH_CHAIN, &nr_done);
+        if (SW_OK != rv)
+        {
+            break;
+        }
 
-	    if((rtn != SW_OK) && (rtn != SW_NO_MORE))
-	        cmd_print_error(rtn);
-	    else
-	        dprintf("\ntotal %d entries\n", cnt);
-    }else if ((ssdk_cfg.init_cfg.chip_type == CHIP_ISISC) ||
-               (ssdk_cfg.init_cfg.chip_type == CHIP_DESS) ||
-               (ssdk_cfg.init_cfg.chip_type == CHIP_HPPE)) {
-	    sw_error_t rtn;
-	    a_uint32_t cnt = 0;
-	    fal_fdb_op_t    *fdb_op    = (fal_fdb_op_t *)    (ioctl_buf + sizeof(sw_error_t) / 4);
-	    fal_fdb_entry_t *fdb_entry = (fal_fdb_entry_t *) (ioctl_buf + sizeof(sw_error_t) / 4 + sizeof(fal_fdb_op_t) / 4);
+        for (i = 0; (i < nr_done) && (SW_OK == rv); i++)
+        {
+            rv = (sw_error_t) rtn[i];
+            if (SW_OK != rv)
+            {
+                cmd_print_error(rv);
+                break;
+            }
+            cmd_api_show(SW_API_FDB_EXTEND_NEXT, 2, &fdb_entry[i]);
+            cnt++;
+        }
 
-	    aos_mem_zero(fdb_op,    sizeof (fal_fdb_op_t));
-	    aos_mem_zero(fdb_entry, sizeof (fal_fdb_entry_t));
-	    arg_val[0] = SW_API_FDB_EXTEND_FIRST;
+        if ((SW_OK == rv) && (nr_done < SW_API_BATCH_MAX))
+        {
+            rv = SW_FAIL;
+        }
 
-	    while (1)
-	    {
-	        arg_val[1] = (a_ulong_t) ioctl_buf;
-	        arg_val[2] = get_devid();
-	        arg_val[3] = (a_ulong_t) fdb_op;
-	        arg_val[4] = (a_ulong_t) fdb_entry;
+        /* the last entry seeds the next round */
+        if (nr_done)
+        {
+            fdb_entry[0] = fdb_entry[nr_done - 1];
+        }
+        api_id = SW_API_FDB_EXTEND_NEXT;
+    }
+    free(fdb_entry);
 
-	        rtn = cmd_exec_api(arg_val);
-	        if ((SW_OK != rtn)  || (SW_OK != (sw_error_t) (*ioctl_buf)))
-	        {
-	            break;
-	        }
-	        arg_val[0] = SW_API_FDB_EXTEND_NEXT;
-	        cnt++;
-	    }
+    if((rv != SW_OK) && (rv != SW_NO_MORE))
+        cmd_print_error(rv);
+    else
+        dprintf("\ntotal %d entries\n", cnt);
+}
 
-	    if((rtn != SW_OK) && (rtn != SW_NO_MORE))
-	        cmd_print_error(rtn);
-	    else
-	        dprintf("\ntotal %d entries\n", cnt);
+sw_error_t
+cmd_show_fdb(a_ulong_t *arg_val)
+{
+    if (ssdk_cfg.init_cfg.chip_type == CHIP_ISIS) {
+	    cmd_show_fdb_extend();
+    }else if ((ssdk_cfg.init_cfg.chip_type == CHIP_ISISC) ||
+               (ssdk_cfg.init_cfg.chip_type == CHIP_DESS) ||
+               (ssdk_cfg.init_cfg.chip_type == CHIP_HPPE)) {
+	    cmd_show_fdb_extend();
     }else if (ssdk_cfg.init_cfg.chip_type == CHIP_SHIVA) {
 	    sw_error_t rtn;
 	    a_uint32_t cnt = 0;
@@ -686,6 +705,68 @@ cmd_show_flow(a_ulong_t *arg_val)
     return SW_OK;
 }
 
+sw_error_t
+cmd_show_acl_rule(a_ulong_t *arg_val)
+{
+    unsigned long calls[SW_API_BATCH_MAX][SW_MAX_API_PARAM];
+    unsigned long rtn[SW_API_BATCH_MAX];
+    fal_acl_rule_t *rule;
+    a_uint32_t list_id, rule_id, rule_nr;
+    a_uint32_t i, nr_call, nr_done, cnt = 0;
+    sw_error_t rv = SW_OK;
+
+    list_id = arg_val[1];
+    rule_id = arg_val[2];
+    rule_nr = arg_val[3];
+
+    rule = malloc(SW_API_BATCH_MAX * sizeof (fal_acl_rule_t));
+    if (!rule)
+    {
+        return SW_OUT_OF_MEM;
+    }
+
+    /* one round trip queries up to SW_API_BATCH_MAX rules, holes are skipped */
+    while (rule_nr && (SW_OK == rv))
+    {
+        nr_call = (rule_nr > SW_API_BATCH_MAX) ? SW_API_BATCH_MAX : rule_nr;
+        aos_mem_zero(rule, nr_call * sizeof (fal_acl_rule_t));
+        for (i = 0; i < nr_call; i++)
+        {
+            calls[i][0] = SW_API_ACL_RULE_QUERY;
+            calls[i][1] = (unsigned long) &rtn[i];
+            calls[i][2] = get_devid();
+            calls[i][3] = list_id;
+            calls[i][4] = rule_id + i;
+            calls[i][5] = (unsigned long) &rule[i];
+            rtn[i] = SW_OK;
+        }
+
+        rv = sw_uk_exec_batch(calls, nr_call, 0, &nr_done);
+        for (i = 0; (SW_OK == rv) && (i < nr_done); i++)
+        {
+            if (SW_OK == (sw_error_t) rtn[i])
+            {
+                dprintf("\n[rule_id]:%d", rule_id + i);
+                cmd_api_show(SW_API_ACL_RULE_QUERY, 3, &rule[i]);
+                cnt++;
+            }
+            else if (SW_NOT_FOUND != (sw_error_t) rtn[i])
+            {
+                rv = (sw_error_t) rtn[i];
+            }
+        }
+
+        rule_id += nr_call;
+        rule_nr -= nr_call;
+    }
+    free(rule);
+
+    SW_RTN_ON_ERROR(rv);
+    dprintf("\ntotal %d rules\n", cnt);
+
+    return SW_OK;
+}
+
 sw_error_t
 cmd_show_ptvlan_entry(a_ulong_t *arg_val)
 {
@@ -31,6 +31,9 @@ extern "C" {
 #define SW_PARAM_OUT           0x2
 #define SW_PARAM_PTR           0x4
 
+#define SW_API_BATCH_MAX       64   /* calls carried by one batch message */
+#define SW_API_BATCH_CHAIN     0x1  /* IN|OUT pointers of call n feed call n+1, stop on error */
+
 #define SW_API_DEF(ioctl, name) {ioctl, name}
 
 #define SW_PARAM_DEF(ioctl, data, size, type, name) {ioctl, size, data, type}
@@ -981,6 +981,9 @@ extern "C" {
 #define SW_API_PHY_I2C_SET                (23  + SW_API_DEBUG_OFFSET)
 
 #define SW_API_MAX                 0xffff
+/* batch message: args[2] = call count, args[3] = SW_API_BATCH_* flags,
+ * args[4] = call blocks of SW_MAX_API_PARAM words, args[5] = calls done */
+#define SW_API_BATCH               (SW_API_MAX - 1)
 
 #ifdef __cplusplus
 }
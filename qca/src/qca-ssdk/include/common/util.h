@@ -35,20 +35,27 @@ extern "C" {
 
     typedef void (*ll_nd_dump) (void *data);
 
+    /* LL_IN_ORDER lists are kept as an AVL tree, others as a plain list */
     typedef struct _sll_node_t
     {
         struct _sll_node_t *next;
+        struct _sll_node_t *left;
+        struct _sll_node_t *right;
+        struct _sll_node_t *parent;
+        a_int32_t height;
         void *data;
     } sll_node_t;
 
     typedef struct
     {
         sll_node_t *fst_nd;
+        sll_node_t *root;
         a_uint32_t nd_nr;
         a_uint32_t flag;
         ll_nd_cmp nd_cmp;
         ll_nd_dump nd_dump;
         sll_node_t *free_nd;
+        aos_lock_t lock;
     } sll_head_t;
 
     sll_head_t *sll_creat(ll_nd_cmp cmp_func, ll_nd_dump dump_func,
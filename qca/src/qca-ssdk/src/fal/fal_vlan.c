@@ -53,16 +53,19 @@ _fal_vlan_search(a_uint32_t dev_id, fal_vlan_t * vlan_entry)
         return SW_NOT_FOUND;
     }
 
+    sll_lock(vlan_list[dev_id]);
     v_tbl.entry = * vlan_entry;
     p_tbl = sll_nd_find(vlan_list[dev_id], &v_tbl, &iterator);
 
     if (NULL == p_tbl)
     {
+        sll_unlock(vlan_list[dev_id]);
         return SW_NOT_FOUND;
     }
     else
     {
         * vlan_entry = p_tbl->entry;
+        sll_unlock(vlan_list[dev_id]);
         return SW_OK;
     }
 }
@@ -132,18 +135,22 @@ _fal_vlan_del(a_uint32_t dev_id, a_uint16_t vlan_id)
         return SW_OK;
     }
 
+    sll_lock(vlan_list[dev_id]);
     ent.entry.vid = vlan_id;
     p_tbl = sll_nd_find(vlan_list[dev_id], &ent, &iterator);
     if (NULL == p_tbl)
     {
+        sll_unlock(vlan_list[dev_id]);
         return SW_NOT_FOUND;
     }
     id = p_tbl->idx;
 
     rv = sll_nd_delete(vlan_list[dev_id], p_tbl);
-    SW_RTN_ON_ERROR(rv);
-
-    rv = sid_pool_id_free(vlan_pool[dev_id], id);
+    if (SW_OK == rv)
+    {
+        rv = sid_pool_id_free(vlan_pool[dev_id], id);
+    }
+    sll_unlock(vlan_list[dev_id]);
     return rv;
 }
 
@@ -163,13 +170,23 @@ _fal_vlan_creat(a_uint32_t dev_id, const fal_vlan_t * vlan_entry)
         return SW_OK;
     }
 
+    sll_lock(vlan_list[dev_id]);
     rv = sid_pool_id_alloc(vlan_pool[dev_id], &id);
-    SW_RTN_ON_ERROR(rv);
+    if (SW_OK != rv)
+    {
+        sll_unlock(vlan_list[dev_id]);
+        return rv;
+    }
 
     v_tbl = &vlan_db[dev_id][id];
     v_tbl->idx   = id;
     v_tbl->entry = *vlan_entry;
     rv = sll_nd_insert(vlan_list[dev_id], v_tbl);
+    if (SW_OK != rv)
+    {
+        (void) sid_pool_id_free(vlan_pool[dev_id], id);
+    }
+    sll_unlock(vlan_list[dev_id]);
     return rv;
 }
 
@@ -120,22 +120,77 @@ _hsl_acl_blk_dump(a_uint32_t dev_id, const char *info)
 #define _hsl_acl_blk_dump(dev_id, info)
 #endif
 
+/* blocks are kept in address order, so both lookups are binary searches */
 static sw_error_t
 _hsl_acl_blk_loc(a_uint32_t dev_id, a_uint32_t addr, a_uint32_t * idx)
 {
-    a_uint32_t i;
+    a_uint32_t lo, hi, mid;
+    hsl_acl_blk_t *blk = acl_pool[dev_id].blk_ent;
 
-    for (i = 0; i < acl_pool[dev_id].used_blk; i++)
+    lo = 0;
+    hi = acl_pool[dev_id].used_blk;
+    while (lo < hi)
     {
-        if (addr == acl_pool[dev_id].blk_ent[i].addr)
+        mid = (lo + hi) >> 1;
+        if (addr == blk[mid].addr)
         {
-            *idx = i;
+            /* an empty block may share the address, take the first one */
+            while ((0 != mid) && (addr == blk[mid - 1].addr))
+            {
+                mid--;
+            }
+            *idx = mid;
             return SW_OK;
         }
+
+        if (addr < blk[mid].addr)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
     }
     return SW_NOT_FOUND;
 }
 
+/* index of the first used block with priority not lower than pri */
+static a_uint32_t
+_hsl_acl_blk_pri_loc(a_uint32_t dev_id, a_uint32_t pri)
+{
+    a_uint32_t lo, hi, mid, i;
+    hsl_acl_blk_t *blk = acl_pool[dev_id].blk_ent;
+
+    /* search on the first used block at or behind each index */
+    lo = 0;
+    hi = acl_pool[dev_id].used_blk;
+    while (lo < hi)
+    {
+        mid = (lo + hi) >> 1;
+        i = mid;
+        while ((i < acl_pool[dev_id].used_blk) && (MEM_FREE == blk[i].status))
+        {
+            i++;
+        }
+
+        if ((i == acl_pool[dev_id].used_blk) || (pri <= blk[i].pri))
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+
+    while ((lo < acl_pool[dev_id].used_blk) && (MEM_FREE == blk[lo].status))
+    {
+        lo++;
+    }
+    return lo;
+}
+
 static sw_error_t
 _hsl_acl_blk_comb(a_uint32_t dev_id, a_uint32_t idx, a_uint32_t nr)
 {
@@ -753,31 +808,12 @@ hsl_acl_blk_alloc(a_uint32_t dev_id, a_uint32_t pri, a_uint32_t size,
 
     blk_nr = acl_pool[dev_id].used_blk;
 
-    p_idx       = 0;
+    /* used blocks are ordered by priority */
+    p_idx       = _hsl_acl_blk_pri_loc(dev_id, pri);
     prev_f_s    = 0;
     largest_f_s = 0;
     largest_idx = 0;
 
-    for (i = 0; i < blk_nr; i++)
-    {
-        if (MEM_FREE == acl_pool[dev_id].blk_ent[i].status)
-        {
-            prev_f_s += acl_pool[dev_id].blk_ent[i].size;
-            continue;
-        }
-
-        p_idx = i;
-        if (pri <= acl_pool[dev_id].blk_ent[i].pri)
-        {
-            break;
-        }
-    }
-
-    if (i == blk_nr)
-    {
-        p_idx = blk_nr;
-    }
-
     for (i = p_idx; i < blk_nr; i++)
     {
         if (MEM_FREE == acl_pool[dev_id].blk_ent[i].status)
@@ -796,6 +832,18 @@ hsl_acl_blk_alloc(a_uint32_t dev_id, a_uint32_t pri, a_uint32_t size,
         }
     }
 
+    /* free space ahead of p_idx only matters when defrag is needed */
+    if (largest_f_s < size)
+    {
+        for (i = 0; i < p_idx; i++)
+        {
+            if (MEM_FREE == acl_pool[dev_id].blk_ent[i].status)
+            {
+                prev_f_s += acl_pool[dev_id].blk_ent[i].size;
+            }
+        }
+    }
+
     if (largest_f_s >= size)
     {
         rv = _hsl_acl_blk_alloc(dev_id, largest_idx, pri, size, info,
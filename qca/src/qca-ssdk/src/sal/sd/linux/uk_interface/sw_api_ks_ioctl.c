@@ -225,6 +225,111 @@ out:
     return rv;
 }
 
+static sw_error_t
+sw_api_chain(unsigned long prev_id, unsigned long *args)
+{
+    a_uint32_t i, size;
+    a_uint32_t offset = sizeof(unsigned long);
+    a_uint32_t credit = sizeof(unsigned long) - 1;
+    a_uint32_t chain = SW_PARAM_PTR | SW_PARAM_IN | SW_PARAM_OUT;
+    sw_api_param_t *pp, *cp;
+    sw_api_t prev, cur;
+
+    prev.api_id = prev_id;
+    SW_RTN_ON_ERROR(sw_api_get(&prev));
+    cur.api_id = args[0];
+    SW_RTN_ON_ERROR(sw_api_get(&cur));
+
+    if (prev.api_nr != cur.api_nr)
+    {
+        return SW_BAD_PARAM;
+    }
+
+    /* cmd_buf still holds the result of the previous call, hand its
+       IN|OUT pointer parameters over as the input of this one */
+    for (i = 0; i < cur.api_nr; i++)
+    {
+        pp = prev.api_pp + i;
+        cp = cur.api_pp + i;
+        if ((pp->param_type != cp->param_type) || (pp->data_size != cp->data_size))
+        {
+            return SW_BAD_PARAM;
+        }
+
+        if ((cp->param_type & chain) != chain)
+        {
+            continue;
+        }
+
+        size = ((cp->data_size + credit) / offset) * offset;
+        if (copy_to_user((void __USER *) args[i + 2], (unsigned long *) cmd_buf[i], size))
+        {
+            SSDK_ERROR("copy_to_user fail\n");
+            return SW_NO_RESOURCE;
+        }
+    }
+
+    return SW_OK;
+}
+
+static sw_error_t
+sw_api_batch(unsigned long *hdr)
+{
+    unsigned long args[SW_MAX_API_PARAM], rtn, prev_id = 0;
+    unsigned long nr_call = hdr[2], flags = hdr[3], nr_done;
+    unsigned long __USER *calls = (unsigned long __USER *) hdr[4];
+    sw_error_t rv, ret = SW_OK;
+
+    if (nr_call > SW_API_BATCH_MAX)
+    {
+        return SW_OUT_OF_RANGE;
+    }
+
+    for (nr_done = 0; nr_done < nr_call; nr_done++)
+    {
+        if (copy_from_user(args, calls + nr_done * SW_MAX_API_PARAM, sizeof (args)))
+        {
+            SSDK_ERROR("copy_from_user fail\n");
+            ret = SW_NO_RESOURCE;
+            break;
+        }
+
+        rv = SW_OK;
+        if ((flags & SW_API_BATCH_CHAIN) && nr_done)
+        {
+            rv = sw_api_chain(prev_id, args);
+        }
+        if (SW_OK == rv)
+        {
+            rv = sw_api_cmd(args);
+        }
+        prev_id = args[0];
+
+        rtn = (unsigned long) rv;
+        if (copy_to_user((void __USER *) args[1], &rtn, sizeof (unsigned long)))
+        {
+            SSDK_ERROR("copy_to_user fail\n");
+            ret = SW_NO_RESOURCE;
+            break;
+        }
+
+        if ((SW_OK != rv) && (flags & SW_API_BATCH_CHAIN))
+        {
+            nr_done++;
+            break;
+        }
+    }
+
+    if (copy_to_user((void __USER *) hdr[5], &nr_done, sizeof (unsigned long)))
+    {
+        SSDK_ERROR("copy_to_user fail\n");
+        return SW_NO_RESOURCE;
+    }
+
+    /* per call results are reported through their own return slot */
+    return ret;
+}
+
 static int
 switch_open(struct inode * inode,struct file * file)
 {
@@ -257,7 +362,10 @@ switch_ioctl(struct inode *inode, struct file * file, unsigned int cmd, unsigned
     }
 
     mutex_lock(&api_ioctl_lock);
-    rv = sw_api_cmd(args);
+    if (SW_API_BATCH == args[0])
+        rv = sw_api_batch(args);
+    else
+        rv = sw_api_cmd(args);
     mutex_unlock(&api_ioctl_lock);
 
     /* return API result to user */
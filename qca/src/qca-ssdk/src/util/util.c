@@ -63,6 +63,49 @@ sll_nd_free(sll_head_t * sll, sll_node_t * nd)
     return;
 }
 
+static sll_node_t *
+sll_nd_first(const sll_head_t * sll)
+{
+    sll_node_t *node;
+
+    if (0 == (sll->flag & LL_IN_ORDER))
+    {
+        return sll->fst_nd;
+    }
+
+    node = sll->root;
+    while ((NULL != node) && (NULL != node->left))
+    {
+        node = node->left;
+    }
+    return node;
+}
+
+static sll_node_t *
+sll_nd_succ(const sll_head_t * sll, sll_node_t * node)
+{
+    if (0 == (sll->flag & LL_IN_ORDER))
+    {
+        return node->next;
+    }
+
+    if (NULL != node->right)
+    {
+        node = node->right;
+        while (NULL != node->left)
+        {
+            node = node->left;
+        }
+        return node;
+    }
+
+    while ((NULL != node->parent) && (node == node->parent->right))
+    {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
 //#define SLL_DENUG
 #ifdef SLL_DENUG
 static void
@@ -76,17 +119,157 @@ sll_nd_dump(sll_head_t * sll, const char * info)
     }
 
     aos_printk("\n%s    node number = %d\n", info, sll->nd_nr);
-    curr = sll->fst_nd;
+    curr = sll_nd_first(sll);
     while (NULL != curr)
     {
         sll->nd_dump(curr->data);
-        curr = curr->next;
+        curr = sll_nd_succ(sll, curr);
     }
 }
 #else
 #define sll_nd_dump(sll, info)
 #endif
 
+static a_int32_t
+sll_nd_height(const sll_node_t * node)
+{
+    return (NULL == node) ? 0 : node->height;
+}
+
+static void
+sll_nd_height_update(sll_node_t * node)
+{
+    a_int32_t l_height, r_height;
+
+    l_height = sll_nd_height(node->left);
+    r_height = sll_nd_height(node->right);
+    node->height = ((l_height > r_height) ? l_height : r_height) + 1;
+}
+
+static void
+sll_nd_relink(sll_head_t * sll, sll_node_t * old, sll_node_t * new)
+{
+    if (NULL == old->parent)
+    {
+        sll->root = new;
+    }
+    else if (old == old->parent->left)
+    {
+        old->parent->left = new;
+    }
+    else
+    {
+        old->parent->right = new;
+    }
+
+    if (NULL != new)
+    {
+        new->parent = old->parent;
+    }
+}
+
+static sll_node_t *
+sll_nd_rotate_left(sll_head_t * sll, sll_node_t * node)
+{
+    sll_node_t *pivot = node->right;
+
+    node->right = pivot->left;
+    if (NULL != pivot->left)
+    {
+        pivot->left->parent = node;
+    }
+    sll_nd_relink(sll, node, pivot);
+    pivot->left  = node;
+    node->parent = pivot;
+
+    sll_nd_height_update(node);
+    sll_nd_height_update(pivot);
+    return pivot;
+}
+
+static sll_node_t *
+sll_nd_rotate_right(sll_head_t * sll, sll_node_t * node)
+{
+    sll_node_t *pivot = node->left;
+
+    node->left = pivot->right;
+    if (NULL != pivot->right)
+    {
+        pivot->right->parent = node;
+    }
+    sll_nd_relink(sll, node, pivot);
+    pivot->right = node;
+    node->parent = pivot;
+
+    sll_nd_height_update(node);
+    sll_nd_height_update(pivot);
+    return pivot;
+}
+
+static void
+sll_nd_rebalance(sll_head_t * sll, sll_node_t * node)
+{
+    a_int32_t balance;
+
+    while (NULL != node)
+    {
+        sll_nd_height_update(node);
+        balance = sll_nd_height(node->left) - sll_nd_height(node->right);
+
+        if (1 < balance)
+        {
+            if (sll_nd_height(node->left->left) < sll_nd_height(node->left->right))
+            {
+                sll_nd_rotate_left(sll, node->left);
+            }
+            node = sll_nd_rotate_right(sll, node);
+        }
+        else if (-1 > balance)
+        {
+            if (sll_nd_height(node->right->right) < sll_nd_height(node->right->left))
+            {
+                sll_nd_rotate_right(sll, node->right);
+            }
+            node = sll_nd_rotate_left(sll, node);
+        }
+
+        node = node->parent;
+    }
+}
+
+static sll_node_t *
+sll_nd_locate(const sll_head_t * sll, void *data)
+{
+    sll_node_t *node;
+    ll_cmp_rslt_t rslt;
+
+    if (sll->flag & LL_IN_ORDER)
+    {
+        node = sll->root;
+        while (NULL != node)
+        {
+            rslt = sll->nd_cmp(node->data, data);
+            if (LL_CMP_EQUAL == rslt)
+            {
+                return node;
+            }
+            node = (LL_CMP_GREATER == rslt) ? node->left : node->right;
+        }
+        return NULL;
+    }
+
+    node = sll->fst_nd;
+    while (NULL != node)
+    {
+        if (LL_CMP_EQUAL == sll->nd_cmp(node->data, data))
+        {
+            return node;
+        }
+        node = node->next;
+    }
+    return NULL;
+}
+
 sll_head_t *
 sll_creat(ll_nd_cmp cmp_func, ll_nd_dump dump_func, a_uint32_t flag, a_uint32_t nd_nr)
 {
@@ -111,11 +294,13 @@ sll_creat(ll_nd_cmp cmp_func, ll_nd_dump dump_func, a_uint32_t flag, a_uint32_t
     aos_mem_zero(head, size);
 
     head->fst_nd  = NULL;
+    head->root    = NULL;
     head->nd_nr   = 0;
     head->flag    = flag;
     head->nd_cmp  = cmp_func;
     head->nd_dump = dump_func;
     head->free_nd = NULL;
+    aos_lock_init(&head->lock);
 
     if (flag & LL_FIX_NDNR)
     {
@@ -133,6 +318,24 @@ sll_creat(ll_nd_cmp cmp_func, ll_nd_dump dump_func, a_uint32_t flag, a_uint32_t
 void
 sll_destroy(sll_head_t * sll)
 {
+    sll_node_t *node, *next;
+
+    if (0 == (sll->flag & LL_FIX_NDNR))
+    {
+        node = sll_nd_first(sll);
+        while (NULL != node)
+        {
+            next = sll_nd_succ(sll, node);
+            if (sll->flag & LL_IN_ORDER)
+            {
+                /* the first node has no left child, unlink it */
+                sll_nd_relink(sll, node, node->right);
+            }
+            aos_mem_free(node);
+            node = next;
+        }
+    }
+
     aos_mem_free(sll);
     return;
 }
@@ -140,39 +343,28 @@ sll_destroy(sll_head_t * sll)
 void
 sll_lock(sll_head_t * sll)
 {
-    return;
+    aos_lock_bh(&sll->lock);
 }
 
 void
 sll_unlock(sll_head_t * sll)
 {
-    return;
+    aos_unlock_bh(&sll->lock);
 }
 
 void *
 sll_nd_find(const sll_head_t *sll, void *data, a_ulong_t *iterator)
 {
     sll_node_t *node;
-    ll_cmp_rslt_t rslt;
 
-    node = sll->fst_nd;
-    while (NULL != node)
+    node = sll_nd_locate(sll, data);
+    if (NULL == node)
     {
-        rslt = sll->nd_cmp(node->data, data);
-        if (LL_CMP_EQUAL == rslt)
-        {
-            *iterator = (a_ulong_t)node;
-            return node->data;
-        }
-
-        if ((LL_CMP_GREATER == rslt) && (sll->flag & LL_IN_ORDER))
-        {
-            return NULL;
-        }
-        node = node->next;
+        return NULL;
     }
 
-    return NULL;
+    *iterator = (a_ulong_t)node;
+    return node->data;
 }
 
 void *
@@ -182,14 +374,11 @@ sll_nd_next(const sll_head_t *sll, a_ulong_t *iterator)
 
     if (0 == *iterator)
     {
-        if (NULL != sll->fst_nd)
-        {
-            curr = sll->fst_nd;
-        }
+        curr = sll_nd_first(sll);
     }
     else
     {
-        curr = ((sll_node_t *)(*iterator))->next;
+        curr = sll_nd_succ(sll, (sll_node_t *)(*iterator));
     }
 
     if (NULL == curr)
@@ -209,7 +398,7 @@ sll_nd_insert(sll_head_t * sll, void *data)
     sll_node_t *node = NULL;
     sll_node_t *curr = NULL;
     sll_node_t *prev;
-    ll_cmp_rslt_t rslt;
+    ll_cmp_rslt_t rslt = LL_CMP_EQUAL;
 
     sll_nd_dump(sll, "sll_nd_insert before insert");
 
@@ -220,8 +409,7 @@ sll_nd_insert(sll_head_t * sll, void *data)
     }
     node->data = data;
 
-    if ((NULL == sll->fst_nd)
-            || (0 == (sll->flag & LL_IN_ORDER)))
+    if (0 == (sll->flag & LL_IN_ORDER))
     {
         node->next = sll->fst_nd;
         sll->fst_nd = node;
@@ -230,7 +418,7 @@ sll_nd_insert(sll_head_t * sll, void *data)
         return SW_OK;
     }
 
-    curr = sll->fst_nd;
+    curr = sll->root;
     prev = NULL;
     while (NULL != curr)
     {
@@ -242,24 +430,25 @@ sll_nd_insert(sll_head_t * sll, void *data)
             return SW_ALREADY_EXIST;
         }
 
-        if (LL_CMP_GREATER == rslt)
-        {
-            break;
-        }
         prev = curr;
-        curr = curr->next;
+        curr = (LL_CMP_GREATER == rslt) ? curr->left : curr->right;
     }
 
+    node->height = 1;
+    node->parent = prev;
     if (NULL == prev)
     {
-        node->next = sll->fst_nd;
-        sll->fst_nd = node;
+        sll->root = node;
+    }
+    else if (LL_CMP_GREATER == rslt)
+    {
+        prev->left = node;
     }
     else
     {
-        prev->next = node;
-        node->next = curr;
+        prev->right = node;
     }
+    sll_nd_rebalance(sll, prev);
     sll->nd_nr++;
 
     sll_nd_dump(sll, "sll_nd_insert after insert");
@@ -271,41 +460,66 @@ sll_nd_delete(sll_head_t * sll, void *data)
 {
     sll_node_t *curr;
     sll_node_t *prev = NULL;
-    ll_cmp_rslt_t rslt;
+    sll_node_t *child;
 
     sll_nd_dump(sll, "sll_nd_delete before delete");
 
-    curr = sll->fst_nd;
-    while (NULL != curr)
+    if (0 == (sll->flag & LL_IN_ORDER))
     {
-        rslt = sll->nd_cmp(curr->data, data);
-        if (LL_CMP_EQUAL == rslt)
+        curr = sll->fst_nd;
+        while (NULL != curr)
         {
-            if (NULL != prev)
-            {
-                prev->next = curr->next;
-            }
-            else
+            if (LL_CMP_EQUAL == sll->nd_cmp(curr->data, data))
             {
-                sll->fst_nd = curr->next;
+                if (NULL != prev)
+                {
+                    prev->next = curr->next;
+                }
+                else
+                {
+                    sll->fst_nd = curr->next;
+                }
+                sll->nd_nr--;
+                sll_nd_free(sll, curr);
+
+                sll_nd_dump(sll, "sll_nd_delete after delete");
+                return SW_OK;
             }
-            sll->nd_nr--;
-            sll_nd_free(sll, curr);
 
-            sll_nd_dump(sll, "sll_nd_delete after delete");
-            return SW_OK;
+            prev = curr;
+            curr = curr->next;
         }
 
-        if ((LL_CMP_GREATER == rslt) && (sll->flag & LL_IN_ORDER))
+        return SW_NOT_FOUND;
+    }
+
+    curr = sll_nd_locate(sll, data);
+    if (NULL == curr)
+    {
+        return SW_NOT_FOUND;
+    }
+
+    /* a node with two children takes over its successor's data */
+    if ((NULL != curr->left) && (NULL != curr->right))
+    {
+        prev = curr->right;
+        while (NULL != prev->left)
         {
-            return SW_NOT_FOUND;
+            prev = prev->left;
         }
-
-        prev = curr;
-        curr = curr->next;
+        curr->data = prev->data;
+        curr = prev;
     }
 
-    return SW_NOT_FOUND;
+    child = (NULL != curr->left) ? curr->left : curr->right;
+    prev  = curr->parent;
+    sll_nd_relink(sll, curr, child);
+    sll_nd_rebalance(sll, prev);
+    sll->nd_nr--;
+    sll_nd_free(sll, curr);
+
+    sll_nd_dump(sll, "sll_nd_delete after delete");
+    return SW_OK;
 }
 
 
@@ -454,7 +668,7 @@ sid_pool_id_free(sid_pool_t * pool, a_uint32_t id)
     {
         a_uint8_t *p_id;
 
-        if (ID_NR_IN_U8 < (id - id - pool->id_min))
+        if (ID_NR_IN_U8 < (id - pool->id_min))
         {
             return SW_FAIL;
         }
@@ -466,7 +680,7 @@ sid_pool_id_free(sid_pool_t * pool, a_uint32_t id)
     {
         a_uint16_t *p_id;
 
-        if (ID_NR_IN_U16 < (id - id - pool->id_min))
+        if (ID_NR_IN_U16 < (id - pool->id_min))
         {
             return SW_FAIL;
         }
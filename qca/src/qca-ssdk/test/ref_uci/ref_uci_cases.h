@@ -0,0 +1,876 @@
+/* SPDX-License-Identifier: ISC */
+
+/*
+ * Expected shell command lines for the table driven UCI commands, taken
+ * from the per command parse_*() functions ref_uci.c had before they were
+ * folded into option tables.  Each section lists its options in reverse
+ * of the order the old parser stored them, option k getting value "vk",
+ * so a table that maps an option to the wrong slot shows up in the line.
+ */
+
+static const test_case_t test_cases[] = {
+    {"QosQTxBufSts",
+     {"buffer_limit", "port_id"},
+     "Qos QTxBufSts set v1 v0 "},
+    {"QosQTxBufNr",
+     {"number", "queue_id", "port_id"},
+     "Qos QTxBufNr set v2 v1 v0 "},
+    {"QosPtTxBufSts",
+     {"buffer_limit", "port_id"},
+     "Qos PtTxBufSts set v1 v0 "},
+    {"QosPtTxBufNr",
+     {"number", "port_id"},
+     "Qos PtTxBufNr set v1 v0 "},
+    {"QosPtRxBufNr",
+     {"number", "port_id"},
+     "Qos PtRxBufNr set v1 v0 "},
+    {"QosPtRedEn",
+     {"red_status", "port_id"},
+     "Qos PtRedEn set v1 v0 "},
+    {"QosPtMode",
+     {"status", "mode", "port_id"},
+     "Qos PtMode set v2 v1 v0 "},
+    {"QosPtModePri",
+     {"priority", "mode", "port_id"},
+     "Qos PtModePri set v2 v1 v0 "},
+    {"QosPtschMode",
+     {"weight", "mode", "port_id"},
+     "Qos PtschMode set v2 v1 v0 "},
+    {"QosPtDefaultSpri",
+     {"stag_pri", "port_id"},
+     "Qos PtDefaultSpri set v1 v0 "},
+    {"QosPtDefaultCpri",
+     {"ctag_pri", "port_id"},
+     "Qos PtDefaultCpri set v1 v0 "},
+    {"QosPtFSpriSts",
+     {"force_stag_pri_status", "port_id"},
+     "Qos PtFSpriSts set v1 v0 "},
+    {"QosPtFCpriSts",
+     {"force_ctag_pri_status", "port_id"},
+     "Qos PtFCpriSts set v1 v0 "},
+    {"QosPtQuRemark",
+     {"status", "table_id", "queue_id", "port_id"},
+     "Qos PtQuRemark set v3 v2 v1 v0 "},
+    {"QosPtgroup",
+     {"flowgroup", "dscpgroup", "pcpgroup", "port_id"},
+     "Qos Ptgroup set v3 v2 v1 v0 "},
+    {"QosPtpriprece",
+     {"dscpprecforce", "pcpprecforce", "postaclprec", "aclprec", "flowprec", "preheaderprec", "dscpprec", "pcpprec", "port_id"},
+     "Qos Ptpriprece set v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QosPtremark",
+     {"dscp_change_en", "dei_change_en", "pcp_change_en", "port_id"},
+     "Qos Ptremark set v3 v2 v1 v0 "},
+    {"QosPcpmap",
+     {"qosprec", "dpen", "prien", "deien", "pcpen", "dscpen", "dscpmask", "internaldropprec", "internaldscp", "internalpri", "internaldei", "internalpcp", "pcp", "group_id"},
+     "Qos Pcpmap set v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QosFlowmap",
+     {"internaldropprec", "internaldscp", "internalpri", "internaldei", "internalpcp", "flow_id", "group_id"},
+     "Qos Flowmap set v6 v5 v4 v3 v2 v1 v0 "},
+    {"QosDscpmap",
+     {"internaldropprec", "internaldscp", "internalpri", "internaldei", "internalpcp", "dscp", "group_id"},
+     "Qos Dscpmap set v6 v5 v4 v3 v2 v1 v0 "},
+    {"QosQscheduler",
+     {"drr_frame_mode", "edrrunit", "cdrrunit", "cdrrweight", "edrrweight", "edrr_id", "cdrr_id", "cdrrpri", "edrrpri", "spid", "port_id", "level", "node_id"},
+     "Qos Qscheduler set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QosRingqueue",
+     {"queuebmp9", "queuebmp8", "queuebmp7", "queuebmp6", "queuebmp5", "queuebmp4", "queuebmp3", "queuebmp2", "queuebmp1", "queuebmp0", "ring_id"},
+     "Qos Ringqueue set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QosDequeue",
+     {"dequeue_ctrl_en", "queue_id"},
+     "Qos Dequeue set v1 v0 "},
+    {"QosPortscheduler",
+     {"port_id"},
+     "Qos Portscheduler set v0 "},
+    {"CosmapPri2Q",
+     {"queue", "pri"},
+     "Cosmap Pri2Q set v1 v0 "},
+    {"CosmapPri2Ehq",
+     {"enhance_queue", "pri"},
+     "Cosmap Pri2Ehq set v1 v0 "},
+    {"CosmapDscp2Pri",
+     {"pri", "dscp"},
+     "Cosmap Dscp2Pri set v1 v0 "},
+    {"CosmapDscp2Dp",
+     {"cfi", "dscp"},
+     "Cosmap Dscp2Dp set v1 v0 "},
+    {"CosmapUp2Pri",
+     {"pri", "up"},
+     "Cosmap Up2Pri set v1 v0 "},
+    {"CosmapUp2Dp",
+     {"cfi", "up"},
+     "Cosmap Up2Dp set v1 v0 "},
+    {"CosmapDscp2ehPri",
+     {"pri", "dscp"},
+     "Cosmap Dscp2ehPri set v1 v0 "},
+    {"CosmapDscp2ehDp",
+     {"cfi", "dscp"},
+     "Cosmap Dscp2ehDp set v1 v0 "},
+    {"CosmapUp2ehPri",
+     {"pri", "up"},
+     "Cosmap Up2ehPri set v1 v0 "},
+    {"CosmapUp2ehDp",
+     {"cfi", "up"},
+     "Cosmap Up2ehDp set v1 v0 "},
+    {"CosmapEgRemark",
+     {"yellow_dei", "green_dei", "yellow_up", "green_up", "yellow_dscp", "green_dscp", "remark_dei", "remark_up", "remark_dscp", "id"},
+     "Cosmap EgRemark set v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"RatePortPolicer",
+     {"e_meter_interval", "e_rate_flag", "ebs", "eir", "e_bucket_enable", "c_meter_interval", "c_rate_flag", "cbs", "cir", "c_bucket_enable", "deficit_flag", "color_aware", "couple_flag", "byte_based", "combine_enable", "port_id"},
+     "Rate PortPolicer set v15 v14 v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"RatePortShaper",
+     {"ebs", "eir", "cbs", "cir", "byte_based", "status", "port_id"},
+     "Rate PortShaper set v6 v5 v4 v3 v2 v1 v0 "},
+    {"RateQueueShaper",
+     {"ebs", "eir", "cbs", "cir", "byte_based", "status", "queue_id", "port_id"},
+     "Rate QueueShaper set v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"RateAclPolicer",
+     {"meter_interval", "ebs", "eir", "cbs", "cir", "deficit_flag", "color_aware", "couple_flag", "byte_based", "counter_mode", "policer_id"},
+     "Rate AclPolicer set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"RatePtAddRateByte",
+     {"add_rate_bytes", "port_id"},
+     "Rate PtAddRateByte set v1 v0 "},
+    {"RatePtGolflowen",
+     {"golbal_flow_control_status", "port_id"},
+     "Rate PtGolflowen set v1 v0 "},
+    {"PortTxHdr",
+     {"tx_frame_atheros_header_tag_status", "port_id"},
+     "Port TxHdr set v1 v0 "},
+    {"PortRxHdr",
+     {"rx_frame_atheros_header_tag_status", "port_id"},
+     "Port RxHdr set v1 v0 "},
+    {"PortHdrType",
+     {"atheros_header_tag_type", "atheros_header_tag_status"},
+     "Port HdrType set v1 v0 "},
+    {"PortDuplex",
+     {"duplex", "port_id"},
+     "Port Duplex set v1 v0 "},
+    {"PortSpeed",
+     {"speed", "port_id"},
+     "Port Speed set v1 v0 "},
+    {"PortAutoAdv",
+     {"auto_adv", "port_id"},
+     "Port AutoAdv set v1 v0 "},
+    {"PortAutoNegEnable",
+     {"port_id"},
+     "Port AutoNegEnable set v0 "},
+    {"PortAutoNegRestart",
+     {"port_id"},
+     "Port AutoNegRestart set v0 "},
+    {"PortFlowCtrl",
+     {"flow_control_status", "port_id"},
+     "Port FlowCtrl set v1 v0 "},
+    {"PortFlowCtrlForceMode",
+     {"flow_control_force_mode_status", "port_id"},
+     "Port FlowCtrlForceMode set v1 v0 "},
+    {"PortPowerSave",
+     {"power_save_status", "port_id"},
+     "Port PowerSave set v1 v0 "},
+    {"PortHibernate",
+     {"hibernate_status", "port_id"},
+     "Port Hibernate set v1 v0 "},
+    {"PortTxMacStatus",
+     {"tx_mac_status", "port_id"},
+     "Port TxMacStatus set v1 v0 "},
+    {"PortRxMacStatus",
+     {"rx_mac_status", "port_id"},
+     "Port RxMacStatus set v1 v0 "},
+    {"PortTxFcStatus",
+     {"tx_flow_control_status", "port_id"},
+     "Port TxFcStatus set v1 v0 "},
+    {"PortRxFcStatus",
+     {"rx_flow_control_status", "port_id"},
+     "Port RxFcStatus set v1 v0 "},
+    {"PortBpStatus",
+     {"back_presure_status", "port_id"},
+     "Port BpStatus set v1 v0 "},
+    {"PortLinkForceMode",
+     {"link_force_mode_status", "port_id"},
+     "Port LinkForceMode set v1 v0 "},
+    {"PortMacLoopback",
+     {"mac_loopback_status", "port_id"},
+     "Port MacLoopback set v1 v0 "},
+    {"PortCongeDrop",
+     {"status", "queue_id", "port_id"},
+     "Port CongeDrop set v2 v1 v0 "},
+    {"PortRingFcThresh",
+     {"off_thresh", "on_thresh", "ring_id"},
+     "Port RingFcThresh set v2 v1 v0 "},
+    {"PortIeee8023az",
+     {"mode", "port_id"},
+     "Port Ieee8023az set v1 v0 "},
+    {"PortCrossover",
+     {"mode", "port_id"},
+     "Port Crossover set v1 v0 "},
+    {"PortPreferMedium",
+     {"mode", "port_id"},
+     "Port PreferMedium set v1 v0 "},
+    {"PortFiberMode",
+     {"mode", "port_id"},
+     "Port FiberMode set v1 v0 "},
+    {"PortLocalLoopback",
+     {"mode", "port_id"},
+     "Port LocalLoopback set v1 v0 "},
+    {"PortRemoteLoopback",
+     {"mode", "port_id"},
+     "Port RemoteLoopback set v1 v0 "},
+    {"PortMagicFrameMac",
+     {"macaddr", "port_id"},
+     "Port MagicFrameMac set v1 v0 "},
+    {"PortWolstatus",
+     {"mode", "port_id"},
+     "Port Wolstatus set v1 v0 "},
+    {"PortInterfaceMode",
+     {"mode", "port_id"},
+     "Port InterfaceMode set v1 v0 "},
+    {"PortPoweron",
+     {"port_id"},
+     "Port Poweron set v0 "},
+    {"PortPoweroff",
+     {"port_id"},
+     "Port Poweroff set v0 "},
+    {"PortReset",
+     {"port_id"},
+     "Port Reset set v0 "},
+    {"PortFrameMaxSize",
+     {"frame_max_size", "port_id"},
+     "Port FrameMaxSize set v1 v0 "},
+    {"PortMtu",
+     {"mtuaction", "mtusize", "port_id"},
+     "Port Mtu set v2 v1 v0 "},
+    {"PortMru",
+     {"mruaction", "mrusize", "port_id"},
+     "Port Mru set v2 v1 v0 "},
+    {"PortSrcfilter",
+     {"status_en", "port_id"},
+     "Port Srcfilter set v1 v0 "},
+    {"PortInterface3az",
+     {"mode", "port_id"},
+     "Port Interface3az set v1 v0 "},
+    {"PortPromiscmode",
+     {"promisc_mode", "port_id"},
+     "Port Promiscmode set v1 v0 "},
+    {"PortEeecfg",
+     {"link_partner_advertisement", "lpi_wakeup_timer", "eee_status", "lpi_tx_en", "advertisement", "lpi_sleep_timer", "eee_capability", "eee_en", "port_id"},
+     "Port Eeecfg set v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PortSrcfiltercfg",
+     {"srcfilter_mode", "srcfilter_enable", "port_id"},
+     "Port Srcfiltercfg set v2 v1 v0 "},
+    {"PortSwitchPortLoopback",
+     {"loopback_rate", "crc_stripped_en", "loopback_en", "port_id"},
+     "Port SwitchPortLoopback set v3 v2 v1 v0 "},
+    {"PortvlanIngress",
+     {"ingress_vlan_mode", "port_id"},
+     "Portvlan Ingress set v1 v0 "},
+    {"PortvlanEgress",
+     {"egress_vlan_mode", "port_id"},
+     "Portvlan Egress set v1 v0 "},
+    {"PortvlanMember",
+     {"member", "port_id"},
+     "Portvlan Member set v1 v0 "},
+    {"PortvlanForceVid",
+     {"force_vid_status", "port_id"},
+     "Portvlan ForceVid set v1 v0 "},
+    {"PortvlanForceMode",
+     {"force_mode", "port_id"},
+     "Portvlan ForceMode set v1 v0 "},
+    {"PortvlanSVlanTPID",
+     {"stag_tpid"},
+     "Portvlan SVlanTPID set v0 "},
+    {"PortvlanDefaultSvid",
+     {"default_stag_vid", "port_id"},
+     "Portvlan DefaultSvid set v1 v0 "},
+    {"PortvlanDefaultCvid",
+     {"default_ctag_vid", "port_id"},
+     "Portvlan DefaultCvid set v1 v0 "},
+    {"PortvlanGlobalQinQMode",
+     {"egress_qinq_mode", "ingress_qinq_mode", "mask"},
+     "Portvlan GlobalQinQMode set v2 v1 v0 "},
+    {"PortvlanPtQinQMode",
+     {"egress_qinq_role", "ingress_qinq_role", "mask", "port_id"},
+     "Portvlan PtQinQMode set v3 v2 v1 v0 "},
+    {"PortvlanInTpid",
+     {"stagtpid", "ctagtpid", "mask"},
+     "Portvlan InTpid set v2 v1 v0 "},
+    {"PortvlanEgTpid",
+     {"stagtpid", "ctagtpid", "mask"},
+     "Portvlan EgTpid set v2 v1 v0 "},
+    {"PortvlanIngressFilter",
+     {"priority_tagged_filter_en", "untagged_filter_en", "tagged_filter_en", "membership_filter_en", "port_id"},
+     "Portvlan IngressFilter set v4 v3 v2 v1 v0 "},
+    {"PortvlanDefaultVlanTag",
+     {"default_stag_dei", "default_ctag_dei", "default_stag_pri", "default_ctag_pri", "default_stag_vid", "default_ctag_vid", "mask", "default_stag_vid_en", "default_ctag_vid_en", "direction", "port_id"},
+     "Portvlan DefaultVlanTag set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PortvlanTagPropagation",
+     {"dei_propagation_en", "pri_propagation_en", "vid_propagation_en", "mask", "direction", "port_id"},
+     "Portvlan TagPropagation set v5 v4 v3 v2 v1 v0 "},
+    {"PortvlanTranslationMissAction",
+     {"translation_miss_action", "port_id"},
+     "Portvlan TranslationMissAction set v1 v0 "},
+    {"PortvlanEgMode",
+     {"stag_egress_vlan_mode", "ctag_egress_vlan_mode", "mask", "port_id"},
+     "Portvlan EgMode set v3 v2 v1 v0 "},
+    {"PortvlanVsiEgMode",
+     {"vsi_egress_vlan_mode", "port_id", "vsi"},
+     "Portvlan VsiEgMode set v2 v1 v0 "},
+    {"PortvlanVsiEgModeEn",
+     {"vsi_egress_vlan_mode_en", "port_id"},
+     "Portvlan VsiEgModeEn set v1 v0 "},
+    {"PortvlanCounter",
+     {"index"},
+     "Portvlan Counter set v0 "},
+    {"PortvlanTranslationAdv",
+     {"vsitranslation", "vsi_translation_en", "counter_id", "counter_en", "cdeitranslation", "cdei_translation_en", "sdeitranslation", "sdei_translation_en", "swap_sdei_cdei", "cpcptranslation", "cpcp_translation_en", "spcptranslation", "spcp_translation_en", "swap_spcp_cpcp", "cvidtranslation", "cvid_translation_cmd", "svidtranslation", "svid_translation_cmd", "swap_svid_cvid", "vsi", "vsi_en", "vsivalid", "protocol", "protocol_en", "frametype", "frame_type_en", "cdei", "cdei_en", "cpcp", "cpcp_en", "cvid", "cvid_en", "ctagformat", "sdei", "sdei_en", "spcp", "spcp_en", "svid", "svid_en", "stagformat", "direction", "port_id"},
+     "Portvlan TranslationAdv set v41 v40 v39 v38 v37 v36 v35 v34 v33 v32 v31 v30 v29 v28 v27 v26 v25 v24 v23 v22 v21 v20 v19 v18 v17 v16 v15 v14 v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PortvlanInVlan",
+     {"ingress_tag_mode", "port_id"},
+     "Portvlan InVlan set v1 v0 "},
+    {"PortvlanTlsMode",
+     {"tls_mode", "port_id"},
+     "Portvlan TlsMode set v1 v0 "},
+    {"PortvlanPriPropagation",
+     {"vlan_priority_propagation_status", "port_id"},
+     "Portvlan PriPropagation set v1 v0 "},
+    {"PortvlanVlanPropagation",
+     {"vlan_propagation_mode", "port_id"},
+     "Portvlan VlanPropagation set v1 v0 "},
+    {"PortvlanTranslation",
+     {"one_2_one_vlan", "cvid_enable", "svid_enable", "original_vid_is_cvid", "cvid", "svid", "reverse_direction", "forward_direction", "bi_direction", "original_vid", "port_id"},
+     "Portvlan Translation set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PortvlanQinqMode",
+     {"qinq_mode", "port_id"},
+     "Portvlan QinqMode set v1 v0 "},
+    {"PortvlanQinqRole",
+     {"qinq_role", "port_id"},
+     "Portvlan QinqRole set v1 v0 "},
+    {"PortvlanMacVlanXlt",
+     {"egress_mac_based_vlan", "port_id"},
+     "Portvlan MacVlanXlt set v1 v0 "},
+    {"PortvlanNetiso",
+     {"net_isolate"},
+     "Portvlan Netiso set v0 "},
+    {"PortvlanEgBypass",
+     {"egress_translation_filter_bypass"},
+     "Portvlan EgBypass set v0 "},
+    {"PortvlanPtvrfid",
+     {"vrf_id", "port_id"},
+     "Portvlan Ptvrfid set v1 v0 "},
+    {"VlanEntry",
+     {"vlan_id"},
+     "Vlan Entry set v0 "},
+    {"VlanMember",
+     {"tag_mode", "port_id", "vlan_id"},
+     "Vlan Member set v2 v1 v0 "},
+    {"VlanLearnSts",
+     {"learn_status", "vlan_id"},
+     "Vlan LearnSts set v1 v0 "},
+    {"FdbPortLearn",
+     {"learn_status", "port_id"},
+     "Fdb PortLearn set v1 v0 "},
+    {"FdbResventry",
+     {"white_list_en", "cross_pt_state", "queue_override", "clone", "mirror", "leaky", "static", "dest_port", "sacmd", "dacmd", "fid", "addr"},
+     "Fdb Resventry set v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"FdbAgeCtrl",
+     {"aging_status"},
+     "Fdb AgeCtrl set v0 "},
+    {"FdbAgeTime",
+     {"aging_time"},
+     "Fdb AgeTime set v0 "},
+    {"FdbVlansmode",
+     {"vlan_searching_mode"},
+     "Fdb Vlansmode set v0 "},
+    {"FdbPtlearnlimit",
+     {"learn_limit_counter", "learn_limit_status", "port_id"},
+     "Fdb Ptlearnlimit set v2 v1 v0 "},
+    {"FdbPtlearnexceedcmd",
+     {"learn_exceed_cmd", "port_id"},
+     "Fdb Ptlearnexceedcmd set v1 v0 "},
+    {"FdbLearnlimit",
+     {"learn_limit_counter", "learn_limit_status"},
+     "Fdb Learnlimit set v1 v0 "},
+    {"FdbLearnexceedcmd",
+     {"learn_exceed_cmd"},
+     "Fdb Learnexceedcmd set v0 "},
+    {"FdbPtLearnstatic",
+     {"learn_static_status", "port_id"},
+     "Fdb PtLearnstatic set v1 v0 "},
+    {"FdbLearnCtrl",
+     {"learn_status"},
+     "Fdb LearnCtrl set v0 "},
+    {"FdbPtLearnCtrl",
+     {"learnaction", "learn_status", "port_id"},
+     "Fdb PtLearnCtrl set v2 v1 v0 "},
+    {"FdbPtStationMove",
+     {"stationmove_action", "stationmove_en", "port_id"},
+     "Fdb PtStationMove set v2 v1 v0 "},
+    {"FdbPtMacLimitCtrl",
+     {"maclimit_exceed_action", "maclimit_counter", "maclimit_status", "port_id"},
+     "Fdb PtMacLimitCtrl set v3 v2 v1 v0 "},
+    {"RsshashConfig",
+     {"hash_fin_outer", "hash_fin_inner", "hash_dport_mix", "hash_sport_mix", "hash_protocol_mix", "hash_dip_mix", "hash_sip_mix", "hash_seed", "hash_fragment_mode", "hask_mask", "hash_mode"},
+     "Rsshash Config set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IgmpMode",
+     {"igmp_mode", "port_id"},
+     "Igmp Mode set v1 v0 "},
+    {"IgmpCmd",
+     {"igmp_command"},
+     "Igmp Cmd set v0 "},
+    {"IgmpPortJoin",
+     {"join_status", "port_id"},
+     "Igmp PortJoin set v1 v0 "},
+    {"IgmpPortLeave",
+     {"leave_status", "port_id"},
+     "Igmp PortLeave set v1 v0 "},
+    {"IgmpRp",
+     {"route_port_bitmap"},
+     "Igmp Rp set v0 "},
+    {"IgmpCreateStatus",
+     {"create_status"},
+     "Igmp CreateStatus set v0 "},
+    {"IgmpStatic",
+     {"static_status"},
+     "Igmp Static set v0 "},
+    {"IgmpLeaky",
+     {"leaky_status"},
+     "Igmp Leaky set v0 "},
+    {"IgmpVersion3",
+     {"version3_status"},
+     "Igmp Version3 set v0 "},
+    {"IgmpQueue",
+     {"queue_id", "status"},
+     "Igmp Queue set v1 v0 "},
+    {"IgmpPtlearnlimit",
+     {"learn_limit_counter", "learn_limit_status", "port_id"},
+     "Igmp Ptlearnlimit set v2 v1 v0 "},
+    {"IgmpPtlearnexceedcmd",
+     {"learn_exceed_cmd", "port_id"},
+     "Igmp Ptlearnexceedcmd set v1 v0 "},
+    {"IgmpMulti",
+     {"vlanid", "portmap", "source_ip_addr", "source_type", "group_ip_addr", "group_type"},
+     "Igmp Multi set v5 v4 v3 v2 v1 v0 "},
+    {"SecMac",
+     {"value", "item"},
+     "Sec Mac set v1 v0 "},
+    {"SecIp",
+     {"value", "item"},
+     "Sec Ip set v1 v0 "},
+    {"SecIp4",
+     {"value", "item"},
+     "Sec Ip4 set v1 v0 "},
+    {"SecIp6",
+     {"value", "item"},
+     "Sec Ip6 set v1 v0 "},
+    {"SecTcp",
+     {"value", "item"},
+     "Sec Tcp set v1 v0 "},
+    {"SecUdp",
+     {"value", "item"},
+     "Sec Udp set v1 v0 "},
+    {"SecIcmp4",
+     {"value", "item"},
+     "Sec Icmp4 set v1 v0 "},
+    {"SecIcmp6",
+     {"value", "item"},
+     "Sec Icmp6 set v1 v0 "},
+    {"SecExpctrl",
+     {"multicast_en", "l3flow_en", "l2flow_en", "l2fwd_only_en", "l3route_only_en", "deacclr_en", "excep_cmd", "excep_type"},
+     "Sec Expctrl set v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"SecL3parser",
+     {"small_ip6hoplimit", "small_ip4ttl"},
+     "Sec L3parser set v1 v0 "},
+    {"SecL4parser",
+     {"tcpflag7_mask", "tcpflag7", "tcpflag6_mask", "tcpflag6", "tcpflag5_mask", "tcpflag5", "tcpflag4_mask", "tcpflag4", "tcpflag3_mask", "tcpflag3", "tcpflag2_mask", "tcpflag2", "tcpflag1_mask", "tcpflag1", "tcpflag0_mask", "tcpflag0"},
+     "Sec L4parser set v15 v14 v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"MiscEapolcmd",
+     {"action"},
+     "Misc Eapolcmd set v0 "},
+    {"MiscEapolstatus",
+     {"status", "port"},
+     "Misc Eapolstatus set v1 v0 "},
+    {"MiscCpuPort",
+     {"status"},
+     "Misc CpuPort set v0 "},
+    {"MiscPtUnkUcFilter",
+     {"status", "port"},
+     "Misc PtUnkUcFilter set v1 v0 "},
+    {"MiscPtUnkMcFilter",
+     {"status", "port"},
+     "Misc PtUnkMcFilter set v1 v0 "},
+    {"MiscPtBcFilter",
+     {"status", "port"},
+     "Misc PtBcFilter set v1 v0 "},
+    {"MiscCpuVid",
+     {"status"},
+     "Misc CpuVid set v0 "},
+    {"MiscFrameMaxSize",
+     {"frame_max_size"},
+     "Misc FrameMaxSize set v0 "},
+    {"MiscAutoNeg",
+     {"port"},
+     "Misc AutoNeg set v0 "},
+    {"MiscPppoeCmd",
+     {"action"},
+     "Misc PppoeCmd set v0 "},
+    {"MiscPppoe",
+     {"status"},
+     "Misc Pppoe set v0 "},
+    {"MiscPtDhcp",
+     {"status", "port"},
+     "Misc PtDhcp set v1 v0 "},
+    {"MiscArpcmd",
+     {"action"},
+     "Misc Arpcmd set v0 "},
+    {"MiscRip",
+     {"status"},
+     "Misc Rip set v0 "},
+    {"MiscPtarpreq",
+     {"status", "port"},
+     "Misc Ptarpreq set v1 v0 "},
+    {"MiscPtarpack",
+     {"status", "port"},
+     "Misc Ptarpack set v1 v0 "},
+    {"MiscExtendpppoe",
+     {"smacaddr_valid", "smacaddr", "l3if_index_valid", "l3if_index", "port", "vrf_id", "unicast_session", "multicast_session", "session_id", "entry_id"},
+     "Misc Extendpppoe set v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"MiscPppoeid",
+     {"pppoe_id", "index"},
+     "Misc Pppoeid set v1 v0 "},
+    {"MiscRtdPppoe",
+     {"status"},
+     "Misc RtdPppoe set v0 "},
+    {"MiscGloMacAddr",
+     {"macaddr"},
+     "Misc GloMacAddr set v0 "},
+    {"MiscFramecrc",
+     {"status"},
+     "Misc Framecrc set v0 "},
+    {"MiscPppoeen",
+     {"pppoe_en", "l3if_index"},
+     "Misc Pppoeen set v1 v0 "},
+    {"IpPtarplearn",
+     {"status", "port"},
+     "Ip Ptarplearn set v1 v0 "},
+    {"IpArplearn",
+     {"mode"},
+     "Ip Arplearn set v0 "},
+    {"IpPtipsrcguard",
+     {"source_guard_mode", "port"},
+     "Ip Ptipsrcguard set v1 v0 "},
+    {"IpPtarpsrcguard",
+     {"source_guard_mode", "port"},
+     "Ip Ptarpsrcguard set v1 v0 "},
+    {"IpRoutestatus",
+     {"status"},
+     "Ip Routestatus set v0 "},
+    {"IpIpunksrc",
+     {"action"},
+     "Ip Ipunksrc set v0 "},
+    {"IpArpunksrc",
+     {"action"},
+     "Ip Arpunksrc set v0 "},
+    {"IpIpAgetime",
+     {"age_time"},
+     "Ip IpAgetime set v0 "},
+    {"IpWcmphashmode",
+     {"wcmp_hash_mode"},
+     "Ip Wcmphashmode set v0 "},
+    {"IpDefaultflowcmd",
+     {"flow_cmd", "flow_type", "vrf_id"},
+     "Ip Defaultflowcmd set v2 v1 v0 "},
+    {"IpDefaultrtflowcmd",
+     {"flow_cmd", "flow_type", "vrf_id"},
+     "Ip Defaultrtflowcmd set v2 v1 v0 "},
+    {"IpHostRoute",
+     {"prefix_length", "ip_addr", "ip_version", "vrf_id", "entry_valid", "entry_id"},
+     "Ip HostRoute set v5 v4 v3 v2 v1 v0 "},
+    {"IpDefaultRoute",
+     {"index", "route_type", "vrf_id", "entry_valid", "entry_id"},
+     "Ip DefaultRoute set v4 v3 v2 v1 v0 "},
+    {"IpVrfbaseaddr",
+     {"base_addr", "vrf_id"},
+     "Ip Vrfbaseaddr set v1 v0 "},
+    {"IpVrfbasemask",
+     {"base_mask", "vrf_id"},
+     "Ip Vrfbasemask set v1 v0 "},
+    {"IpRfsip4",
+     {"load_balance", "vlan_id", "ip4_addr", "mac_addr"},
+     "Ip Rfsip4 set v3 v2 v1 v0 "},
+    {"IpRfsip6",
+     {"load_balance", "vlan_id", "ip6_addr", "mac_addr"},
+     "Ip Rfsip6 set v3 v2 v1 v0 "},
+    {"IpVsiarpsg",
+     {"ip6_nd_sourceunknown_action", "ip6_nd_sourceguard_cvlan_en", "ip6_nd_sourceguard_svlan_en", "ip6_nd_sourceguard_port_en", "ip6_nd_sourceguard_violation_action", "ip6_nd_sourceguard_en", "ip4_arp_sourceunkown_action", "ip4_arp_sourcegurad_cvlan_en", "ip4_arp_sourceguard_svlan_en", "ip4_arp_sourceguard_port_en", "ip4_arp_sourceguard_violation_action", "ip4_arp_sourceguard_en", "vsi"},
+     "Ip Vsiarpsg set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IpVsisg",
+     {"ip6_sourceunknown_action", "ip6_sourceguard_cvlan_en", "ip6_sourceguard_svlan_en", "ip6_sourceguard_port_en", "ip6_sourceguard_violation_action", "ip6_sourceguard_en", "ip4_sourceunkown_action", "ip4_sourceguard_cvlan_en", "ip4_sourceguard_svlan_en", "ip4_sourceguard_port_en", "ip4_sourcegurad_violation_action", "ip4_sourceguard_en", "vsi"},
+     "Ip Vsisg set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IpPortarpsg",
+     {"ip6_nd_sourceunkown_action", "ip6_nd_sourceguard_cvlan_en", "ip6_nd_sourceguard_svlan_en", "ip6_nd_sourceguard_port_en", "ip6_nd_sourceguard_violation_action", "ip6_nd_sourceguard_en", "ip4_arp_sourceunkown_action", "ip4_arp_sourceguard_cvlan_en", "ip4_arp_sourceguard_svlan_en", "ip4_arp_sourceguard_port_en", "ip4_arp_sourceguard_violation_action", "ip4_arp_sourceguard_en", "port_id"},
+     "Ip Portarpsg set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IpPortsg",
+     {"ip6_sourceunkown_action", "ip6_sourceguard_cvlan_en", "ip6_sourceguard_svlan_en", "ip6_sourceguard_port_en", "ip6_sourceguard_violation_action", "ip6_sourceguard_en", "ip4_sourceunkown_action", "ip4_sourceguard_cvlan_en", "ip4_sourceguard_svlan_en", "ip4_sourceguard_port_en", "ip4_sourceguard_violation_action", "ip4_sourceguard_en", "port_id"},
+     "Ip Portsg set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IpPubip",
+     {"ip4addr", "index"},
+     "Ip Pubip set v1 v0 "},
+    {"IpIntf",
+     {"macaddr", "macaddr_bitmap", "ttl_exceed_deacclr_en", "ttl_exceed_action", "icmp_trigger_en", "ip6_unicast_route_en", "ip4_unicast_route_en", "ttl_dec_bypass_en", "mtu", "mru", "index"},
+     "Ip Intf set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IpVsiintf",
+     {"l3if_index", "l3if_valid", "vsi"},
+     "Ip Vsiintf set v2 v1 v0 "},
+    {"IpPortintf",
+     {"l3if_index", "l3if_valid", "port_id"},
+     "Ip Portintf set v2 v1 v0 "},
+    {"IpNexthop",
+     {"dnat_ip", "macaddr", "cvid", "ctag_fmt", "svid", "stag_fmt", "pub_ip_index", "ip_to_me_en", "l3if_index", "port_id", "type", "index"},
+     "Ip Nexthop set v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"IpPortmac",
+     {"macaddr", "valid", "port_id"},
+     "Ip Portmac set v2 v1 v0 "},
+    {"IpRoutemiss",
+     {"action"},
+     "Ip Routemiss set v0 "},
+    {"IpMcmode",
+     {"l2_ip6_multicast_mode", "l2_ip6_multicast_en", "l2_ip4_multicast_mode", "l2_ip4_multicast_en", "vsi"},
+     "Ip Mcmode set v4 v3 v2 v1 v0 "},
+    {"IpGlobalctrl",
+     {"hash_mode_1", "hash_mode_0", "icmp_redirect_deacclr_en", "icmp_redirect_action", "prefix_deacclr_en", "prefix_bc_action", "mtu_nonfrag_deacclr_en", "mtu_nonfrag_fail_action", "mtu_deacclr_en", "mtu_fail_action", "mru_deacclr_en", "mru_fail_action"},
+     "Ip Globalctrl set v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"NatFlowcookie",
+     {"flow_cookie", "dst_port", "src_port", "dst_addr", "src_addr", "proto"},
+     "Nat Flowcookie set v5 v4 v3 v2 v1 v0 "},
+    {"NatFlowrfs",
+     {"flow_rfs", "dst_port", "src_port", "dst_addr", "src_addr", "proto", "action"},
+     "Nat Flowrfs set v6 v5 v4 v3 v2 v1 v0 "},
+    {"NatNatstatus",
+     {"status"},
+     "Nat Natstatus set v0 "},
+    {"NatNaptstatus",
+     {"status"},
+     "Nat Naptstatus set v0 "},
+    {"NatNathash",
+     {"hash_flag"},
+     "Nat Nathash set v0 "},
+    {"NatNaptmode",
+     {"napt_mode"},
+     "Nat Naptmode set v0 "},
+    {"NatPrvbaseaddr",
+     {"base_addr"},
+     "Nat Prvbaseaddr set v0 "},
+    {"NatPrvaddrmode",
+     {"status"},
+     "Nat Prvaddrmode set v0 "},
+    {"NatPubaddr",
+     {"pub_addr", "entry_id"},
+     "Nat Pubaddr set v1 v0 "},
+    {"NatNatunksess",
+     {"action"},
+     "Nat Natunksess set v0 "},
+    {"NatPrvbasemask",
+     {"base_addr_mask"},
+     "Nat Prvbasemask set v0 "},
+    {"StpPortState",
+     {"stp_status", "port_id", "stp_id"},
+     "Stp PortState set v2 v1 v0 "},
+    {"MirrorAnalyPt",
+     {"analysis_port"},
+     "Mirror AnalyPt set v0 "},
+    {"MirrorPtIngress",
+     {"status", "ingress_port"},
+     "Mirror PtIngress set v1 v0 "},
+    {"MirrorPtEgress",
+     {"status", "egress_port"},
+     "Mirror PtEgress set v1 v0 "},
+    {"MirrorAnalyCfg",
+     {"analysis_priority", "analysis_port", "direction"},
+     "Mirror AnalyCfg set v2 v1 v0 "},
+    {"LeakyUcMode",
+     {"unicast_leaky_mode"},
+     "Leaky UcMode set v0 "},
+    {"LeakyMcMode",
+     {"multicast_leaky_mode"},
+     "Leaky McMode set v0 "},
+    {"LeakyArpMode",
+     {"status", "port"},
+     "Leaky ArpMode set v1 v0 "},
+    {"LeakyPtUcMode",
+     {"status", "port"},
+     "Leaky PtUcMode set v1 v0 "},
+    {"LeakyPtMcMode",
+     {"status", "port"},
+     "Leaky PtMcMode set v1 v0 "},
+    {"TrunkGroup",
+     {"trunk_port_bitmap", "status", "trunk_id"},
+     "Trunk Group set v2 v1 v0 "},
+    {"TrunkHashmode",
+     {"trunk_hash_mode"},
+     "Trunk Hashmode set v0 "},
+    {"TrunkFailover",
+     {"failover_en"},
+     "Trunk Failover set v0 "},
+    {"MibStatus",
+     {"status"},
+     "Mib Status set v0 "},
+    {"MibCpuKeep",
+     {"status"},
+     "Mib CpuKeep set v0 "},
+    {"FlowStatus",
+     {"status"},
+     "Flow Status set v0 "},
+    {"FlowAgetime",
+     {"ageunit", "agetime"},
+     "Flow Agetime set v1 v0 "},
+    {"FlowMgmt",
+     {"keysel", "all_bypass_en", "tcp_specific_bypass_en", "frag_bypass_en", "flow_miss_action", "flowdirection", "flowtype"},
+     "Flow Mgmt set v6 v5 v4 v3 v2 v1 v0 "},
+    {"FlowGlobal",
+     {"hash_mode_1", "hash_mode_0", "sync_mismatch_deacclr_en", "sync_mismatch_action", "flow_deacclr_action", "service_loop_deacclr_en", "service_loop_action", "service_loop_en", "srcif_check_deacclr_en", "srcif_check_action"},
+     "Flow Global set v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"BmCtrl",
+     {"enable", "port_id"},
+     "Bm Ctrl set v1 v0 "},
+    {"BmPortgroupmap",
+     {"group_id", "port_id"},
+     "Bm Portgroupmap set v1 v0 "},
+    {"BmGroupbuff",
+     {"bufnum", "group_id"},
+     "Bm Groupbuff set v1 v0 "},
+    {"BmPortrsvbuff",
+     {"react_bufnum", "prealloc_bufnum", "port_id"},
+     "Bm Portrsvbuff set v2 v1 v0 "},
+    {"BmPortsthresh",
+     {"resume_offset", "maxthreshold", "port_id"},
+     "Bm Portsthresh set v2 v1 v0 "},
+    {"BmPortdthresh",
+     {"resume_min_threshold", "resumeoffset", "sharedceiling", "weight", "port_id"},
+     "Bm Portdthresh set v4 v3 v2 v1 v0 "},
+    {"QmUcastqbase",
+     {"profile", "queuebase", "destport", "cpucode", "cpucode_en", "servicecode", "servicecode_en", "srcprofile"},
+     "Qm Ucastqbase set v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QmUcastpriclass",
+     {"class", "priority", "profile"},
+     "Qm Ucastpriclass set v2 v1 v0 "},
+    {"QmMcastpriclass",
+     {"class", "priority", "port_id"},
+     "Qm Mcastpriclass set v2 v1 v0 "},
+    {"QmQueue",
+     {"queue_id", "port_id"},
+     "Qm Queue set v1 v0 "},
+    {"QmUcasthash",
+     {"queuehash", "rsshash", "profile"},
+     "Qm Ucasthash set v2 v1 v0 "},
+    {"QmUcastdflthash",
+     {"queuevalue"},
+     "Qm Ucastdflthash set v0 "},
+    {"QmMcastcpucode",
+     {"class", "cpucode"},
+     "Qm Mcastcpucode set v1 v0 "},
+    {"QmAcctrl",
+     {"admis_flowctrl_en", "admis_ctrl_en", "obj_id", "type"},
+     "Qm Acctrl set v3 v2 v1 v0 "},
+    {"QmAcprebuffer",
+     {"bufnum", "obj_id", "type"},
+     "Qm Acprebuffer set v2 v1 v0 "},
+    {"QmAcqgroup",
+     {"group_id", "queue_id"},
+     "Qm Acqgroup set v1 v0 "},
+    {"QmAcstaticthresh",
+     {"red_resume_offset", "yel_resume_offset", "green_resume_offset", "red_min_offset", "red_max_offset", "yel_min_offset", "yel_max_offset", "green_min_offset", "greenmax", "wred_en", "color_en", "obj_id", "type"},
+     "Qm Acstaticthresh set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QmAcdynamicthresh",
+     {"ceiling", "red_resume_offset", "yel_resume_offset", "green_resume_off", "red_min_offset", "red_max_offset", "yel_min_offset", "yel_max_offset", "green_min_offset", "sharedweight", "wred_en", "color_en", "queue_id"},
+     "Qm Acdynamicthresh set v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"QmAcgroupbuff",
+     {"total_bufnum", "prealloc_bufnum", "group_id"},
+     "Qm Acgroupbuff set v2 v1 v0 "},
+    {"QmCntctrl",
+     {"cnt_en"},
+     "Qm Cntctrl set v0 "},
+    {"QmCnt",
+     {"queue_id"},
+     "Qm Cnt set v0 "},
+    {"QmEnqueue",
+     {"enqueue_en", "queue_id"},
+     "Qm Enqueue set v1 v0 "},
+    {"QmSrcprofile",
+     {"sourceprofile", "port_id"},
+     "Qm Srcprofile set v1 v0 "},
+    {"ServcodeConfig",
+     {"offsetselection", "hardwareservices", "next_servicecode", "field_update_bitmap", "direction", "bypass_bitmap_2", "bypass_bitmap_1", "bypass_bitmap_0", "destport_id", "destport_en", "servcode_id"},
+     "Servcode Config set v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"ServcodeLoopcheck",
+     {"loopcheck_en"},
+     "Servcode Loopcheck set v0 "},
+    {"CtrlpktEthernetType",
+     {"ethernettype", "profile_id"},
+     "Ctrlpkt EthernetType set v1 v0 "},
+    {"CtrlpktRfdb",
+     {"rfdb_macaddr", "profile_id"},
+     "Ctrlpkt Rfdb set v1 v0 "},
+    {"CtrlpktAppProfile",
+     {"ingress_vlan_filter_bypass", "ingress_stp_bypass", "l2filter_bypass", "sourceguard_bypass", "ctrlpkt_profile_action", "ip6na_en", "ip6ns_en", "mld_en", "dhcp6_en", "dhcp4_en", "arp_reponse_en", "arp_request_en", "igmp_en", "pppoe_en", "eapol_en", "rfdb_profile_bitmap", "ethtype_profile_bitmap", "port_bitmap"},
+     "Ctrlpkt AppProfile set v17 v16 v15 v14 v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PolicerTimeslot",
+     {"timeslot"},
+     "Policer Timeslot set v0 "},
+    {"PolicerFcscompensation",
+     {"fcscompensation_length", "port_id"},
+     "Policer Fcscompensation set v1 v0 "},
+    {"PolicerPortentry",
+     {"reddei", "redpcp", "red_dropprec", "redpri", "red_deiremark_en", "red_pcpremark_en", "red_dropprec_remark_en", "red_priremark_en", "redaction", "yellowdei", "yellowpcp", "yellow_dropprec", "yellowpri", "yellow_deiremark_en", "yellow_pcpremark_en", "yellow_dropprec_remark_en", "yellow_priremark_en", "ebs", "eir", "cbs", "cir", "meterunit", "metermode", "frametype", "colormode", "coupling_en", "policer_en", "port_id"},
+     "Policer Portentry set v27 v26 v25 v24 v23 v22 v21 v20 v19 v18 v17 v16 v15 v14 v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PolicerAclentry",
+     {"reddei", "redpcp", "red_dropprec", "redpri", "red_deiremark_en", "red_pcpremark_en", "red_dropprec_remark_en", "red_priremark_en", "redaction", "yellowdei", "yellowpcp", "yellow_dropprec", "yellowpri", "yellow_deiremark_en", "yellow_pcpremark_en", "yellow_dropprec_remark_en", "yellow_priremark_en", "ebs", "eir", "cbs", "cir", "meterunit", "metermode", "colormode", "coupling_en", "policer_en", "index"},
+     "Policer Aclentry set v26 v25 v24 v23 v22 v21 v20 v19 v18 v17 v16 v15 v14 v13 v12 v11 v10 v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"PolicerBypass",
+     {"bypass_status", "frame_type"},
+     "Policer Bypass set v1 v0 "},
+    {"ShaperPorttimeslot",
+     {"timeslot"},
+     "Shaper Porttimeslot set v0 "},
+    {"ShaperFlowtimeslot",
+     {"timeslot"},
+     "Shaper Flowtimeslot set v0 "},
+    {"ShaperQueuetimeslot",
+     {"timeslot"},
+     "Shaper Queuetimeslot set v0 "},
+    {"ShaperIpgcompensation",
+     {"ipgcompensation_length"},
+     "Shaper Ipgcompensation set v0 "},
+    {"ShaperPorttoken",
+     {"ctokennum", "ctoken_negative_en", "port_id"},
+     "Shaper Porttoken set v2 v1 v0 "},
+    {"ShaperFlowtoken",
+     {"etokennum", "etoken_negative_en", "ctokennum", "ctoken_negative_en", "flow_id"},
+     "Shaper Flowtoken set v4 v3 v2 v1 v0 "},
+    {"ShaperQueuetoken",
+     {"etokennum", "etoken_negative_en", "ctokennum", "ctoken_negative_en", "queue_id"},
+     "Shaper Queuetoken set v4 v3 v2 v1 v0 "},
+    {"ShaperPortshaper",
+     {"framemode", "cbs", "cir", "cshaper_en", "meterunit", "port_id"},
+     "Shaper Portshaper set v5 v4 v3 v2 v1 v0 "},
+    {"ShaperQueueshaper",
+     {"framemode", "ebs", "eir", "eshaper_en", "cbs", "cir", "cshaper_en", "meterunit", "coupling_en", "queue_id"},
+     "Shaper Queueshaper set v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"ShaperFlowshaper",
+     {"framemode", "ebs", "eir", "eshaper_en", "cbs", "cir", "cshaper_en", "meterunit", "coupling_en", "flow_id"},
+     "Shaper Flowshaper set v9 v8 v7 v6 v5 v4 v3 v2 v1 v0 "},
+    {"VsiPortbasedvsi",
+     {"vsi", "port_id"},
+     "Vsi Portbasedvsi set v1 v0 "},
+    {"VsiVlanbasedvsi",
+     {"vsi", "cvid", "svid", "port_id"},
+     "Vsi Vlanbasedvsi set v3 v2 v1 v0 "},
+    {"VsiLearnctrl",
+     {"learnaction", "learn_status", "vsi"},
+     "Vsi Learnctrl set v2 v1 v0 "},
+    {"VsiStationmove",
+     {"stationmove_action", "stationmove_en", "vsi"},
+     "Vsi Stationmove set v2 v1 v0 "},
+    {"VsiMember",
+     {"broadcast_membership", "unknown_multicast_membership", "unknown_unicast_membership", "membership", "vsi"},
+     "Vsi Member set v4 v3 v2 v1 v0 "},
+    {"DebugModule_func",
+     {"bitmap2", "bitmap1", "bitmap0", "module"},
+     "Debug Module_func set v3 v2 v1 v0 "},
+};
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: ISC */
+
+
+/*
+ * Force-included ahead of src/ref/ref_uci.c for the host build. Every
+ * header ref_uci.c includes is an empty stub, this provides the few kernel
+ * and SSDK definitions the UCI parsers actually use.
+ */
+
+#ifndef _REF_UCI_SHIM_H_
+#define _REF_UCI_SHIM_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned int a_uint32_t;
+typedef int a_bool_t;
+
+#define A_TRUE  1
+#define A_FALSE 0
+
+#define LINUX_VERSION_CODE          0
+#define KERNEL_VERSION(a, b, c)     (((a) << 16) + ((b) << 8) + (c))
+
+#define ARRAY_SIZE(x)               (sizeof(x) / sizeof((x)[0]))
+#define BUILD_BUG_ON(cond)          ((void)sizeof(char[1 - 2 * !!(cond)]))
+
+#define DEFINE_MUTEX(lock)          int lock
+#define mutex_lock(lock)            ((void)(lock))
+#define mutex_unlock(lock)          ((void)(lock))
+#define smp_load_acquire(p)         __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define smp_store_release(p, v)     __atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+#define SSDK_DEBUG(fmt, ...)        do { } while (0)
+
+struct switch_ext {
+    const char *option_name;
+    const char *option_value;
+    struct switch_ext *next;
+};
+
+struct switch_val {
+    const struct switch_attr *attr;
+    int port_vlan;
+    int len;
+    union {
+        struct switch_ext *ext_val;
+    } value;
+};
+
+struct switch_dev {
+    int dummy;
+};
+
+struct switch_attr {
+    int dummy;
+};
+
+struct qca_phy_priv {
+    a_uint32_t device_id;
+};
+
+a_uint32_t jhash(const void *key, a_uint32_t length, a_uint32_t initval);
+size_t strlcpy(char *dest, const char *src, size_t size);
+size_t strlcat(char *dest, const char *src, size_t size);
+
+struct qca_phy_priv *qca_phy_priv_get(struct switch_dev *dev);
+void uci_set_devid(a_uint32_t dev_id);
+void set_talk_mode(int mode);
+int cmd_run_one(char *cmd_str);
+
+#endif                          /* _REF_UCI_SHIM_H_ */
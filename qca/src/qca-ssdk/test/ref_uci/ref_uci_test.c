@@ -0,0 +1,260 @@
+/* SPDX-License-Identifier: ISC */
+
+
+/*
+ * Host test and timing harness for the UCI section parsers.
+ *
+ *   ref_uci_test          apply a section of every table driven command
+ *                         and check the command line handed to the shell
+ *                         against the one the old parsers produced
+ *   ref_uci_test -b [n]   apply all of those sections n times and report
+ *                         the time per section
+ */
+
+#include <time.h>
+#include "ref_uci.c"
+
+#define TEST_OPT_MAX    SWITCH_CFG_LEN_MAX
+
+#define TEST_ASSERT(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+typedef struct
+{
+    const char *name;
+    const char *options[TEST_OPT_MAX];
+    const char *expect;
+} test_case_t;
+
+#include "ref_uci_cases.h"
+
+typedef struct
+{
+    struct switch_ext ext[TEST_OPT_MAX + 1];
+    const test_case_t *tc;
+    struct switch_val val;
+} test_section_t;
+
+static char test_cmd_line[COMMAND_LINE_MAX_LEN];
+static a_uint32_t test_cmd_runs;
+static struct qca_phy_priv test_priv;
+
+static const char *test_values[TEST_OPT_MAX] = {
+    "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v8", "v9",
+    "v10", "v11", "v12", "v13", "v14", "v15", "v16", "v17", "v18", "v19",
+    "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28", "v29",
+    "v30", "v31", "v32", "v33", "v34", "v35", "v36", "v37", "v38", "v39",
+    "v40", "v41", "v42", "v43", "v44", "v45", "v46", "v47", "v48", "v49",
+    "v50", "v51", "v52", "v53", "v54", "v55", "v56", "v57", "v58", "v59",
+    "v60", "v61", "v62", "v63",
+};
+
+a_uint32_t
+jhash(const void *key, a_uint32_t length, a_uint32_t initval)
+{
+    const unsigned char *p = key;
+    a_uint32_t hash = 2166136261u ^ initval;
+
+    while (length--)
+    {
+        hash = (hash ^ *p++) * 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+size_t
+strlcpy(char *dest, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+
+    if (size)
+    {
+        size_t n = (len >= size) ? size - 1 : len;
+
+        memcpy(dest, src, n);
+        dest[n] = '\0';
+    }
+    return len;
+}
+
+size_t
+strlcat(char *dest, const char *src, size_t size)
+{
+    size_t len = strlen(dest);
+
+    return len + strlcpy(dest + len, src, (len < size) ? size - len : 0);
+}
+
+struct qca_phy_priv *
+qca_phy_priv_get(struct switch_dev *dev)
+{
+    return &test_priv;
+}
+
+void
+uci_set_devid(a_uint32_t dev_id)
+{
+}
+
+void
+set_talk_mode(int mode)
+{
+}
+
+int
+cmd_run_one(char *cmd_str)
+{
+    strlcpy(test_cmd_line, cmd_str, sizeof(test_cmd_line));
+    test_cmd_runs++;
+    return 0;
+}
+
+/* the section of tc, option k of the list getting value "vk" */
+static void
+test_section_init(test_section_t * sec, const test_case_t * tc)
+{
+    a_uint32_t i, n = 0;
+
+    sec->tc = tc;
+    sec->ext[n].option_name = "name";
+    sec->ext[n].option_value = tc->name;
+    n++;
+
+    for (i = 0; (i < TEST_OPT_MAX) && tc->options[i]; i++)
+    {
+        sec->ext[n].option_name = tc->options[i];
+        sec->ext[n].option_value = test_values[i];
+        n++;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        sec->ext[i].next = (i + 1 < n) ? &sec->ext[i + 1] : NULL;
+    }
+    memset(&sec->val, 0, sizeof(sec->val));
+    sec->val.value.ext_val = &sec->ext[0];
+}
+
+static a_uint32_t
+test_sections_init(test_section_t ** secs)
+{
+    a_uint32_t i, n = ARRAY_SIZE(test_cases);
+
+    *secs = calloc(n, sizeof(**secs));
+    TEST_ASSERT(NULL != *secs);
+    for (i = 0; i < n; i++)
+    {
+        test_section_init(&(*secs)[i], &test_cases[i]);
+    }
+    return n;
+}
+
+static void
+test_apply(test_section_t * sec)
+{
+    struct switch_dev dev;
+
+    TEST_ASSERT(0 == qca_ar8327_sw_switch_ext(&dev, NULL, &sec->val));
+}
+
+static void
+test_check(void)
+{
+    test_section_t *secs, *sec;
+    struct switch_ext bad;
+    a_uint32_t i, n, tables = 0;
+
+    /* every table driven command needs a case */
+    for (i = 0; i < ARRAY_SIZE(ref_uci_cmds); i++)
+    {
+        if (ref_uci_cmds[i].options)
+        {
+            tables++;
+        }
+    }
+
+    n = test_sections_init(&secs);
+    TEST_ASSERT(n == tables);
+    for (i = 0; i < n; i++)
+    {
+        sec = &secs[i];
+        test_apply(sec);
+        if (strcmp(test_cmd_line, sec->tc->expect))
+        {
+            fprintf(stderr, "%s: got \"%s\", expected \"%s\"\n",
+                    sec->tc->name, test_cmd_line, sec->tc->expect);
+            exit(1);
+        }
+    }
+
+    /* an unknown option fails the section, nothing is formatted */
+    sec = &secs[0];
+    bad.option_name = "no_such_option";
+    bad.option_value = "x";
+    bad.next = sec->ext[0].next;
+    sec->ext[0].next = &bad;
+    test_apply(sec);
+    TEST_ASSERT('\0' == test_cmd_line[0]);
+
+    printf("ref_uci: %u table driven commands ok\n", n);
+    free(secs);
+}
+
+static double
+test_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+test_bench(a_uint32_t rounds)
+{
+    test_section_t *secs;
+    a_uint32_t i, r, n;
+    double t0, t;
+
+    n = test_sections_init(&secs);
+
+    /* the first section also builds the command index */
+    test_apply(&secs[0]);
+
+    t0 = test_now();
+    for (r = 0; r < rounds; r++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            test_apply(&secs[i]);
+        }
+    }
+    t = test_now() - t0;
+
+    printf("%u sections x %u rounds: %.1f ns per section\n", n, rounds,
+           t * 1e9 / ((double)n * rounds));
+    free(secs);
+}
+
+int
+main(int argc, char **argv)
+{
+    a_uint32_t rounds;
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "-b")))
+    {
+        rounds = (argc > 2) ? strtoul(argv[2], NULL, 0) : 200;
+        TEST_ASSERT(rounds > 0);
+        test_bench(rounds);
+        return 0;
+    }
+
+    test_check();
+    return 0;
+}
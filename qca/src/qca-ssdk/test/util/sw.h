@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: ISC */
+
+
+/* userspace stand-in for sw.h, just enough to build src/util/util.c */
+
+#ifndef _SW_H_
+#define _SW_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned char a_uint8_t;
+typedef unsigned short a_uint16_t;
+typedef int a_int32_t;
+typedef unsigned int a_uint32_t;
+typedef unsigned long a_ulong_t;
+typedef int a_bool_t;
+
+#include "sw_error.h"
+
+typedef int aos_lock_t;
+
+#define aos_mem_alloc(size)         malloc(size)
+#define aos_mem_free(p)             free(p)
+#define aos_mem_zero(p, size)       memset((p), 0, (size))
+#define aos_lock_init(lock)         (*(lock) = 0)
+#define aos_lock_bh(lock)           (*(lock) = 1)
+#define aos_unlock_bh(lock)         (*(lock) = 0)
+#define aos_printk                  printf
+
+#endif                          /* _SW_H_ */
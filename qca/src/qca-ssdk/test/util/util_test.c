@@ -0,0 +1,244 @@
+/* SPDX-License-Identifier: ISC */
+
+
+/*
+ * Userspace unit test and benchmark for the ordered lists and id pools of
+ * src/util/util.c.
+ *
+ *   util_test          random insert/delete/find against a reference
+ *                      array, checking the AVL invariants as it goes
+ *   util_test -b [n]   time n ordered inserts, lookups, walks and deletes
+ */
+
+#include <time.h>
+#include "sw.h"
+#include "util.h"
+
+#define TEST_NR       5000
+#define TEST_OPS      200000
+#define TEST_CHK_INTV 1000
+
+#define TEST_ASSERT(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+static ll_cmp_rslt_t
+test_cmp(void *src, void *dest)
+{
+    a_uint32_t a = *(a_uint32_t *)src;
+    a_uint32_t b = *(a_uint32_t *)dest;
+
+    if (a == b)
+    {
+        return LL_CMP_EQUAL;
+    }
+    return (a > b) ? LL_CMP_GREATER : LL_CMP_SMALLER;
+}
+
+/* returns the height of the subtree, aborts on a broken link or balance */
+static a_int32_t
+test_avl_check(const sll_node_t * node, const sll_node_t * parent)
+{
+    a_int32_t l, r;
+
+    if (NULL == node)
+    {
+        return 0;
+    }
+
+    TEST_ASSERT(node->parent == parent);
+    l = test_avl_check(node->left, node);
+    r = test_avl_check(node->right, node);
+    TEST_ASSERT((l - r) <= 1 && (r - l) <= 1);
+    TEST_ASSERT(node->height == ((l > r) ? l : r) + 1);
+    return node->height;
+}
+
+static void
+test_list_check(sll_head_t * sll, const a_uint8_t * present)
+{
+    a_ulong_t iterator = 0;
+    a_uint32_t *data, cnt = 0;
+    a_int32_t last = -1;
+
+    test_avl_check(sll->root, NULL);
+    while (NULL != (data = sll_nd_next(sll, &iterator)))
+    {
+        TEST_ASSERT((a_int32_t)*data > last);
+        TEST_ASSERT(present[*data]);
+        last = *data;
+        cnt++;
+    }
+    TEST_ASSERT(cnt == sll->nd_nr);
+}
+
+static void
+test_sll(a_uint32_t flag)
+{
+    static a_uint32_t val[TEST_NR];
+    static a_uint8_t present[TEST_NR];
+    sll_head_t *sll;
+    a_ulong_t iterator;
+    a_uint32_t i, k;
+    sw_error_t rv;
+
+    sll = sll_creat(test_cmp, NULL, flag, TEST_NR);
+    TEST_ASSERT(NULL != sll);
+
+    for (i = 0; i < TEST_NR; i++)
+    {
+        val[i] = i;
+        present[i] = 0;
+    }
+
+    srand(1);
+    for (k = 0; k < TEST_OPS; k++)
+    {
+        i = rand() % TEST_NR;
+        if (rand() & 1)
+        {
+            rv = sll_nd_insert(sll, &val[i]);
+            TEST_ASSERT((SW_OK == rv) == !present[i]);
+            present[i] = 1;
+        }
+        else
+        {
+            rv = sll_nd_delete(sll, &val[i]);
+            TEST_ASSERT((SW_OK == rv) == present[i]);
+            present[i] = 0;
+        }
+
+        TEST_ASSERT((NULL != sll_nd_find(sll, &val[i], &iterator)) == present[i]);
+        if (0 == (k % TEST_CHK_INTV))
+        {
+            test_list_check(sll, present);
+        }
+    }
+
+    test_list_check(sll, present);
+    sll_destroy(sll);
+}
+
+static void
+test_sid_pool(void)
+{
+    sid_pool_t *pool;
+    a_uint32_t id, i;
+    a_uint8_t used[64];
+
+    pool = sid_pool_creat(64, 100);
+    TEST_ASSERT(NULL != pool);
+
+    memset(used, 0, sizeof(used));
+    for (i = 0; i < 64; i++)
+    {
+        TEST_ASSERT(SW_OK == sid_pool_id_alloc(pool, &id));
+        TEST_ASSERT((id >= 100) && (id < 164) && !used[id - 100]);
+        used[id - 100] = 1;
+    }
+    TEST_ASSERT(SW_NO_RESOURCE == sid_pool_id_alloc(pool, &id));
+
+    TEST_ASSERT(SW_OK == sid_pool_id_free(pool, 130));
+    TEST_ASSERT(SW_OK == sid_pool_id_alloc(pool, &id));
+    TEST_ASSERT(130 == id);
+
+    sid_pool_destroy(pool);
+}
+
+static double
+test_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+test_bench(a_uint32_t nr)
+{
+    a_uint32_t *val, i, j, tmp, *data;
+    a_ulong_t iterator;
+    sll_head_t *sll;
+    double t0, t_ins, t_find, t_walk, t_del;
+
+    val = malloc(nr * sizeof(*val));
+    TEST_ASSERT(NULL != val);
+    sll = sll_creat(test_cmp, NULL, LL_IN_ORDER, 0);
+    TEST_ASSERT(NULL != sll);
+
+    /* insert in random order, as entries are created by users */
+    for (i = 0; i < nr; i++)
+    {
+        val[i] = i;
+    }
+    srand(2);
+    for (i = nr - 1; i > 0; i--)
+    {
+        j = rand() % (i + 1);
+        tmp = val[i];
+        val[i] = val[j];
+        val[j] = tmp;
+    }
+
+    t0 = test_now();
+    for (i = 0; i < nr; i++)
+    {
+        TEST_ASSERT(SW_OK == sll_nd_insert(sll, &val[i]));
+    }
+    t_ins = test_now() - t0;
+
+    t0 = test_now();
+    for (i = 0; i < nr; i++)
+    {
+        TEST_ASSERT(NULL != sll_nd_find(sll, &val[i], &iterator));
+    }
+    t_find = test_now() - t0;
+
+    t0 = test_now();
+    iterator = 0;
+    for (i = 0; NULL != (data = sll_nd_next(sll, &iterator)); i++)
+    {
+        TEST_ASSERT(*data == i);
+    }
+    t_walk = test_now() - t0;
+
+    t0 = test_now();
+    for (i = 0; i < nr; i++)
+    {
+        TEST_ASSERT(SW_OK == sll_nd_delete(sll, &val[i]));
+    }
+    t_del = test_now() - t0;
+
+    printf("%u entries, ns per entry: insert %.1f  find %.1f  walk %.1f  delete %.1f\n",
+           nr, t_ins * 1e9 / nr, t_find * 1e9 / nr, t_walk * 1e9 / nr,
+           t_del * 1e9 / nr);
+
+    sll_destroy(sll);
+    free(val);
+}
+
+int
+main(int argc, char **argv)
+{
+    a_uint32_t nr;
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "-b")))
+    {
+        nr = (argc > 2) ? strtoul(argv[2], NULL, 0) : 4096;
+        TEST_ASSERT(nr > 0);
+        test_bench(nr);
+        return 0;
+    }
+
+    test_sll(LL_IN_ORDER);
+    test_sll(LL_IN_ORDER | LL_FIX_NDNR);
+    test_sid_pool();
+    printf("util: ok\n");
+    return 0;
+}
@@ -0,0 +1,150 @@
+#!/bin/sh
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Time "conf --defconfig" on a large generated Config.in.
+#
+# The generated tree has menus, choices, bool/tristate/int/string symbols
+# with dependencies, selects, implies and conditional defaults, plus a
+# defconfig setting a random part of them. Every conf binary given is run
+# on the same tree; the first one is the reference and the .config of the
+# others is compared against it.
+#
+# Usage: bench-defconfig.sh [-n symbols] [-s seed] [-r runs] [conf ...]
+# Without a conf argument ./conf next to this script is used.
+
+SYMBOLS=20000
+SEED=1
+RUNS=3
+
+while getopts "n:r:s:" opt; do
+	case "$opt" in
+		n) SYMBOLS="$OPTARG";;
+		r) RUNS="$OPTARG";;
+		s) SEED="$OPTARG";;
+		*) echo "usage: $0 [-n symbols] [-s seed] [-r runs] [conf ...]" >&2; exit 1;;
+	esac
+done
+shift $((OPTIND - 1))
+[ $# -gt 0 ] || set -- "$(dirname "$0")/conf"
+
+DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$DIR"' EXIT INT TERM
+
+awk -v n="$SYMBOLS" -v seed="$SEED" -v cin="$DIR/Config.in" -v def="$DIR/defconfig" '
+# Symbols are only used by symbols defined after them and selected or
+# implied symbols depend on nothing, so there are no dependency
+# loops, whose values would depend on the evaluation order.
+
+# a bool or tristate symbol defined before, among the last "near" ones
+function pick(near,   lo) {
+	lo = nb > near ? nb - near : 0
+	return "S" bt[int(lo + rand() * (nb - lo))]
+}
+function dep(   d) {
+	d = pick(200)
+	if (rand() < 0.3)
+		d = d (rand() < 0.5 ? " && " : " || ") pick(nb)
+	if (rand() < 0.1)
+		d = "!" d
+	return d
+}
+BEGIN {
+	srand(seed)
+	print "config MODULES\n\tbool\n\tdefault y\n\toption modules\n" > cin
+	for (i = 0; i < n; i++) {
+		if (i % 100 == 0) {
+			if (i)
+				print "endmenu\n" > cin
+			print "menu \"menu " i / 100 "\"\n" > cin
+		}
+		if (i > 0 && i % 500 == 0) {
+			print "choice\n\tprompt \"choice " i "\"" > cin
+			if (rand() < 0.5)
+				print "\tdepends on " dep() > cin
+			print "" > cin
+			for (c = 0; c < 4; c++)
+				print "config C" i "_" c "\n\tbool \"C" i "_" c "\"\n" > cin
+			print "endchoice\n" > cin
+			if (rand() < 0.3)
+				print "CONFIG_C" i "_" int(rand() * 4) "=y" > def
+		}
+
+		# library symbols, only selected or implied
+		if (i % 10 == 5) {
+			print "config L" i "\n\ttristate\n" > cin
+			lib[nl++] = i
+			continue
+		}
+
+		r = rand()
+		type = r < 0.55 ? "bool" : r < 0.9 ? "tristate" : r < 0.95 ? "int" : "string"
+		print "config S" i > cin
+		if (rand() < 0.8)
+			print "\t" type " \"S" i "\"" > cin
+		else
+			print "\t" type > cin
+		if (nb && rand() < 0.6)
+			print "\tdepends on " dep() > cin
+		if (type == "bool" || type == "tristate") {
+			if (nl && rand() < 0.2)
+				print "\tselect L" lib[int(rand() * nl)] > cin
+			if (nl && rand() < 0.05)
+				print "\timply L" lib[int(rand() * nl)] > cin
+			if (nb && rand() < 0.3)
+				print "\tdefault y if " dep() > cin
+			if (rand() < 0.2)
+				print "\tdefault " (type == "tristate" ? "m" : "y") > cin
+			if (rand() < 0.2)
+				print "CONFIG_S" i "=" (rand() < 0.7 ? "y" : "n") > def
+			bt[nb++] = i
+		} else if (type == "int") {
+			print "\trange 0 1000\n\tdefault " int(rand() * 1000) > cin
+			if (rand() < 0.2)
+				print "CONFIG_S" i "=" int(rand() * 2000) > def
+		} else {
+			print "\tdefault \"s" i "\"" > cin
+			if (rand() < 0.2)
+				print "CONFIG_S" i "=\"v" i "\"" > def
+		}
+		print "" > cin
+	}
+	print "endmenu" > cin
+}'
+
+# user + system ms of the children between two "times" outputs, which
+# have to come from this shell as a subshell starts with no children
+cpu_ms() {
+	awk 'FNR == 2 {
+		split($1, u, /[ms]/); split($2, s, /[ms]/)
+		t[FILENAME] = (u[1] * 60 + u[2] + s[1] * 60 + s[2]) * 1000
+	}
+	END { print int(t[ARGV[2]] - t[ARGV[1]] + 0.5) }' "$1" "$2"
+}
+
+echo "$SYMBOLS symbols, $(grep -c . "$DIR/defconfig") defconfig lines"
+
+REF=
+for conf in "$@"; do
+	best=
+	run=0
+	while [ $run -lt "$RUNS" ]; do
+		times > "$DIR/t0"
+		KCONFIG_CONFIG="$DIR/config" "$conf" --defconfig="$DIR/defconfig" \
+			"$DIR/Config.in" > "$DIR/log" 2>&1 || { cat "$DIR/log"; exit 1; }
+		times > "$DIR/t1"
+		t=$(cpu_ms "$DIR/t0" "$DIR/t1")
+		[ -z "$best" ] || [ $t -lt $best ] && best=$t
+		run=$((run + 1))
+	done
+
+	if [ -z "$REF" ]; then
+		REF="$DIR/config.ref"
+		cp "$DIR/config" "$REF"
+		same=reference
+	elif cmp -s "$DIR/config" "$REF"; then
+		same="same .config"
+	else
+		same="DIFFERENT .config"
+	fi
+	echo "$conf: $best ms cpu, $same"
+done
@@ -568,7 +568,8 @@ int conf_read(const char *name)
 				/* Reset a string value if it's out of range */
 				if (sym_string_within_range(sym, sym->def[S_DEF_USER].val))
 					break;
-				sym->flags &= ~(SYMBOL_VALID|SYMBOL_DEF_USER);
+				sym->flags &= ~SYMBOL_DEF_USER;
+				sym_clear_users_valid(sym);
 				conf_unsaved++;
 				break;
 			default:
@@ -1250,7 +1251,15 @@ bool conf_set_all_new_symbols(enum conf_def_mode mode)
 	}
 	bool has_changed = false;
 
-	sym_clear_all_valid();
+	/*
+	 * Defaults don't assign any symbol, so the values calculated by
+	 * conf_read() stay valid and only the users of the choices set
+	 * below are recalculated.
+	 */
+	if (mode == def_default)
+		sym_add_change_count(1);
+	else
+		sym_clear_all_valid();
 
 	for_all_symbols(i, sym) {
 		if (sym_has_value(sym) || (sym->flags & SYMBOL_VALID))
@@ -1321,6 +1330,8 @@ bool conf_set_all_new_symbols(enum conf_def_mode mode)
 			has_changed = randomize_choice_values(csym);
 		else {
 			set_all_choice_values(csym);
+			if (mode == def_default)
+				sym_clear_users_valid(csym);
 			has_changed = true;
 		}
 	}
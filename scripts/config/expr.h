@@ -129,6 +129,15 @@ struct symbol {
 	 * "Weak" reverse dependencies through being implied by other symbols
 	 */
 	struct expr_value implied;
+
+	/*
+	 * Symbols whose value or visibility was calculated from this symbol,
+	 * recorded by sym_calc_value(). Used to invalidate only those when
+	 * the value of this symbol is changed, instead of recalculating every
+	 * symbol.
+	 */
+	struct symbol **users;
+	int users_count;
 };
 
 #define for_all_symbols(i, sym) for (i = 0; i < SYMBOL_HASHSIZE; i++) for (sym = symbol_hash[i]; sym; sym = sym->next)
@@ -159,8 +168,11 @@ struct symbol {
 /* Set symbol to y if allnoconfig; used for symbols that hide others */
 #define SYMBOL_ALLNOCONFIG_Y 0x200000
 
+/* used while invalidating the users of a changed symbol */
+#define SYMBOL_INVALIDATE 0x400000
+
 #define SYMBOL_MAXLENGTH	256
-#define SYMBOL_HASHSIZE		9973
+#define SYMBOL_HASHSIZE		65521
 
 /* A property represent the config options that can be associated
  * with a config "symbol".
@@ -169,6 +169,49 @@ static void sym_set_all_changed(void)
 		sym_set_changed(sym);
 }
 
+/* symbol whose value is being calculated, it uses the symbols it reads */
+static struct symbol *calc_user;
+
+static int sym_ptr_cmp(const void *a, const void *b)
+{
+	const struct symbol *x = *(struct symbol * const *)a;
+	const struct symbol *y = *(struct symbol * const *)b;
+
+	return (x > y) - (x < y);
+}
+
+/*
+ * Record that the value of user was calculated from sym. A symbol may read
+ * other symbols on each recalculation, so the list is compacted before it
+ * grows.
+ */
+static void sym_add_user(struct symbol *sym, struct symbol *user)
+{
+	int i, n;
+
+	if (!user || sym == user || (sym->flags & SYMBOL_CONST))
+		return;
+
+	n = sym->users_count;
+
+	/* expressions often refer to the same symbol several times */
+	if (n && sym->users[n - 1] == user)
+		return;
+
+	if (n >= 16 && !(n & (n - 1))) {
+		qsort(sym->users, n, sizeof(*sym->users), sym_ptr_cmp);
+		for (i = 1, n = 1; i < sym->users_count; i++)
+			if (sym->users[i] != sym->users[n - 1])
+				sym->users[n++] = sym->users[i];
+		sym->users_count = n;
+	}
+
+	if (!(n & (n - 1)))
+		sym->users = xrealloc(sym->users,
+				      (n ? n * 2 : 1) * sizeof(*sym->users));
+	sym->users[sym->users_count++] = user;
+}
+
 static void sym_calc_visibility(struct symbol *sym)
 {
 	struct property *prop;
@@ -178,8 +221,10 @@ static void sym_calc_visibility(struct symbol *sym)
 	/* any prompt visible? */
 	tri = no;
 
-	if (sym_is_choice_value(sym))
+	if (sym_is_choice_value(sym)) {
 		choice_sym = prop_get_symbol(sym_get_choice_prop(sym));
+		sym_add_user(choice_sym, calc_user);
+	}
 
 	for_all_prompts(sym, prop) {
 		prop->visible.tri = expr_calc_value(prop->visible.expr);
@@ -275,6 +320,7 @@ static struct symbol *sym_calc_choice(struct symbol *sym)
 	flags = sym->flags;
 	prop = sym_get_choice_prop(sym);
 	expr_list_for_each_sym(prop->expr, e, def_sym) {
+		sym_add_user(def_sym, sym);
 		sym_calc_visibility(def_sym);
 		if (def_sym->visible != no)
 			flags &= def_sym->flags;
@@ -296,18 +342,12 @@ static struct symbol *sym_calc_choice(struct symbol *sym)
 	return def_sym;
 }
 
-void sym_calc_value(struct symbol *sym)
+static void __sym_calc_value(struct symbol *sym)
 {
 	struct symbol_value newval, oldval;
 	struct property *prop;
 	struct expr *e;
 
-	if (!sym)
-		return;
-
-	if (sym->flags & SYMBOL_VALID)
-		return;
-
 	if (sym_is_choice_value(sym) &&
 	    sym->flags & SYMBOL_NEED_SET_CHOICE_VALUES) {
 		sym->flags &= ~SYMBOL_NEED_SET_CHOICE_VALUES;
@@ -439,6 +479,28 @@ void sym_calc_value(struct symbol *sym)
 		set_all_choice_values(sym);
 }
 
+/*
+ * Values are memoized until SYMBOL_VALID is cleared. The symbols read while
+ * calculating a value are calculated first and record the reader as their
+ * user, so a change only invalidates what was calculated from it.
+ */
+void sym_calc_value(struct symbol *sym)
+{
+	struct symbol *user;
+
+	if (!sym)
+		return;
+
+	sym_add_user(sym, calc_user);
+	if (sym->flags & SYMBOL_VALID)
+		return;
+
+	user = calc_user;
+	calc_user = sym;
+	__sym_calc_value(sym);
+	calc_user = user;
+}
+
 void sym_clear_all_valid(void)
 {
 	struct symbol *sym;
@@ -450,6 +512,59 @@ void sym_clear_all_valid(void)
 	sym_calc_value(modules_sym);
 }
 
+static struct symbol **invalidate_list;
+static int invalidate_count, invalidate_size;
+
+static bool sym_mark_users(struct symbol *sym)
+{
+	int i;
+
+	if (sym->flags & SYMBOL_INVALIDATE)
+		return true;
+	if (sym == modules_sym)
+		return false;
+
+	if (invalidate_count == invalidate_size) {
+		invalidate_size = invalidate_size ? invalidate_size * 2 : 64;
+		invalidate_list = xrealloc(invalidate_list,
+				invalidate_size * sizeof(*invalidate_list));
+	}
+	invalidate_list[invalidate_count++] = sym;
+	sym->flags |= SYMBOL_INVALIDATE;
+
+	for (i = 0; i < sym->users_count; i++)
+		if (!sym_mark_users(sym->users[i]))
+			return false;
+
+	return true;
+}
+
+/*
+ * Invalidate the value of sym and of all symbols that (transitively) were
+ * calculated from it. Values of unrelated symbols stay cached. Changes
+ * reaching the modules symbol affect every tristate, so fall back to a full
+ * recalculation.
+ */
+void sym_clear_users_valid(struct symbol *sym)
+{
+	bool partial;
+	int i;
+
+	invalidate_count = 0;
+	partial = sym_mark_users(sym);
+
+	for (i = 0; i < invalidate_count; i++)
+		invalidate_list[i]->flags &= ~(SYMBOL_INVALIDATE | SYMBOL_VALID);
+
+	if (!partial) {
+		sym_clear_all_valid();
+		return;
+	}
+
+	sym_add_change_count(1);
+	sym_calc_value(modules_sym);
+}
+
 bool sym_tristate_within_range(struct symbol *sym, tristate val)
 {
 	int type = sym_get_type(sym);
@@ -502,7 +617,7 @@ bool sym_set_tristate_value(struct symbol *sym, tristate val)
 
 	sym->def[S_DEF_USER].tri = val;
 	if (oldval != val)
-		sym_clear_all_valid();
+		sym_clear_users_valid(sym);
 
 	return true;
 }
@@ -659,7 +774,7 @@ bool sym_set_string_value(struct symbol *sym, const char *newval)
 
 	strcpy(val, newval);
 	free((void *)oldval);
-	sym_clear_all_valid();
+	sym_clear_users_valid(sym);
 
 	return true;
 }
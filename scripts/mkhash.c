@@ -86,12 +86,21 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 #define ARRAY_SIZE(_n) (sizeof(_n) / sizeof((_n)[0]))
 
 #ifndef __FreeBSD__
@@ -451,6 +460,26 @@ be32dec_vect(uint32_t *dst, const unsigned char *src, size_t len)
 #define Maj(x, y, z)	((x & (y | z)) | (y & z))
 #define ROTR(x, n)	((x >> n) | (x << (32 - n)))
 
+/* SHA256 round constants. */
+static const uint32_t SHA256_K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
@@ -458,25 +487,6 @@ be32dec_vect(uint32_t *dst, const unsigned char *src, size_t len)
 static void
 SHA256_Transform(uint32_t * state, const unsigned char block[64])
 {
-	/* SHA256 round constants. */
-	static const uint32_t K[64] = {
-		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-		0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-		0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-		0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-		0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-		0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-		0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-		0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-		0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-	};
 	uint32_t W[64];
 	uint32_t S[8];
 	int i;
@@ -498,7 +508,7 @@ SHA256_Transform(uint32_t * state, const unsigned char block[64])
 	    S[(66 - i) % 8], S[(67 - i) % 8],	\
 	    S[(68 - i) % 8], S[(69 - i) % 8],	\
 	    S[(70 - i) % 8], S[(71 - i) % 8],	\
-	    W[i + ii] + K[i + ii])
+	    W[i + ii] + SHA256_K[i + ii])
 
 /* Message schedule computation */
 #define MSCH(W, ii, i)				\
@@ -562,6 +572,110 @@ SHA256_Transform(uint32_t * state, const unsigned char block[64])
 		state[i] += S[i];
 }
 
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define HAVE_SHA256_SHANI
+
+/*
+ * SHA256 compression using the x86 SHA extensions.  The state is kept in
+ * ABEF/CDGH order as required by sha256rnds2, and the message schedule for
+ * each group of four rounds is derived from the previous four groups.
+ */
+__attribute__((target("sha,sse4.1")))
+static void
+SHA256_Transform_shani(uint32_t *state, const unsigned char *data, size_t blocks)
+{
+	const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+					    0x0405060700010203ULL);
+	__m128i STATE0, STATE1, ABEF_SAVE, CDGH_SAVE, MSG, TMP;
+	__m128i W[4];
+	int i;
+
+	TMP = _mm_loadu_si128((const __m128i *)&state[0]);
+	STATE1 = _mm_loadu_si128((const __m128i *)&state[4]);
+
+	TMP = _mm_shuffle_epi32(TMP, 0xB1);		/* CDAB */
+	STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);	/* EFGH */
+	STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);	/* ABEF */
+	STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);	/* CDGH */
+
+	while (blocks--) {
+		ABEF_SAVE = STATE0;
+		CDGH_SAVE = STATE1;
+
+		for (i = 0; i < 16; i++) {
+			if (i < 4) {
+				MSG = _mm_loadu_si128((const __m128i *)(data + i * 16));
+				W[i] = _mm_shuffle_epi8(MSG, MASK);
+			} else {
+				TMP = _mm_alignr_epi8(W[(i - 1) & 3], W[(i - 2) & 3], 4);
+				MSG = _mm_sha256msg1_epu32(W[i & 3], W[(i - 3) & 3]);
+				MSG = _mm_add_epi32(MSG, TMP);
+				W[i & 3] = _mm_sha256msg2_epu32(MSG, W[(i - 1) & 3]);
+			}
+
+			MSG = _mm_add_epi32(W[i & 3],
+				_mm_loadu_si128((const __m128i *)&SHA256_K[i * 4]));
+			STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+			MSG = _mm_shuffle_epi32(MSG, 0x0E);
+			STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+		}
+
+		STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+		STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
+		data += 64;
+	}
+
+	TMP = _mm_shuffle_epi32(STATE0, 0x1B);		/* FEBA */
+	STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);	/* DCHG */
+	STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);	/* DCBA */
+	STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);	/* ABEF */
+
+	_mm_storeu_si128((__m128i *)&state[0], STATE0);
+	_mm_storeu_si128((__m128i *)&state[4], STATE1);
+}
+
+static bool
+SHA256_have_shani(void)
+{
+	static int have = -1;
+	unsigned int eax, ebx, ecx, edx;
+
+	if (have >= 0)
+		return have;
+
+	have = 0;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+	    !(ecx & bit_SSE4_1) || !(ecx & bit_SSSE3) ||
+	    __get_cpuid_max(0, NULL) < 7)
+		return have;
+
+	/* __get_cpuid_count() is only provided by GCC 7 and later */
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	if (ebx & (1 << 29))
+		have = 1;
+
+	return have;
+}
+#endif
+
+/* Compress a run of complete 64 byte blocks */
+static void
+SHA256_Transform_blocks(uint32_t *state, const unsigned char *data, size_t blocks)
+{
+#ifdef HAVE_SHA256_SHANI
+	if (SHA256_have_shani()) {
+		SHA256_Transform_shani(state, data, blocks);
+		return;
+	}
+#endif
+
+	while (blocks--) {
+		SHA256_Transform(state, data);
+		data += 64;
+	}
+}
+
 static unsigned char PAD[64] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -647,11 +761,9 @@ SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 	len -= 64 - r;
 
 	/* Perform complete blocks */
-	while (len >= 64) {
-		SHA256_Transform(ctx->state, src);
-		src += 64;
-		len -= 64;
-	}
+	SHA256_Transform_blocks(ctx->state, src, len / 64);
+	src += len & ~(size_t)63;
+	len &= 63;
 
 	/* Copy left over data into buffer */
 	memcpy(ctx->buf, src, len);
@@ -674,71 +786,214 @@ SHA256_Final(unsigned char digest[static SHA256_DIGEST_LENGTH], SHA256_CTX *ctx)
 	memset(ctx, 0, sizeof(*ctx));
 }
 
-static void *hash_buf(FILE *f, int *len)
+union hash_ctx {
+	MD5_CTX md5;
+	SHA256_CTX sha256;
+};
+
+struct hash_type {
+	const char *name;
+	void (*init)(union hash_ctx *ctx);
+	void (*update)(union hash_ctx *ctx, const void *data, size_t len);
+	void (*final)(unsigned char *val, union hash_ctx *ctx);
+	int len;
+};
+
+/* A single file to hash, filled in by hash_job_run() */
+struct hash_job {
+	const char *filename;
+	const char *error;
+	char str[SHA256_DIGEST_LENGTH * 2 + 1];
+};
+
+/* Hands out jobs to the worker threads in order */
+struct hash_pool {
+	struct hash_type *t;
+	struct hash_job *jobs;
+	int n_jobs;
+	int next;
+	pthread_mutex_t lock;
+};
+
+static void md5_init(union hash_ctx *ctx)
+{
+	MD5_begin(&ctx->md5);
+}
+
+static void md5_update(union hash_ctx *ctx, const void *data, size_t len)
 {
-	static char buf[1024];
+	MD5_hash(data, len, &ctx->md5);
+}
 
-	*len = fread(buf, 1, sizeof(buf), f);
+static void md5_final(unsigned char *val, union hash_ctx *ctx)
+{
+	MD5_end(val, &ctx->md5);
+}
 
-	return *len > 0 ? buf : NULL;
+static void sha256_init(union hash_ctx *ctx)
+{
+	SHA256_Init(&ctx->sha256);
 }
 
-static char *hash_string(unsigned char *buf, int len)
+static void sha256_update(union hash_ctx *ctx, const void *data, size_t len)
 {
-	static char str[SHA256_DIGEST_LENGTH * 2 + 1];
-	int i;
+	SHA256_Update(&ctx->sha256, data, len);
+}
+
+static void sha256_final(unsigned char *val, union hash_ctx *ctx)
+{
+	SHA256_Final(val, &ctx->sha256);
+}
+
+struct hash_type types[] = {
+	{ "md5", md5_init, md5_update, md5_final, MD5_DIGEST_LENGTH },
+	{ "sha256", sha256_init, sha256_update, sha256_final, SHA256_DIGEST_LENGTH },
+};
 
-	if (len * 2 + 1 > sizeof(str))
-		return NULL;
+static void hash_string(char *str, unsigned char *buf, int len)
+{
+	int i;
 
 	for (i = 0; i < len; i++)
 		sprintf(&str[i * 2], "%02x", buf[i]);
-
-	return str;
 }
 
-static const char *md5_hash(FILE *f)
+static int hash_stream(struct hash_type *t, union hash_ctx *ctx, int fd)
 {
-	MD5_CTX ctx;
-	unsigned char val[MD5_DIGEST_LENGTH];
-	void *buf;
-	int len;
+	char buf[16384];
+	ssize_t len;
 
-	MD5_begin(&ctx);
-	while ((buf = hash_buf(f, &len)) != NULL)
-		MD5_hash(buf, len, &ctx);
-	MD5_end(val, &ctx);
+	while ((len = read(fd, buf, sizeof(buf))) > 0)
+		t->update(ctx, buf, len);
 
-	return hash_string(val, MD5_DIGEST_LENGTH);
+	return len < 0 ? -1 : 0;
 }
 
-static const char *sha256_hash(FILE *f)
+/*
+ * Regular files are mapped and hashed in one go, everything else (stdin,
+ * pipes, files that cannot be mapped) is read in chunks.
+ */
+static void hash_job_run(struct hash_type *t, struct hash_job *job)
 {
-	SHA256_CTX ctx;
 	unsigned char val[SHA256_DIGEST_LENGTH];
-	void *buf;
-	int len;
+	union hash_ctx ctx;
+	struct stat path_stat;
+	bool mapped = false;
+	int fd = STDIN_FILENO;
+	int ret = 0;
+
+	job->error = NULL;
+
+	if (job->filename && strcmp(job->filename, "-") != 0) {
+		fd = open(job->filename, O_RDONLY);
+		if (fd < 0) {
+			job->error = "Failed to open '%s'\n";
+			return;
+		}
+	}
+
+	if (fstat(fd, &path_stat) == 0 && S_ISDIR(path_stat.st_mode)) {
+		job->error = "Failed to open '%s': Is a directory\n";
+		goto out;
+	}
 
-	SHA256_Init(&ctx);
-	while ((buf = hash_buf(f, &len)) != NULL)
-		SHA256_Update(&ctx, buf, len);
-	SHA256_Final(val, &ctx);
+	t->init(&ctx);
 
-	return hash_string(val, SHA256_DIGEST_LENGTH);
+	if (fd != STDIN_FILENO && S_ISREG(path_stat.st_mode) &&
+	    path_stat.st_size > 0 && (off_t)(size_t)path_stat.st_size == path_stat.st_size) {
+		void *data = mmap(NULL, path_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (data != MAP_FAILED) {
+			t->update(&ctx, data, path_stat.st_size);
+			munmap(data, path_stat.st_size);
+			mapped = true;
+		}
+	}
+
+	if (!mapped)
+		ret = hash_stream(t, &ctx, fd);
+
+	t->final(val, &ctx);
+
+	if (ret)
+		job->error = "Failed to generate hash\n";
+	else
+		hash_string(job->str, val, t->len);
+
+out:
+	if (fd != STDIN_FILENO)
+		close(fd);
 }
 
+static void *hash_worker(void *arg)
+{
+	struct hash_pool *pool = arg;
+	int i;
 
-struct hash_type {
-	const char *name;
-	const char *(*func)(FILE *f);
-	int len;
-};
+	while (1) {
+		pthread_mutex_lock(&pool->lock);
+		i = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
 
-struct hash_type types[] = {
-	{ "md5", md5_hash, MD5_DIGEST_LENGTH },
-	{ "sha256", sha256_hash, SHA256_DIGEST_LENGTH },
-};
+		if (i >= pool->n_jobs)
+			break;
+
+		hash_job_run(pool->t, &pool->jobs[i]);
+	}
+
+	return NULL;
+}
+
+static void hash_jobs_parallel(struct hash_type *t, struct hash_job *jobs,
+	int n_jobs, int n_threads)
+{
+	struct hash_pool pool = {
+		.t = t,
+		.jobs = jobs,
+		.n_jobs = n_jobs,
+	};
+	pthread_t *threads;
+	int i, started = 0;
+
+	if (n_threads > n_jobs)
+		n_threads = n_jobs;
+
+	threads = calloc(n_threads, sizeof(*threads));
+	if (!threads)
+		n_threads = 0;
+
+	pthread_mutex_init(&pool.lock, NULL);
+
+	for (i = 0; i < n_threads; i++) {
+		if (pthread_create(&threads[i], NULL, hash_worker, &pool))
+			break;
+		started++;
+	}
+
+	/* Whatever the workers did not pick up is handled here */
+	hash_worker(&pool);
+
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	pthread_mutex_destroy(&pool.lock);
+	free(threads);
+}
+
+static int hash_job_print(struct hash_job *job, bool add_filename, bool no_newline)
+{
+	if (job->error) {
+		fprintf(stderr, job->error, job->filename ? job->filename : "-");
+		return 1;
+	}
 
+	if (add_filename)
+		printf("%s %s%s", job->str, job->filename ? job->filename : "-",
+			no_newline ? "" : "\n");
+	else
+		printf("%s%s", job->str, no_newline ? "" : "\n");
+	return 0;
+}
 
 static int usage(const char *progname)
 {
@@ -748,6 +1003,8 @@ static int usage(const char *progname)
 		"Options:\n"
 		"	-n		Print filename(s)\n"
 		"	-N		Suppress trailing newline\n"
+		"	-f <file>	Read names of files to hash from <file>, one per line\n"
+		"	-j <jobs>	Hash files using <jobs> parallel threads\n"
 		"\n"
 		"Supported hash types:", progname);
 
@@ -771,42 +1028,57 @@ static struct hash_type *get_hash_type(const char *name)
 	return NULL;
 }
 
+static int add_job(struct hash_job **jobs, int *n_jobs, const char *filename)
+{
+	struct hash_job *new_jobs;
 
-static int hash_file(struct hash_type *t, const char *filename, bool add_filename,
-	bool no_newline)
+	if (!(*n_jobs % 64)) {
+		new_jobs = realloc(*jobs, (*n_jobs + 64) * sizeof(**jobs));
+		if (!new_jobs)
+			return -1;
+		*jobs = new_jobs;
+	}
+
+	memset(&(*jobs)[*n_jobs], 0, sizeof(**jobs));
+	(*jobs)[(*n_jobs)++].filename = filename;
+	return 0;
+}
+
+static int read_manifest(const char *manifest, struct hash_job **jobs, int *n_jobs)
 {
-	const char *str;
+	FILE *f = stdin;
+	char *line = NULL;
+	size_t size = 0;
+	ssize_t len;
 
-	if (!filename || !strcmp(filename, "-")) {
-		str = t->func(stdin);
-	} else {
-		struct stat path_stat;
-		stat(filename, &path_stat);
-		if (S_ISDIR(path_stat.st_mode)) {
-			fprintf(stderr, "Failed to open '%s': Is a directory\n", filename);
+	if (strcmp(manifest, "-") != 0) {
+		f = fopen(manifest, "r");
+		if (!f) {
+			fprintf(stderr, "Failed to open '%s'\n", manifest);
 			return 1;
 		}
+	}
 
-		FILE *f = fopen(filename, "r");
+	while ((len = getline(&line, &size, f)) > 0) {
+		char *filename;
 
-		if (!f) {
-			fprintf(stderr, "Failed to open '%s'\n", filename);
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+			line[--len] = 0;
+
+		if (!len)
+			continue;
+
+		filename = strdup(line);
+		if (!filename || add_job(jobs, n_jobs, filename)) {
+			fprintf(stderr, "Out of memory\n");
 			return 1;
 		}
-		str = t->func(f);
-		fclose(f);
 	}
 
-	if (!str) {
-		fprintf(stderr, "Failed to generate hash\n");
-		return 1;
-	}
+	free(line);
+	if (f != stdin)
+		fclose(f);
 
-	if (add_filename)
-		printf("%s %s%s", str, filename ? filename : "-",
-			no_newline ? "" : "\n");
-	else
-		printf("%s%s", str, no_newline ? "" : "\n");
 	return 0;
 }
 
@@ -814,11 +1086,13 @@ static int hash_file(struct hash_type *t, const char *filename, bool add_filenam
 int main(int argc, char **argv)
 {
 	struct hash_type *t;
+	struct hash_job *jobs = NULL;
 	const char *progname = argv[0];
-	int i, ch;
+	const char *manifest = NULL;
+	int i, ch, n_jobs = 0, n_threads = 1;
 	bool add_filename = false, no_newline = false;
 
-	while ((ch = getopt(argc, argv, "nN")) != -1) {
+	while ((ch = getopt(argc, argv, "nNf:j:")) != -1) {
 		switch (ch) {
 		case 'n':
 			add_filename = true;
@@ -826,6 +1100,14 @@ int main(int argc, char **argv)
 		case 'N':
 			no_newline = true;
 			break;
+		case 'f':
+			manifest = optarg;
+			break;
+		case 'j':
+			n_threads = atoi(optarg);
+			if (n_threads < 1)
+				return usage(progname);
+			break;
 		default:
 			return usage(progname);
 		}
@@ -841,13 +1123,30 @@ int main(int argc, char **argv)
 	if (!t)
 		return usage(progname);
 
-	if (argc < 2)
-		return hash_file(t, NULL, add_filename, no_newline);
+	for (i = 1; i < argc; i++) {
+		if (add_job(&jobs, &n_jobs, argv[i])) {
+			fprintf(stderr, "Out of memory\n");
+			return 1;
+		}
+	}
+
+	if (manifest && read_manifest(manifest, &jobs, &n_jobs))
+		return 1;
 
-	for (i = 0; i < argc - 1; i++) {
-		int ret = hash_file(t, argv[1 + i], add_filename, no_newline);
-		if (ret)
-			return ret;
+	if (!n_jobs && !manifest && add_job(&jobs, &n_jobs, NULL)) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+
+	if (n_threads > 1 && n_jobs > 1)
+		hash_jobs_parallel(t, jobs, n_jobs, n_threads - 1);
+
+	for (i = 0; i < n_jobs; i++) {
+		if (n_threads == 1 || n_jobs == 1)
+			hash_job_run(t, &jobs[i]);
+
+		if (hash_job_print(&jobs[i], add_filename, no_newline))
+			return 1;
 	}
 
 	return 0;
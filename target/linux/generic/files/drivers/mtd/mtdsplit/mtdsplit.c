@@ -12,10 +12,15 @@
 
 #define pr_fmt(fmt)	"mtdsplit: " fmt
 
+#include <linux/bitmap.h>
 #include <linux/export.h>
 #include <linux/init.h>
 #include <linux/kernel.h>
+#include <linux/list.h>
 #include <linux/magic.h>
+#include <linux/mutex.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
 #include <linux/mtd/mtd.h>
 #include <linux/mtd/partitions.h>
 #include <linux/byteorder/generic.h>
@@ -24,12 +29,177 @@
 
 #define UBI_EC_MAGIC			0x55424923	/* UBI# */
 
+/*
+ * Every parser of a type scans the same erase block headers, so while a
+ * parser run is in progress the first MTD_PROBE_LEN bytes of each block
+ * are read from flash once and then served to all of them.
+ */
+#define MTD_PROBE_LEN			256
+#define MTD_PROBE_MAX_BLOCKS		4096
+
+struct mtd_probe_cache {
+	struct list_head list;
+	struct mtd_info *mtd;
+	unsigned int users;
+	unsigned int nr_blocks;
+	unsigned long *valid;
+	u8 *data;
+};
+
+static LIST_HEAD(probe_caches);
+static DEFINE_MUTEX(probe_lock);
+
 struct squashfs_super_block {
 	__le32 s_magic;
 	__le32 pad0[9];
 	__le64 bytes_used;
 };
 
+static struct mtd_probe_cache *mtd_probe_cache_find(struct mtd_info *mtd)
+{
+	struct mtd_probe_cache *pc;
+
+	list_for_each_entry(pc, &probe_caches, list)
+		if (pc->mtd == mtd)
+			return pc;
+
+	return NULL;
+}
+
+void mtd_probe_begin(struct mtd_info *mtd)
+{
+	struct mtd_probe_cache *pc;
+	u64 nr_blocks;
+
+	if (!mtd->erasesize || mtd->erasesize < MTD_PROBE_LEN)
+		return;
+
+	nr_blocks = mtd_div_by_eb(mtd->size, mtd);
+	if (!nr_blocks || nr_blocks > MTD_PROBE_MAX_BLOCKS)
+		return;
+
+	mutex_lock(&probe_lock);
+
+	pc = mtd_probe_cache_find(mtd);
+	if (pc) {
+		pc->users++;
+		goto out;
+	}
+
+	pc = kzalloc(sizeof(*pc), GFP_KERNEL);
+	if (!pc)
+		goto out;
+
+	pc->valid = bitmap_zalloc(nr_blocks, GFP_KERNEL);
+	pc->data = vmalloc(nr_blocks * MTD_PROBE_LEN);
+	if (!pc->valid || !pc->data) {
+		bitmap_free(pc->valid);
+		vfree(pc->data);
+		kfree(pc);
+		goto out;
+	}
+
+	pc->mtd = mtd;
+	pc->users = 1;
+	pc->nr_blocks = nr_blocks;
+	list_add(&pc->list, &probe_caches);
+
+out:
+	mutex_unlock(&probe_lock);
+}
+EXPORT_SYMBOL_GPL(mtd_probe_begin);
+
+void mtd_probe_end(struct mtd_info *mtd)
+{
+	struct mtd_probe_cache *pc;
+
+	mutex_lock(&probe_lock);
+
+	pc = mtd_probe_cache_find(mtd);
+	if (pc && !--pc->users) {
+		list_del(&pc->list);
+		bitmap_free(pc->valid);
+		vfree(pc->data);
+		kfree(pc);
+	}
+
+	mutex_unlock(&probe_lock);
+}
+EXPORT_SYMBOL_GPL(mtd_probe_end);
+
+/*
+ * Same semantics as mtd_read. Reads that fit within the header window of
+ * an erase block are answered from the probe cache if one is active,
+ * anything else (and any read that fails) goes to the flash as usual.
+ *
+ * probe_lock is not held while reading a missing header from flash, so
+ * probes of other devices are not serialised behind it. The cache is looked
+ * up again afterwards, it may have been dropped or filled meanwhile.
+ */
+int mtd_probe_read(struct mtd_info *mtd, loff_t from, size_t len,
+		   size_t *retlen, u_char *buf)
+{
+	struct mtd_probe_cache *pc;
+	size_t blk_len;
+	u32 blk_offs;
+	u64 blk;
+	u8 *hdr;
+	int ret;
+
+	if (from < 0 || from >= mtd->size)
+		return mtd_read(mtd, from, len, retlen, buf);
+
+	mutex_lock(&probe_lock);
+
+	pc = mtd_probe_cache_find(mtd);
+	if (!pc)
+		goto uncached;
+
+	blk = mtd_div_by_eb(from, mtd);
+	blk_offs = mtd_mod_by_eb(from, mtd);
+	if (blk >= pc->nr_blocks || blk_offs + len > MTD_PROBE_LEN)
+		goto uncached;
+
+	if (test_bit(blk, pc->valid)) {
+		memcpy(buf, pc->data + blk * MTD_PROBE_LEN + blk_offs, len);
+		mutex_unlock(&probe_lock);
+		*retlen = len;
+		return 0;
+	}
+
+	mutex_unlock(&probe_lock);
+
+	hdr = kmalloc(MTD_PROBE_LEN, GFP_KERNEL);
+	if (!hdr)
+		return mtd_read(mtd, from, len, retlen, buf);
+
+	ret = mtd_read(mtd, blk * mtd->erasesize, MTD_PROBE_LEN, &blk_len, hdr);
+	if (ret || blk_len != MTD_PROBE_LEN) {
+		kfree(hdr);
+		return mtd_read(mtd, from, len, retlen, buf);
+	}
+
+	mutex_lock(&probe_lock);
+	pc = mtd_probe_cache_find(mtd);
+	if (pc && blk < pc->nr_blocks && !test_bit(blk, pc->valid)) {
+		memcpy(pc->data + blk * MTD_PROBE_LEN, hdr, MTD_PROBE_LEN);
+		set_bit(blk, pc->valid);
+	}
+	mutex_unlock(&probe_lock);
+
+	memcpy(buf, hdr + blk_offs, len);
+	kfree(hdr);
+	*retlen = len;
+
+	return 0;
+
+uncached:
+	mutex_unlock(&probe_lock);
+
+	return mtd_read(mtd, from, len, retlen, buf);
+}
+EXPORT_SYMBOL_GPL(mtd_probe_read);
+
 int mtd_get_squashfs_len(struct mtd_info *master,
 			 size_t offset,
 			 size_t *squashfs_len)
@@ -38,7 +208,7 @@ int mtd_get_squashfs_len(struct mtd_info *master,
 	size_t retlen;
 	int err;
 
-	err = mtd_read(master, offset, sizeof(sb), &retlen, (void *)&sb);
+	err = mtd_probe_read(master, offset, sizeof(sb), &retlen, (void *)&sb);
 	if (err || (retlen != sizeof(sb))) {
 		pr_alert("error occured while reading from \"%s\"\n",
 			 master->name);
@@ -79,8 +249,8 @@ int mtd_check_rootfs_magic(struct mtd_info *mtd, size_t offset,
 	size_t retlen;
 	int ret;
 
-	ret = mtd_read(mtd, offset, sizeof(magic), &retlen,
-		       (unsigned char *) &magic);
+	ret = mtd_probe_read(mtd, offset, sizeof(magic), &retlen,
+			     (unsigned char *) &magic);
 	if (ret)
 		return ret;
 
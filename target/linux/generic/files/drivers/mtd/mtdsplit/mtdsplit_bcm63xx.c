@@ -41,7 +41,7 @@ static int bcm63xx_read_image_tag(struct mtd_info *master, loff_t offset,
 	size_t retlen;
 	u32 computed_crc;
 
-	ret = mtd_read(master, offset, sizeof(*hdr), &retlen, (void *) hdr);
+	ret = mtd_probe_read(master, offset, sizeof(*hdr), &retlen, (void *) hdr);
 	if (ret)
 		return ret;
 
@@ -94,7 +94,7 @@ static int mtdsplit_parse_tplink(struct mtd_info *master,
 	int err;
 
 	hdr_len = sizeof(hdr);
-	err = mtd_read(master, 0, hdr_len, &retlen, (void *) &hdr);
+	err = mtd_probe_read(master, 0, hdr_len, &retlen, (void *) &hdr);
 	if (err)
 		return err;
 
@@ -268,6 +268,48 @@ static void swconfig_defaults_init(struct switch_dev *dev)
 	set_bit(GLOBAL_RESET, &dev->def_global);
 }
 
+struct swconfig_group {
+	const struct switch_attrlist *alist;
+	struct switch_attr *def_list;
+	unsigned long *def_active;
+	int n_def;
+};
+
+static int
+swconfig_get_group(struct switch_dev *dev, int cmd, struct swconfig_group *grp)
+{
+	switch (cmd) {
+	case SWITCH_CMD_LIST_GLOBAL:
+	case SWITCH_CMD_GET_GLOBAL:
+	case SWITCH_CMD_SET_GLOBAL:
+		grp->alist = &dev->ops->attr_global;
+		grp->def_list = default_global;
+		grp->def_active = &dev->def_global;
+		grp->n_def = ARRAY_SIZE(default_global);
+		break;
+	case SWITCH_CMD_LIST_VLAN:
+	case SWITCH_CMD_GET_VLAN:
+	case SWITCH_CMD_SET_VLAN:
+		grp->alist = &dev->ops->attr_vlan;
+		grp->def_list = default_vlan;
+		grp->def_active = &dev->def_vlan;
+		grp->n_def = ARRAY_SIZE(default_vlan);
+		break;
+	case SWITCH_CMD_LIST_PORT:
+	case SWITCH_CMD_GET_PORT:
+	case SWITCH_CMD_SET_PORT:
+		grp->alist = &dev->ops->attr_port;
+		grp->def_list = default_port;
+		grp->def_active = &dev->def_port;
+		grp->n_def = ARRAY_SIZE(default_port);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 
 static struct genl_family switch_fam;
 
@@ -280,6 +322,7 @@ static const struct nla_policy switch_policy[SWITCH_ATTR_MAX+1] = {
 	[SWITCH_ATTR_OP_VALUE_STR] = { .type = NLA_NUL_STRING },
 	[SWITCH_ATTR_OP_VALUE_PORTS] = { .type = NLA_NESTED },
 	[SWITCH_ATTR_TYPE] = { .type = NLA_U32 },
+	[SWITCH_ATTR_OP_BATCH] = { .type = NLA_NESTED },
 };
 
 static const struct nla_policy port_policy[SWITCH_PORT_ATTR_MAX+1] = {
@@ -306,16 +349,16 @@ swconfig_unlock(void)
 }
 
 static struct switch_dev *
-swconfig_get_dev(struct genl_info *info)
+__swconfig_get_dev(struct nlattr **attrs)
 {
 	struct switch_dev *dev = NULL;
 	struct switch_dev *p;
 	int id;
 
-	if (!info->attrs[SWITCH_ATTR_ID])
+	if (!attrs[SWITCH_ATTR_ID])
 		goto done;
 
-	id = nla_get_u32(info->attrs[SWITCH_ATTR_ID]);
+	id = nla_get_u32(attrs[SWITCH_ATTR_ID]);
 	swconfig_lock();
 	list_for_each_entry(p, &swdevs, dev_list) {
 		if (id != p->id)
@@ -333,6 +376,12 @@ done:
 	return dev;
 }
 
+static inline struct switch_dev *
+swconfig_get_dev(struct genl_info *info)
+{
+	return __swconfig_get_dev(info->attrs);
+}
+
 static inline void
 swconfig_put_dev(struct switch_dev *dev)
 {
@@ -419,44 +468,20 @@ swconfig_list_attrs(struct sk_buff *skb, struct genl_info *info)
 {
 	struct genlmsghdr *hdr = nlmsg_data(info->nlhdr);
 	const struct switch_attrlist *alist;
+	struct swconfig_group grp;
 	struct switch_dev *dev;
 	struct swconfig_callback cb;
 	int err = -EINVAL;
 	int i;
 
-	/* defaults */
-	struct switch_attr *def_list;
-	unsigned long *def_active;
-	int n_def;
-
 	dev = swconfig_get_dev(info);
 	if (!dev)
 		return -EINVAL;
 
-	switch (hdr->cmd) {
-	case SWITCH_CMD_LIST_GLOBAL:
-		alist = &dev->ops->attr_global;
-		def_list = default_global;
-		def_active = &dev->def_global;
-		n_def = ARRAY_SIZE(default_global);
-		break;
-	case SWITCH_CMD_LIST_VLAN:
-		alist = &dev->ops->attr_vlan;
-		def_list = default_vlan;
-		def_active = &dev->def_vlan;
-		n_def = ARRAY_SIZE(default_vlan);
-		break;
-	case SWITCH_CMD_LIST_PORT:
-		alist = &dev->ops->attr_port;
-		def_list = default_port;
-		def_active = &dev->def_port;
-		n_def = ARRAY_SIZE(default_port);
-		break;
-	default:
-		WARN_ON(1);
+	if (WARN_ON(swconfig_get_group(dev, hdr->cmd, &grp)))
 		goto out;
-	}
 
+	alist = grp.alist;
 	memset(&cb, 0, sizeof(cb));
 	cb.info = info;
 	cb.fill = swconfig_dump_attr;
@@ -470,11 +495,11 @@ swconfig_list_attrs(struct sk_buff *skb, struct genl_info *info)
 	}
 
 	/* defaults */
-	for (i = 0; i < n_def; i++) {
-		if (!test_bit(i, def_active))
+	for (i = 0; i < grp.n_def; i++) {
+		if (!test_bit(i, grp.def_active))
 			continue;
 		cb.args[0] = SWITCH_ATTR_DEFAULTS_OFFSET + i;
-		err = swconfig_send_multipart(&cb, (void *) &def_list[i]);
+		err = swconfig_send_multipart(&cb, (void *) &grp.def_list[i]);
 		if (err < 0)
 			goto error;
 	}
@@ -494,74 +519,53 @@ out:
 }
 
 static const struct switch_attr *
-swconfig_lookup_attr(struct switch_dev *dev, struct genl_info *info,
+swconfig_lookup_attr(struct switch_dev *dev, int cmd, struct nlattr **attrs,
 		struct switch_val *val)
 {
-	struct genlmsghdr *hdr = nlmsg_data(info->nlhdr);
-	const struct switch_attrlist *alist;
 	const struct switch_attr *attr = NULL;
+	struct swconfig_group grp;
 	unsigned int attr_id;
 
-	/* defaults */
-	struct switch_attr *def_list;
-	unsigned long *def_active;
-	int n_def;
+	if (!attrs[SWITCH_ATTR_OP_ID])
+		goto done;
 
-	if (!info->attrs[SWITCH_ATTR_OP_ID])
+	if (WARN_ON(swconfig_get_group(dev, cmd, &grp)))
 		goto done;
 
-	switch (hdr->cmd) {
-	case SWITCH_CMD_SET_GLOBAL:
-	case SWITCH_CMD_GET_GLOBAL:
-		alist = &dev->ops->attr_global;
-		def_list = default_global;
-		def_active = &dev->def_global;
-		n_def = ARRAY_SIZE(default_global);
-		break;
+	switch (cmd) {
 	case SWITCH_CMD_SET_VLAN:
 	case SWITCH_CMD_GET_VLAN:
-		alist = &dev->ops->attr_vlan;
-		def_list = default_vlan;
-		def_active = &dev->def_vlan;
-		n_def = ARRAY_SIZE(default_vlan);
-		if (!info->attrs[SWITCH_ATTR_OP_VLAN])
+		if (!attrs[SWITCH_ATTR_OP_VLAN])
 			goto done;
-		val->port_vlan = nla_get_u32(info->attrs[SWITCH_ATTR_OP_VLAN]);
+		val->port_vlan = nla_get_u32(attrs[SWITCH_ATTR_OP_VLAN]);
 		if (val->port_vlan >= dev->vlans)
 			goto done;
 		break;
 	case SWITCH_CMD_SET_PORT:
 	case SWITCH_CMD_GET_PORT:
-		alist = &dev->ops->attr_port;
-		def_list = default_port;
-		def_active = &dev->def_port;
-		n_def = ARRAY_SIZE(default_port);
-		if (!info->attrs[SWITCH_ATTR_OP_PORT])
+		if (!attrs[SWITCH_ATTR_OP_PORT])
 			goto done;
-		val->port_vlan = nla_get_u32(info->attrs[SWITCH_ATTR_OP_PORT]);
+		val->port_vlan = nla_get_u32(attrs[SWITCH_ATTR_OP_PORT]);
 		if (val->port_vlan >= dev->ports)
 			goto done;
 		break;
-	default:
-		WARN_ON(1);
-		goto done;
 	}
 
-	if (!alist)
+	if (!grp.alist)
 		goto done;
 
-	attr_id = nla_get_u32(info->attrs[SWITCH_ATTR_OP_ID]);
+	attr_id = nla_get_u32(attrs[SWITCH_ATTR_OP_ID]);
 	if (attr_id >= SWITCH_ATTR_DEFAULTS_OFFSET) {
 		attr_id -= SWITCH_ATTR_DEFAULTS_OFFSET;
-		if (attr_id >= n_def)
+		if (attr_id >= grp.n_def)
 			goto done;
-		if (!test_bit(attr_id, def_active))
+		if (!test_bit(attr_id, grp.def_active))
 			goto done;
-		attr = &def_list[attr_id];
+		attr = &grp.def_list[attr_id];
 	} else {
-		if (attr_id >= alist->n_attr)
+		if (attr_id >= grp.alist->n_attr)
 			goto done;
-		attr = &alist->attr[attr_id];
+		attr = &grp.alist->attr[attr_id];
 	}
 
 	if (attr->disabled)
@@ -624,40 +628,33 @@ swconfig_parse_link(struct sk_buff *msg, struct nlattr *nla,
 }
 
 static int
-swconfig_set_attr(struct sk_buff *skb, struct genl_info *info)
+swconfig_set_val(struct switch_dev *dev, int cmd, struct sk_buff *skb,
+		 struct nlattr **attrs)
 {
 	const struct switch_attr *attr;
-	struct switch_dev *dev;
 	struct switch_val val;
-	int err = -EINVAL;
-
-	if (!capable(CAP_NET_ADMIN))
-		return -EPERM;
-
-	dev = swconfig_get_dev(info);
-	if (!dev)
-		return -EINVAL;
+	int err;
 
 	memset(&val, 0, sizeof(val));
-	attr = swconfig_lookup_attr(dev, info, &val);
+	attr = swconfig_lookup_attr(dev, cmd, attrs, &val);
 	if (!attr || !attr->set)
-		goto error;
+		return -EINVAL;
 
 	val.attr = attr;
 	switch (attr->type) {
 	case SWITCH_TYPE_NOVAL:
 		break;
 	case SWITCH_TYPE_INT:
-		if (!info->attrs[SWITCH_ATTR_OP_VALUE_INT])
-			goto error;
+		if (!attrs[SWITCH_ATTR_OP_VALUE_INT])
+			return -EINVAL;
 		val.value.i =
-			nla_get_u32(info->attrs[SWITCH_ATTR_OP_VALUE_INT]);
+			nla_get_u32(attrs[SWITCH_ATTR_OP_VALUE_INT]);
 		break;
 	case SWITCH_TYPE_STRING:
-		if (!info->attrs[SWITCH_ATTR_OP_VALUE_STR])
-			goto error;
+		if (!attrs[SWITCH_ATTR_OP_VALUE_STR])
+			return -EINVAL;
 		val.value.s =
-			nla_data(info->attrs[SWITCH_ATTR_OP_VALUE_STR]);
+			nla_data(attrs[SWITCH_ATTR_OP_VALUE_STR]);
 		break;
 	case SWITCH_TYPE_PORTS:
 		val.value.ports = dev->portbuf;
@@ -665,42 +662,105 @@ swconfig_set_attr(struct sk_buff *skb, struct genl_info *info)
 			sizeof(struct switch_port) * dev->ports);
 
 		/* TODO: implement multipart? */
-		if (info->attrs[SWITCH_ATTR_OP_VALUE_PORTS]) {
+		if (attrs[SWITCH_ATTR_OP_VALUE_PORTS]) {
 			err = swconfig_parse_ports(skb,
-				info->attrs[SWITCH_ATTR_OP_VALUE_PORTS],
+				attrs[SWITCH_ATTR_OP_VALUE_PORTS],
 				&val, dev->ports);
 			if (err < 0)
-				goto error;
+				return err;
 		} else {
 			val.len = 0;
-			err = 0;
 		}
 		break;
 	case SWITCH_TYPE_LINK:
 		val.value.link = &dev->linkbuf;
 		memset(&dev->linkbuf, 0, sizeof(struct switch_port_link));
 
-		if (info->attrs[SWITCH_ATTR_OP_VALUE_LINK]) {
+		if (attrs[SWITCH_ATTR_OP_VALUE_LINK]) {
 			err = swconfig_parse_link(skb,
-						  info->attrs[SWITCH_ATTR_OP_VALUE_LINK],
+						  attrs[SWITCH_ATTR_OP_VALUE_LINK],
 						  val.value.link);
 			if (err < 0)
-				goto error;
+				return err;
 		} else {
 			val.len = 0;
-			err = 0;
 		}
 		break;
 	default:
-		goto error;
+		return -EINVAL;
 	}
 
-	err = attr->set(dev, attr, &val);
-error:
+	return attr->set(dev, attr, &val);
+}
+
+static int
+swconfig_set_attr(struct sk_buff *skb, struct genl_info *info)
+{
+	struct genlmsghdr *hdr = nlmsg_data(info->nlhdr);
+	struct switch_dev *dev;
+	int err;
+
+	if (!capable(CAP_NET_ADMIN))
+		return -EPERM;
+
+	dev = swconfig_get_dev(info);
+	if (!dev)
+		return -EINVAL;
+
+	err = swconfig_set_val(dev, hdr->cmd, skb, info->attrs);
 	swconfig_put_dev(dev);
 	return err;
 }
 
+/*
+ * Apply a whole list of settings while holding the device lock once.
+ * Every entry is tried, the first error is returned.
+ */
+static int
+swconfig_set_batch(struct sk_buff *skb, struct genl_info *info)
+{
+	struct nlattr *tb[SWITCH_ATTR_MAX + 1];
+	struct switch_dev *dev;
+	struct nlattr *nla;
+	int ret = 0;
+	int err;
+	int rem;
+
+	if (!capable(CAP_NET_ADMIN))
+		return -EPERM;
+
+	dev = swconfig_get_dev(info);
+	if (!dev)
+		return -EINVAL;
+
+	if (!info->attrs[SWITCH_ATTR_OP_BATCH])
+		goto out;
+
+	nla_for_each_nested(nla, info->attrs[SWITCH_ATTR_OP_BATCH], rem) {
+		switch (nla_type(nla)) {
+		case SWITCH_CMD_SET_GLOBAL:
+		case SWITCH_CMD_SET_PORT:
+		case SWITCH_CMD_SET_VLAN:
+			err = nla_parse_nested_deprecated(tb, SWITCH_ATTR_MAX,
+					nla, switch_policy, NULL);
+			if (!err)
+				err = swconfig_set_val(dev, nla_type(nla),
+						       skb, tb);
+			break;
+		default:
+			err = -EINVAL;
+			break;
+		}
+
+		if (err && !ret)
+			ret = err;
+	}
+
+out:
+	swconfig_put_dev(dev);
+	return ret;
+}
+
 static int
 swconfig_close_portlist(struct swconfig_callback *cb, void *arg)
 {
@@ -837,7 +897,7 @@ swconfig_get_attr(struct sk_buff *skb, struct genl_info *info)
 		return -EINVAL;
 
 	memset(&val, 0, sizeof(val));
-	attr = swconfig_lookup_attr(dev, info, &val);
+	attr = swconfig_lookup_attr(dev, cmd, info->attrs, &val);
 	if (!attr || !attr->get)
 		goto error;
 
@@ -907,6 +967,224 @@ error:
 	return err;
 }
 
+static int
+swconfig_put_ports(struct sk_buff *msg, int attr, const struct switch_val *val)
+{
+	struct nlattr *n, *p;
+	int i;
+
+	n = nla_nest_start(msg, attr);
+	if (!n)
+		return -EMSGSIZE;
+
+	for (i = 0; i < val->len; i++) {
+		const struct switch_port *port = &val->value.ports[i];
+
+		p = nla_nest_start(msg, SWITCH_ATTR_PORT);
+		if (!p)
+			goto nla_put_failure;
+		if (nla_put_u32(msg, SWITCH_PORT_ID, port->id))
+			goto nla_put_failure;
+		if (port->flags & (1 << SWITCH_PORT_FLAG_TAGGED)) {
+			if (nla_put_flag(msg, SWITCH_PORT_FLAG_TAGGED))
+				goto nla_put_failure;
+		}
+		nla_nest_end(msg, p);
+	}
+	nla_nest_end(msg, n);
+
+	return 0;
+
+nla_put_failure:
+	nla_nest_cancel(msg, n);
+	return -EMSGSIZE;
+}
+
+static int
+swconfig_put_val(struct sk_buff *msg, const struct switch_attr *attr,
+		 const struct switch_val *val)
+{
+	switch (attr->type) {
+	case SWITCH_TYPE_INT:
+		return nla_put_u32(msg, SWITCH_ATTR_OP_VALUE_INT, val->value.i);
+	case SWITCH_TYPE_STRING:
+		return nla_put_string(msg, SWITCH_ATTR_OP_VALUE_STR,
+				      val->value.s);
+	case SWITCH_TYPE_PORTS:
+		return swconfig_put_ports(msg, SWITCH_ATTR_OP_VALUE_PORTS, val);
+	case SWITCH_TYPE_LINK:
+		return swconfig_send_link(msg, NULL, SWITCH_ATTR_OP_VALUE_LINK,
+					  val->value.link);
+	default:
+		return -EINVAL;
+	}
+}
+
+/* get one value into the dump, or its error code if reading it failed */
+static int
+swconfig_dump_val(struct sk_buff *skb, struct netlink_callback *cb,
+		  struct switch_dev *dev, int cmd, const struct switch_attr *attr,
+		  unsigned int id, int port_vlan)
+{
+	struct switch_val val;
+	void *hdr;
+	int err = -EINVAL;
+
+	memset(&val, 0, sizeof(val));
+	val.attr = attr;
+	val.port_vlan = port_vlan;
+	if (attr->type == SWITCH_TYPE_PORTS) {
+		val.value.ports = dev->portbuf;
+		memset(dev->portbuf, 0,
+			sizeof(struct switch_port) * dev->ports);
+	} else if (attr->type == SWITCH_TYPE_LINK) {
+		val.value.link = &dev->linkbuf;
+		memset(&dev->linkbuf, 0, sizeof(struct switch_port_link));
+	}
+
+	if (attr->get)
+		err = attr->get(dev, attr, &val);
+
+	hdr = genlmsg_put(skb, NETLINK_CB(cb->skb).portid, cb->nlh->nlmsg_seq,
+			  &switch_fam, NLM_F_MULTI, cmd);
+	if (!hdr)
+		return -EMSGSIZE;
+
+	if (nla_put_u32(skb, SWITCH_ATTR_OP_ID, id))
+		goto nla_put_failure;
+	if (cmd == SWITCH_CMD_GET_PORT &&
+	    nla_put_u32(skb, SWITCH_ATTR_OP_PORT, port_vlan))
+		goto nla_put_failure;
+	if (cmd == SWITCH_CMD_GET_VLAN &&
+	    nla_put_u32(skb, SWITCH_ATTR_OP_VLAN, port_vlan))
+		goto nla_put_failure;
+
+	if (err) {
+		if (nla_put_u32(skb, SWITCH_ATTR_OP_ERR, -err))
+			goto nla_put_failure;
+	} else if (swconfig_put_val(skb, attr, &val)) {
+		goto nla_put_failure;
+	}
+
+	genlmsg_end(skb, hdr);
+	return 0;
+
+nla_put_failure:
+	genlmsg_cancel(skb, hdr);
+	return -EMSGSIZE;
+}
+
+static bool
+swconfig_vlan_has_ports(struct switch_dev *dev, int vlan)
+{
+	const struct switch_attr *attr;
+	struct switch_val val;
+
+	attr = swconfig_find_attr_by_name(&dev->ops->attr_vlan, "ports");
+	if (!attr && test_bit(VLAN_PORTS, &dev->def_vlan))
+		attr = &default_vlan[VLAN_PORTS];
+	if (!attr || !attr->get || attr->type != SWITCH_TYPE_PORTS)
+		return false;
+
+	memset(&val, 0, sizeof(val));
+	val.attr = attr;
+	val.port_vlan = vlan;
+	val.value.ports = dev->portbuf;
+	memset(dev->portbuf, 0, sizeof(struct switch_port) * dev->ports);
+
+	return !attr->get(dev, attr, &val) && val.len;
+}
+
+static const int swconfig_dump_cmds[] = {
+	SWITCH_CMD_GET_GLOBAL,
+	SWITCH_CMD_GET_PORT,
+	SWITCH_CMD_GET_VLAN,
+};
+
+/*
+ * Dump state: args[0] indexes swconfig_dump_cmds, args[1] is the port or
+ * VLAN, args[2] the position in the attribute list followed by the
+ * defaults, args[3] is set once the current VLAN is known to have members.
+ */
+static int
+swconfig_dump_values(struct sk_buff *skb, struct netlink_callback *cb)
+{
+	struct nlattr *tb[SWITCH_ATTR_MAX + 1];
+	struct swconfig_group grp;
+	struct switch_dev *dev;
+	int err;
+
+	err = nlmsg_parse_deprecated(cb->nlh, GENL_HDRLEN, tb, SWITCH_ATTR_MAX,
+				     switch_policy, NULL);
+	if (err)
+		return err;
+
+	dev = __swconfig_get_dev(tb);
+	if (!dev)
+		return -EINVAL;
+
+	for (; cb->args[0] < ARRAY_SIZE(swconfig_dump_cmds);
+	     cb->args[0]++, cb->args[1] = 0) {
+		int cmd = swconfig_dump_cmds[cb->args[0]];
+		int n_index = 1;
+
+		if (cmd == SWITCH_CMD_GET_PORT)
+			n_index = dev->ports;
+		else if (cmd == SWITCH_CMD_GET_VLAN)
+			n_index = dev->vlans;
+
+		swconfig_get_group(dev, cmd, &grp);
+
+		for (; cb->args[1] < n_index;
+		     cb->args[1]++, cb->args[2] = 0, cb->args[3] = 0) {
+			int index = cb->args[1];
+
+			if (cmd == SWITCH_CMD_GET_VLAN && !cb->args[3]) {
+				if (!swconfig_vlan_has_ports(dev, index))
+					continue;
+				cb->args[3] = 1;
+			}
+
+			for (; cb->args[2] < grp.alist->n_attr + grp.n_def;
+			     cb->args[2]++) {
+				const struct switch_attr *attr;
+				unsigned int id = cb->args[2];
+
+				if (id < grp.alist->n_attr) {
+					attr = &grp.alist->attr[id];
+				} else {
+					id -= grp.alist->n_attr;
+					if (!test_bit(id, grp.def_active))
+						continue;
+					attr = &grp.def_list[id];
+					id += SWITCH_ATTR_DEFAULTS_OFFSET;
+				}
+
+				if (attr->disabled ||
+				    attr->type == SWITCH_TYPE_NOVAL)
+					continue;
+
+				err = swconfig_dump_val(skb, cb, dev, cmd,
+							attr, id, index);
+				if (err < 0)
+					goto out;
+			}
+		}
+	}
+
+out:
+	swconfig_put_dev(dev);
+
+	/*
+	 * A value that does not fit an empty message would be retried
+	 * forever, fail the dump instead of ending it silently.
+	 */
+	if (err < 0 && !skb->len)
+		return err;
+
+	return skb->len;
+}
+
 static int
 swconfig_send_switch(struct sk_buff *msg, u32 pid, u32 seq, int flags,
 		const struct switch_dev *dev)
@@ -1037,11 +1315,23 @@ static struct genl_ops swconfig_ops[] = {
 		.flags = GENL_ADMIN_PERM,
 		.doit = swconfig_set_attr,
 	},
+	{
+		.cmd = SWITCH_CMD_SET_BATCH,
+		.validate = GENL_DONT_VALIDATE_STRICT | GENL_DONT_VALIDATE_DUMP,
+		.flags = GENL_ADMIN_PERM,
+		.doit = swconfig_set_batch,
+	},
 	{
 		.cmd = SWITCH_CMD_GET_SWITCH,
 		.validate = GENL_DONT_VALIDATE_STRICT | GENL_DONT_VALIDATE_DUMP,
 		.dumpit = swconfig_dump_switches,
 		.done = swconfig_done,
+	},
+	{
+		.cmd = SWITCH_CMD_DUMP_VALUES,
+		.validate = GENL_DONT_VALIDATE_STRICT | GENL_DONT_VALIDATE_DUMP,
+		.dumpit = swconfig_dump_values,
+		.done = swconfig_done,
 	}
 };
 
@@ -54,6 +54,9 @@ enum {
 	SWITCH_ATTR_OP_DESCRIPTION,
 	/* port lists */
 	SWITCH_ATTR_PORT,
+	/* bulk operations */
+	SWITCH_ATTR_OP_ERR,
+	SWITCH_ATTR_OP_BATCH,
 	SWITCH_ATTR_MAX
 };
 
@@ -78,7 +81,20 @@ enum {
 	SWITCH_CMD_SET_PORT,
 	SWITCH_CMD_LIST_VLAN,
 	SWITCH_CMD_GET_VLAN,
-	SWITCH_CMD_SET_VLAN
+	SWITCH_CMD_SET_VLAN,
+	/*
+	 * dump all readable values; every value comes as a GET_GLOBAL,
+	 * GET_PORT or GET_VLAN message, with SWITCH_ATTR_OP_ERR in place of
+	 * the value if reading it failed. VLANs without member ports are
+	 * left out, as in "swconfig show".
+	 */
+	SWITCH_CMD_DUMP_VALUES,
+	/*
+	 * apply a list of settings in one go; SWITCH_ATTR_OP_BATCH nests one
+	 * entry per setting, typed SET_GLOBAL, SET_PORT or SET_VLAN and
+	 * carrying the attributes of the corresponding set command
+	 */
+	SWITCH_CMD_SET_BATCH,
 };
 
 /* data types */
@@ -34,7 +34,7 @@
  *   reorder the script as an lzma wrapper; do not depend on flash access
  */
 
-#include "LzmaDecode.h"
+#include "LzmaDec.h"
 
 #define KSEG0			0x80000000
 #define KSEG1			0xa0000000
@@ -80,20 +80,9 @@ static __inline__ void blast_dcache(unsigned long size, unsigned long lsize)
 
 unsigned char *data;
 
-static int read_byte(void *object, unsigned char **buffer, UInt32 *bufferSize)
-{
-	*bufferSize = 1;
-	*buffer = data;
-	++data;
-	return LZMA_RESULT_OK;
-}
-
 static __inline__ unsigned char get_byte(void)
 {
-	unsigned char *buffer;
-	UInt32 fake;
-	
-	return read_byte(0, &buffer, &fake), *buffer;
+	return *data++;
 }
 
 /* This puts lzma workspace 128k below RAM end. 
@@ -117,22 +106,18 @@ void entry(unsigned long icache_size, unsigned long icache_lsize,
 	__asm__ __volatile__ ("ori %0, $14, 0":"=r"(arg2));
 	__asm__ __volatile__ ("ori %0, $15, 0":"=r"(arg3));
 
-	ILzmaInCallback callback;
-	CLzmaDecoderState vs;
-	callback.Read = read_byte;
+	CLzmaDec vs;
+	ELzmaStatus status;
+	SizeT isize;
 
 	data = lzma_start;
 
-	/* lzma args */
-	i = get_byte();
-	vs.Properties.lc = i % 9, i = i / 9;
-	vs.Properties.lp = i % 5, vs.Properties.pb = i / 5;
+	/* lzma args and dictionary size */
+	if (LzmaProps_Decode(&vs.prop, data, LZMA_PROPS_SIZE) != SZ_OK)
+		return;
+	data += LZMA_PROPS_SIZE;
 
-	vs.Probs = (CProb *)buffer;
-
-	/* skip rest of the LZMA coder property */
-	for (i = 0; i < 4; i++)
-		get_byte();
+	vs.probs = (CLzmaProb *)buffer;
 
 	/* read the lower half of uncompressed size in the header */
 	osize = ((unsigned int)get_byte()) +
@@ -144,9 +129,15 @@ void entry(unsigned long icache_size, unsigned long icache_lsize,
 	for (i = 0; i < 4; i++) 
 		get_byte();
 
-	/* decompress kernel */
-	if ((i = LzmaDecode(&vs, &callback,
-	(unsigned char*)KERNEL_ENTRY, osize, &osize)) == LZMA_RESULT_OK)
+	/* decompress kernel, the whole stream is already in memory and
+	 * the output buffer is the dictionary, so it never wraps */
+	vs.dic = (unsigned char *)KERNEL_ENTRY;
+	vs.dicBufSize = osize;
+	LzmaDec_Init(&vs);
+
+	isize = lzma_end - (char *)data;
+	if (LzmaDec_DecodeToDic(&vs, osize, data, &isize, LZMA_FINISH_ANY,
+				&status) == SZ_OK && vs.dicPos == osize)
 	{
 		blast_dcache(dcache_size, dcache_lsize);
 		blast_icache(icache_size, icache_lsize);
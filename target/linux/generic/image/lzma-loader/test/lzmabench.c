@@ -0,0 +1,190 @@
+/*
+ * Host test and benchmark of the lzma-loader decoder
+ *
+ *   lzmabench [-n runs] file.lzma [file]  decode the whole file from memory,
+ *                                         as decompress.c does, and print MB/s
+ *   lzmabench -c file.lzma file           also decode it fed in small pieces,
+ *                                         and compare both outputs to file
+ *
+ * Streams written without their size, as xz --format=lzma does, need the
+ * uncompressed file to know how much to decode.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "LzmaDec.h"
+
+#define LZMA_HEADER_SIZE	(LZMA_PROPS_SIZE + 8)
+
+static unsigned char *read_file(const char *name, size_t *size)
+{
+	unsigned char *buf = NULL;
+	size_t len = 0, n;
+	FILE *f;
+
+	f = fopen(name, "rb");
+	if (!f) {
+		perror(name);
+		exit(1);
+	}
+
+	do {
+		buf = realloc(buf, len + 65536);
+		if (!buf) {
+			perror("realloc");
+			exit(1);
+		}
+		n = fread(buf + len, 1, 65536, f);
+		len += n;
+	} while (n);
+
+	fclose(f);
+	*size = len;
+	return buf;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Decode in to out, chunk input bytes per call or everything at once
+ * when chunk is 0. Returns the number of bytes written or -1.
+ */
+static long decode(const unsigned char *in, size_t isize, unsigned char *out,
+		   size_t osize, CLzmaProb *probs, size_t chunk)
+{
+	ELzmaStatus status;
+	CLzmaDec vs;
+	size_t pos;
+	SizeT len;
+
+	if (LzmaProps_Decode(&vs.prop, in, LZMA_PROPS_SIZE) != SZ_OK)
+		return -1;
+
+	vs.probs = probs;
+	vs.dic = out;
+	vs.dicBufSize = osize;
+	LzmaDec_Init(&vs);
+
+	pos = LZMA_HEADER_SIZE;
+	do {
+		len = isize - pos;
+		if (chunk && len > chunk)
+			len = chunk;
+		if (LzmaDec_DecodeToDic(&vs, osize, in + pos, &len,
+					LZMA_FINISH_ANY, &status) != SZ_OK)
+			return -1;
+		pos += len;
+	} while (status == LZMA_STATUS_NEEDS_MORE_INPUT && pos < isize);
+
+	return vs.dicPos;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-n runs] file.lzma [file]\n"
+			"       %s -c file.lzma file\n", prog, prog);
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned char *in, *out, *ref = NULL;
+	size_t isize, osize, rsize = 0, chunk;
+	int runs = 10, check = 0, i, c;
+	CLzmaProps props;
+	CLzmaProb *probs;
+	double t, best = 0;
+
+	while ((c = getopt(argc, argv, "cn:")) != -1) {
+		switch (c) {
+		case 'c':
+			check = 1;
+			break;
+		case 'n':
+			runs = atoi(optarg);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (argc - optind < 1 + check || argc - optind > 2 || runs < 1)
+		usage(argv[0]);
+
+	in = read_file(argv[optind], &isize);
+	if (isize < LZMA_HEADER_SIZE ||
+	    LzmaProps_Decode(&props, in, LZMA_PROPS_SIZE) != SZ_OK) {
+		fprintf(stderr, "%s: bad lzma header\n", argv[optind]);
+		return 1;
+	}
+
+	if (argc - optind == 2)
+		ref = read_file(argv[optind + 1], &rsize);
+
+	/* the lower half of the uncompressed size, as the loader reads it */
+	osize = in[5] | (in[6] << 8) | (in[7] << 16) | ((size_t)in[8] << 24);
+	if (osize == 0xffffffff) {
+		if (!ref) {
+			fprintf(stderr, "%s: no size in the header\n", argv[optind]);
+			return 1;
+		}
+		osize = rsize;
+	}
+
+	probs = malloc(LzmaProps_GetNumProbs(&props) * sizeof(CLzmaProb));
+	out = malloc(osize);
+	if (!probs || !out) {
+		perror("malloc");
+		return 1;
+	}
+
+	if (check) {
+		for (chunk = 0; chunk <= 7; chunk += 7) {
+			memset(out, 0, osize);
+			if (decode(in, isize, out, osize, probs, chunk) != (long)rsize ||
+			    memcmp(out, ref, rsize)) {
+				fprintf(stderr, "%s: %s decode differs from %s\n",
+					argv[optind], chunk ? "chunked" : "in-memory",
+					argv[optind + 1]);
+				return 1;
+			}
+		}
+		printf("%s: ok, lc=%u lp=%u pb=%u\n", argv[optind],
+		       props.lc, props.lp, props.pb);
+		return 0;
+	}
+
+	for (i = 0; i < runs; i++) {
+		t = now();
+		if (decode(in, isize, out, osize, probs, 0) != (long)osize) {
+			fprintf(stderr, "%s: decode failed\n", argv[optind]);
+			return 1;
+		}
+		t = now() - t;
+		if (!i || t < best)
+			best = t;
+	}
+
+	printf("%s: %zu -> %zu bytes, lc=%u lp=%u pb=%u, %.1f MB/s\n",
+	       argv[optind], isize, osize, props.lc, props.lp, props.pb,
+	       osize / best / 1e6);
+
+	free(ref);
+	free(probs);
+	free(out);
+	free(in);
+	return 0;
+}
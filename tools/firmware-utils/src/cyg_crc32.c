@@ -124,18 +124,68 @@ static const cyg_uint32 crc32_tab[] = {
       0x2d02ef8dL
    };
 
+/* Tables for the slice-by-8 variant.  crc32_slice_tab[0] is crc32_tab,
+   crc32_slice_tab[n][i] is the CRC of byte i followed by n zero bytes.
+   They are derived from crc32_tab on first use. */
+static cyg_uint32 crc32_slice_tab[8][256];
+static int crc32_slice_init;
+
+static void
+crc32_slice_tab_init(void)
+{
+  int i, n;
+
+  for (i = 0;  i < 256;  i++)
+    crc32_slice_tab[0][i] = crc32_tab[i];
+
+  for (n = 1;  n < 8;  n++)
+    for (i = 0;  i < 256;  i++)
+      crc32_slice_tab[n][i] = crc32_tab[crc32_slice_tab[n - 1][i] & 0xff] ^
+                              (crc32_slice_tab[n - 1][i] >> 8);
+
+  crc32_slice_init = 1;
+}
+
+/* Fold 8 bytes per iteration into the CRC.  The words are assembled
+   byte-wise so the result does not depend on host endianness or
+   alignment. */
+static cyg_uint32
+crc32_slice8(cyg_uint32 crc32val, const unsigned char *s, int len)
+{
+  cyg_uint32 lo, hi;
+
+  if (!crc32_slice_init)
+    crc32_slice_tab_init();
+
+  while (len >= 8) {
+    lo = crc32val ^ (s[0] | (s[1] << 8) | (s[2] << 16) | ((cyg_uint32)s[3] << 24));
+    hi = s[4] | (s[5] << 8) | (s[6] << 16) | ((cyg_uint32)s[7] << 24);
+
+    crc32val = crc32_slice_tab[7][lo & 0xff] ^
+               crc32_slice_tab[6][(lo >> 8) & 0xff] ^
+               crc32_slice_tab[5][(lo >> 16) & 0xff] ^
+               crc32_slice_tab[4][lo >> 24] ^
+               crc32_slice_tab[3][hi & 0xff] ^
+               crc32_slice_tab[2][(hi >> 8) & 0xff] ^
+               crc32_slice_tab[1][(hi >> 16) & 0xff] ^
+               crc32_slice_tab[0][hi >> 24];
+
+    s += 8;
+    len -= 8;
+  }
+
+  while (len-- > 0)
+    crc32val = crc32_tab[(crc32val ^ *s++) & 0xff] ^ (crc32val >> 8);
+
+  return crc32val;
+}
+
 /* This is the standard Gary S. Brown's 32 bit CRC algorithm, but
    accumulate the CRC into the result of a previous CRC. */
 cyg_uint32 
 cyg_crc32_accumulate(cyg_uint32 crc32val, void *ptr, int len)
 {
-  unsigned char *s = ptr;
-  int i;
-
-  for (i = 0;  i < len;  i++) {
-    crc32val = crc32_tab[(crc32val ^ s[i]) & 0xff] ^ (crc32val >> 8);
-  }
-  return crc32val;
+  return crc32_slice8(crc32val, ptr, len);
 }
 
 /* This is the standard Gary S. Brown's 32 bit CRC algorithm */
@@ -151,15 +201,9 @@ cyg_crc32(void *s, int len)
 cyg_uint32
 cyg_ether_crc32_accumulate(cyg_uint32 crc32val, void *ptr, int len)
 {
-  unsigned char *s = ptr;
-  int i;
-
-  if (s == 0) return 0L;
-  
-  crc32val = crc32val ^ 0xffffffff;
-  for (i = 0;  i < len;  i++) {
-      crc32val = crc32_tab[(crc32val ^ s[i]) & 0xff] ^ (crc32val >> 8);
-  }
+  if (ptr == 0) return 0L;
+
+  crc32val = crc32_slice8(crc32val ^ 0xffffffff, ptr, len);
   return crc32val ^ 0xffffffff;
 }
 
@@ -172,3 +216,70 @@ cyg_ether_crc32(void *s, int len)
 }
 
 
+
+/* Tables for the POSIX 1003 (cksum) CRC.  It uses the same polynomial
+   as above but feeds the bits in MSB first, so the tables are those of
+   the non-reflected polynomial 0x04c11db7.  posix_crc32_tab[n][i] is the
+   CRC of byte i followed by n zero bytes; they are built on first use. */
+static cyg_uint32 posix_crc32_tab[8][256];
+static int posix_crc32_init;
+
+static void
+posix_crc32_tab_init(void)
+{
+  cyg_uint32 c;
+  int i, n;
+
+  for (i = 0;  i < 256;  i++) {
+    c = (cyg_uint32)i << 24;
+    for (n = 0;  n < 8;  n++)
+      c = (c << 1) ^ ((c & 0x80000000) ? 0x04c11db7 : 0);
+    posix_crc32_tab[0][i] = c;
+  }
+
+  for (n = 1;  n < 8;  n++)
+    for (i = 0;  i < 256;  i++)
+      posix_crc32_tab[n][i] = posix_crc32_tab[0][posix_crc32_tab[n - 1][i] >> 24] ^
+                              (posix_crc32_tab[n - 1][i] << 8);
+
+  posix_crc32_init = 1;
+}
+
+/* Compute a CRC, using the POSIX 1003 definition: the CRC of the data
+   followed by its length in as few little endian bytes as needed, then
+   inverted.  This is what cksum(1) prints. */
+cyg_uint32
+cyg_posix_crc32(void *ptr, int len)
+{
+  const unsigned char *s = ptr;
+  cyg_uint32 crc = 0, hi, lo;
+  unsigned int t = len;
+
+  if (!posix_crc32_init)
+    posix_crc32_tab_init();
+
+  while (len >= 8) {
+    hi = crc ^ (((cyg_uint32)s[0] << 24) | (s[1] << 16) | (s[2] << 8) | s[3]);
+    lo = ((cyg_uint32)s[4] << 24) | (s[5] << 16) | (s[6] << 8) | s[7];
+
+    crc = posix_crc32_tab[7][hi >> 24] ^
+          posix_crc32_tab[6][(hi >> 16) & 0xff] ^
+          posix_crc32_tab[5][(hi >> 8) & 0xff] ^
+          posix_crc32_tab[4][hi & 0xff] ^
+          posix_crc32_tab[3][lo >> 24] ^
+          posix_crc32_tab[2][(lo >> 16) & 0xff] ^
+          posix_crc32_tab[1][(lo >> 8) & 0xff] ^
+          posix_crc32_tab[0][lo & 0xff];
+
+    s += 8;
+    len -= 8;
+  }
+
+  while (len-- > 0)
+    crc = (crc << 8) ^ posix_crc32_tab[0][(crc >> 24) ^ *s++];
+
+  for (;  t;  t >>= 8)
+    crc = (crc << 8) ^ posix_crc32_tab[0][(crc >> 24) ^ (t & 0xff)];
+
+  return ~crc;
+}
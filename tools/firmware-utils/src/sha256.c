@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * FIPS-180-2 compliant SHA-256 implementation
+ *
+ * http://csrc.nist.gov/publications/fips/fips180-2/fips180-2.pdf
+ */
+
+#include <string.h>
+
+#include "sha256.h"
+
+#define GET_UINT32_BE(b)                        \
+    ( ( (uint32_t) (b)[0] << 24 )               \
+    | ( (uint32_t) (b)[1] << 16 )               \
+    | ( (uint32_t) (b)[2] <<  8 )               \
+    | ( (uint32_t) (b)[3]       ) )
+
+#define PUT_UINT32_BE(n,b)                      \
+{                                               \
+    (b)[0] = (uint8_t) ( (n) >> 24 );           \
+    (b)[1] = (uint8_t) ( (n) >> 16 );           \
+    (b)[2] = (uint8_t) ( (n) >>  8 );           \
+    (b)[3] = (uint8_t) ( (n)       );           \
+}
+
+static const uint32_t K[64] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+    0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+    0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+    0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+    0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+    0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+void sha256_starts( sha256_context *ctx )
+{
+    ctx->total = 0;
+
+    ctx->state[0] = 0x6A09E667;
+    ctx->state[1] = 0xBB67AE85;
+    ctx->state[2] = 0x3C6EF372;
+    ctx->state[3] = 0xA54FF53A;
+    ctx->state[4] = 0x510E527F;
+    ctx->state[5] = 0x9B05688C;
+    ctx->state[6] = 0x1F83D9AB;
+    ctx->state[7] = 0x5BE0CD19;
+}
+
+#define ROTR(x,n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define S0(x) (ROTR(x, 7) ^ ROTR(x,18) ^ ((x) >>  3))
+#define S1(x) (ROTR(x,17) ^ ROTR(x,19) ^ ((x) >> 10))
+#define S2(x) (ROTR(x, 2) ^ ROTR(x,13) ^ ROTR(x,22))
+#define S3(x) (ROTR(x, 6) ^ ROTR(x,11) ^ ROTR(x,25))
+
+#define F0(x,y,z) (((x) & (y)) | ((z) & ((x) | (y))))
+#define F1(x,y,z) ((z) ^ ((x) & ((y) ^ (z))))
+
+/* W[] is a 16 word ring, the schedule is extended as the rounds go */
+#define R(t)                                            \
+(                                                       \
+    W[(t) & 15] += S1(W[((t) - 2) & 15]) +              \
+                   W[((t) - 7) & 15] +                  \
+                   S0(W[((t) - 15) & 15])               \
+)
+
+#define P(a,b,c,d,e,f,g,h,x,k)                          \
+{                                                       \
+    temp1 = (h) + S3(e) + F1(e,f,g) + (k) + (x);        \
+    temp2 = S2(a) + F0(a,b,c);                          \
+    (d) += temp1; (h) = temp1 + temp2;                  \
+}
+
+static void sha256_process( sha256_context *ctx, const uint8_t data[64] )
+{
+    uint32_t temp1, temp2, W[16];
+    uint32_t A, B, C, D, E, F, G, H;
+    int i;
+
+    for( i = 0; i < 16; i++ )
+        W[i] = GET_UINT32_BE( data + 4 * i );
+
+    A = ctx->state[0];
+    B = ctx->state[1];
+    C = ctx->state[2];
+    D = ctx->state[3];
+    E = ctx->state[4];
+    F = ctx->state[5];
+    G = ctx->state[6];
+    H = ctx->state[7];
+
+    for( i = 0; i < 16; i += 8 )
+    {
+        P( A, B, C, D, E, F, G, H, W[i + 0], K[i + 0] );
+        P( H, A, B, C, D, E, F, G, W[i + 1], K[i + 1] );
+        P( G, H, A, B, C, D, E, F, W[i + 2], K[i + 2] );
+        P( F, G, H, A, B, C, D, E, W[i + 3], K[i + 3] );
+        P( E, F, G, H, A, B, C, D, W[i + 4], K[i + 4] );
+        P( D, E, F, G, H, A, B, C, W[i + 5], K[i + 5] );
+        P( C, D, E, F, G, H, A, B, W[i + 6], K[i + 6] );
+        P( B, C, D, E, F, G, H, A, W[i + 7], K[i + 7] );
+    }
+
+    for( ; i < 64; i += 8 )
+    {
+        P( A, B, C, D, E, F, G, H, R(i + 0), K[i + 0] );
+        P( H, A, B, C, D, E, F, G, R(i + 1), K[i + 1] );
+        P( G, H, A, B, C, D, E, F, R(i + 2), K[i + 2] );
+        P( F, G, H, A, B, C, D, E, R(i + 3), K[i + 3] );
+        P( E, F, G, H, A, B, C, D, R(i + 4), K[i + 4] );
+        P( D, E, F, G, H, A, B, C, R(i + 5), K[i + 5] );
+        P( C, D, E, F, G, H, A, B, R(i + 6), K[i + 6] );
+        P( B, C, D, E, F, G, H, A, R(i + 7), K[i + 7] );
+    }
+
+    ctx->state[0] += A;
+    ctx->state[1] += B;
+    ctx->state[2] += C;
+    ctx->state[3] += D;
+    ctx->state[4] += E;
+    ctx->state[5] += F;
+    ctx->state[6] += G;
+    ctx->state[7] += H;
+}
+
+void sha256_update( sha256_context *ctx, const void *data, unsigned int length )
+{
+    const uint8_t *input = data;
+    unsigned int left, fill;
+
+    if( ! length ) return;
+
+    left = ctx->total & 0x3F;
+    fill = 64 - left;
+
+    ctx->total += length;
+
+    if( left && length >= fill )
+    {
+        memcpy( ctx->buffer + left, input, fill );
+        sha256_process( ctx, ctx->buffer );
+        length -= fill;
+        input  += fill;
+        left = 0;
+    }
+
+    while( length >= 64 )
+    {
+        sha256_process( ctx, input );
+        length -= 64;
+        input  += 64;
+    }
+
+    if( length )
+        memcpy( ctx->buffer + left, input, length );
+}
+
+static const uint8_t sha256_padding[64] =
+{
+ 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+void sha256_finish( sha256_context *ctx, uint8_t digest[32] )
+{
+    unsigned int last, padn;
+    uint32_t high, low;
+    uint8_t msglen[8];
+    int i;
+
+    high = (uint32_t) ( ctx->total >> 29 );
+    low  = (uint32_t) ( ctx->total <<  3 );
+
+    PUT_UINT32_BE( high, msglen );
+    PUT_UINT32_BE( low,  msglen + 4 );
+
+    last = ctx->total & 0x3F;
+    padn = ( last < 56 ) ? ( 56 - last ) : ( 120 - last );
+
+    sha256_update( ctx, sha256_padding, padn );
+    sha256_update( ctx, msglen, 8 );
+
+    for( i = 0; i < 8; i++ )
+        PUT_UINT32_BE( ctx->state[i], digest + 4 * i );
+}
+
+void sha256_csum( const void *buf, unsigned int buflen, uint8_t digest[32] )
+{
+    sha256_context ctx;
+
+    sha256_starts( &ctx );
+    sha256_update( &ctx, buf, buflen );
+    sha256_finish( &ctx, digest );
+}
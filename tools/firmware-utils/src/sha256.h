@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * FIPS-180-2 compliant SHA-256, with the interface of sha1.h
+ */
+
+#ifndef _SHA256_H
+#define _SHA256_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint64_t total;
+    uint32_t state[8];
+    uint8_t buffer[64];
+}
+sha256_context;
+
+/*
+ * Core SHA-256 functions
+ */
+void sha256_starts( sha256_context *ctx );
+void sha256_update( sha256_context *ctx, const void *input, unsigned int length );
+void sha256_finish( sha256_context *ctx, uint8_t digest[32] );
+
+/*
+ * Output SHA-256(buf)
+ */
+void sha256_csum( const void *buf, unsigned int buflen, uint8_t digest[32] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* sha256.h */
@@ -34,6 +34,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -44,8 +45,10 @@
 
 #include <arpa/inet.h>
 
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <limits.h>
 
 #include "md5.h"
@@ -2554,14 +2557,51 @@ static struct image_partition_entry make_extra_para(
 		info->part_trail);
 }
 
-/** Creates a new image partition with an arbitrary name from a file */
-static struct image_partition_entry read_file(const char *part_name, const char *filename, bool add_jffs2_eof, struct flash_partition_entry *file_system_partition) {
+/** An input file mapped into memory, shared by all images built from it */
+struct input_file {
+	const char *name;
+	const uint8_t *data;
+	size_t size;
+};
+
+/** Maps an input file read-only into memory */
+static void map_file(struct input_file *input, const char *filename) {
 	struct stat statbuf;
+	int fd;
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		error(1, errno, "unable to open file `%s'", filename);
 
-	if (stat(filename, &statbuf) < 0)
+	if (fstat(fd, &statbuf) < 0)
 		error(1, errno, "unable to stat file `%s'", filename);
 
-	size_t len = statbuf.st_size;
+	input->name = filename;
+	input->size = statbuf.st_size;
+	input->data = NULL;
+
+	if (input->size) {
+		void *data = mmap(NULL, input->size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED)
+			error(1, errno, "unable to map file `%s'", filename);
+
+		input->data = data;
+	}
+
+	close(fd);
+}
+
+/** Unmaps an input file mapped with map_file() */
+static void unmap_file(struct input_file *input) {
+	if (input->data)
+		munmap((void *)input->data, input->size);
+
+	input->data = NULL;
+}
+
+/** Creates a new image partition with an arbitrary name from a mapped file */
+static struct image_partition_entry read_file(const char *part_name, const struct input_file *input, bool add_jffs2_eof, struct flash_partition_entry *file_system_partition) {
+	size_t len = input->size;
 
 	if (add_jffs2_eof) {
 		if (file_system_partition)
@@ -2572,22 +2612,16 @@ static struct image_partition_entry read_file(const char *part_name, const char
 
 	struct image_partition_entry entry = alloc_image_partition(part_name, len);
 
-	FILE *file = fopen(filename, "rb");
-	if (!file)
-		error(1, errno, "unable to open file `%s'", filename);
-
-	if (fread(entry.data, statbuf.st_size, 1, file) != 1)
-		error(1, errno, "unable to read file `%s'", filename);
+	if (input->size)
+		memcpy(entry.data, input->data, input->size);
 
 	if (add_jffs2_eof) {
-		uint8_t *eof = entry.data + statbuf.st_size, *end = entry.data+entry.size;
+		uint8_t *eof = entry.data + input->size, *end = entry.data+entry.size;
 
 		memset(eof, 0xff, end - eof - sizeof(jffs2_eof_mark));
 		memcpy(end - sizeof(jffs2_eof_mark), jffs2_eof_mark, sizeof(jffs2_eof_mark));
 	}
 
-	fclose(file);
-
 	return entry;
 }
 
@@ -2765,8 +2799,8 @@ static void * generate_sysupgrade_image(struct device_info *info, const struct i
 
 /** Generates an image according to a given layout and writes it to a file */
 static void build_image(const char *output,
-		const char *kernel_image,
-		const char *rootfs_image,
+		const struct input_file *kernel_image,
+		const struct input_file *rootfs_image,
 		uint32_t rev,
 		bool add_jffs2_eof,
 		bool sysupgrade,
@@ -2794,27 +2828,23 @@ static void build_image(const char *output,
 		os_image_partition = &info->partitions[firmware_partition_index];
 		file_system_partition = &info->partitions[firmware_partition_index + 1];
 
-		struct stat kernel;
-		if (stat(kernel_image, &kernel) < 0)
-			error(1, errno, "unable to stat file `%s'", kernel_image);
-
-		if (kernel.st_size > firmware_partition->size)
+		if (kernel_image->size > firmware_partition->size)
 			error(1, 0, "kernel overflowed firmware partition\n");
 
 		for (i = MAX_PARTITIONS-1; i >= firmware_partition_index + 1; i--)
 			info->partitions[i+1] = info->partitions[i];
 
 		file_system_partition->name = "file-system";
-		file_system_partition->base = firmware_partition->base + kernel.st_size;
+		file_system_partition->base = firmware_partition->base + kernel_image->size;
 
 		/* Align partition start to erase blocks for factory images only */
 		if (!sysupgrade)
-			file_system_partition->base = ALIGN(firmware_partition->base + kernel.st_size, 0x10000);
+			file_system_partition->base = ALIGN(firmware_partition->base + kernel_image->size, 0x10000);
 
 		file_system_partition->size = firmware_partition->size - file_system_partition->base;
 
 		os_image_partition->name = "os-image";
-		os_image_partition->size = kernel.st_size;
+		os_image_partition->size = kernel_image->size;
 	}
 
 	parts[0] = make_partition_table(info->partitions);
@@ -2878,10 +2908,12 @@ static void usage(const char *argv0) {
 		"  -h              show this help\n"
 		"\n"
 		"Create a new image:\n"
-		"  -B <board>      create image for the board specified with <board>\n"
+		"  -B <board>      create image for the board specified with <board>; a comma\n"
+		"                  separated list of boards builds all of them in one run\n"
 		"  -k <file>       read kernel image from the file <file>\n"
 		"  -r <file>       read rootfs image from the file <file>\n"
-		"  -o <file>       write output to the file <file>\n"
+		"  -o <file>       write output to the file <file>; when building several\n"
+		"                  boards, a %%s in <file> is replaced with the board name\n"
 		"  -V <rev>        sets the revision number to <rev>\n"
 		"  -j              add jffs2 end-of-filesystem markers\n"
 		"  -S              create sysupgrade instead of factory image\n"
@@ -2905,6 +2937,99 @@ static struct device_info *find_board(const char *id)
 	return NULL;
 }
 
+/**
+   Builds the images for a comma separated list of boards
+
+   The kernel and rootfs are mapped once and shared by all boards. Each board
+   is built in its own child process, with at most one process per online CPU.
+*/
+static void build_images(const char *board_list,
+		const char *output,
+		const struct input_file *kernel_image,
+		const struct input_file *rootfs_image,
+		uint32_t rev,
+		bool add_jffs2_eof,
+		bool sysupgrade) {
+
+	char *boards_buf, *board_id, *next;
+	const char *subst;
+	long max_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	long jobs = 0;
+	int failed = 0;
+	int status;
+
+	/* The filename is not used as a format, %s is the only substitution allowed */
+	subst = strchr(output, '%');
+	if (!subst || subst[1] != 's' || strchr(subst + 2, '%'))
+		error(1, 0, "output filename must contain %%s exactly once and no other %% when building several boards");
+
+	if (max_jobs < 1)
+		max_jobs = 1;
+
+	boards_buf = strdup(board_list);
+	if (!boards_buf)
+		error(1, errno, "strdup");
+
+	/* Validate the whole list before building anything */
+	for (board_id = boards_buf; board_id; board_id = next) {
+		next = strchr(board_id, ',');
+		if (next)
+			*next++ = '\0';
+
+		if (*board_id && !find_board(board_id))
+			error(1, 0, "unsupported board %s", board_id);
+
+		if (next)
+			next[-1] = ',';
+	}
+
+	for (board_id = boards_buf; board_id; board_id = next) {
+		next = strchr(board_id, ',');
+		if (next)
+			*next++ = '\0';
+
+		if (!*board_id)
+			continue;
+
+		if (jobs == max_jobs) {
+			if (wait(&status) < 0)
+				error(1, errno, "wait");
+			if (!WIFEXITED(status) || WEXITSTATUS(status))
+				failed = 1;
+			jobs--;
+		}
+
+		pid_t pid = fork();
+		if (pid < 0)
+			error(1, errno, "fork");
+
+		if (pid == 0) {
+			char path[PATH_MAX];
+
+			if (snprintf(path, sizeof(path), "%.*s%s%s", (int)(subst - output), output,
+				     board_id, subst + 2) >= (int)sizeof(path))
+				error(1, 0, "output filename too long");
+
+			build_image(path, kernel_image, rootfs_image, rev, add_jffs2_eof, sysupgrade, find_board(board_id));
+			_exit(0);
+		}
+
+		jobs++;
+	}
+
+	while (jobs--) {
+		if (wait(&status) < 0)
+			error(1, errno, "wait");
+		if (!WIFEXITED(status) || WEXITSTATUS(status))
+			failed = 1;
+	}
+
+	free(boards_buf);
+
+	if (failed)
+		error(1, 0, "failed to build some of the images");
+}
+
 static int add_flash_partition(
 		struct flash_partition_entry *part_list,
 		size_t max_entries,
@@ -3229,6 +3354,7 @@ int main(int argc, char *argv[]) {
 	bool add_jffs2_eof = false, sysupgrade = false;
 	unsigned rev = 0;
 	struct device_info *info;
+	struct input_file kernel, rootfs;
 	set_source_date_epoch();
 
 	while (true) {
@@ -3309,12 +3435,22 @@ int main(int argc, char *argv[]) {
 		if (!output)
 			error(1, 0, "no output filename has been specified");
 
-		info = find_board(board);
+		map_file(&kernel, kernel_image);
+		map_file(&rootfs, rootfs_image);
 
-		if (info == NULL)
-			error(1, 0, "unsupported board %s", board);
+		if (strchr(board, ',')) {
+			build_images(board, output, &kernel, &rootfs, rev, add_jffs2_eof, sysupgrade);
+		} else {
+			info = find_board(board);
+
+			if (info == NULL)
+				error(1, 0, "unsupported board %s", board);
+
+			build_image(output, &kernel, &rootfs, rev, add_jffs2_eof, sysupgrade, info);
+		}
 
-		build_image(output, kernel_image, rootfs_image, rev, add_jffs2_eof, sysupgrade, info);
+		unmap_file(&kernel);
+		unmap_file(&rootfs);
 	}
 
 	return 0;
@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Test and benchmark of the CRC and digest library of firmware-utils.
+ *
+ *   hashbench           check every algorithm against known values and
+ *                       the old byte-at-a-time CRCs against the library
+ *   hashbench -b [kb]   MB/s of each of them over a kb KiB buffer
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "cyg_crc.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+
+#define BENCH_BYTES	(256 << 20)
+
+#define TEST_ASSERT(cond)						\
+	do {								\
+		if (!(cond)) {						\
+			fprintf(stderr, "%s:%d: %s\n", __FILE__,	\
+				__LINE__, #cond);			\
+			exit(1);					\
+		}							\
+	} while (0)
+
+static uint32_t crc32_le_tab[256];
+static uint32_t crc32_be_tab[256];
+
+static void old_crc_init(void)
+{
+	uint32_t c;
+	int i, n;
+
+	for (i = 0; i < 256; i++) {
+		c = i;
+		for (n = 0; n < 8; n++)
+			c = (c >> 1) ^ ((c & 1) ? 0xedb88320 : 0);
+		crc32_le_tab[i] = c;
+
+		c = (uint32_t)i << 24;
+		for (n = 0; n < 8; n++)
+			c = (c << 1) ^ ((c & 0x80000000) ? 0x04c11db7 : 0);
+		crc32_be_tab[i] = c;
+	}
+}
+
+/* the private CRC32 otrx, trx and asustrx used to carry */
+static uint32_t old_crc32(uint32_t crc, const uint8_t *p, size_t len)
+{
+	while (len--)
+		crc = crc32_le_tab[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+
+/* the private POSIX CRC of buffalo-lib */
+static uint32_t old_posix_crc32(const uint8_t *p, size_t len)
+{
+	size_t t = len;
+	uint32_t crc = 0;
+
+	while (len--)
+		crc = (crc << 8) ^ crc32_be_tab[((crc >> 24) ^ *p++) & 0xff];
+
+	for (; t; t >>= 8)
+		crc = (crc << 8) ^ crc32_be_tab[((crc >> 24) ^ t) & 0xff];
+
+	return ~crc;
+}
+
+static void hex(char *out, const uint8_t *d, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		sprintf(out + 2 * i, "%02x", d[i]);
+}
+
+static void test_vectors(void)
+{
+	char s[] = "123456789", abc[] = "abc", out[65];
+	uint8_t d[32];
+	MD5_CTX md5;
+
+	TEST_ASSERT(cyg_crc16(s, 9) == 0x31c3);
+	TEST_ASSERT(cyg_ether_crc32(s, 9) == 0xcbf43926);
+	TEST_ASSERT(cyg_posix_crc32(s, 9) == 0x377a6011);
+
+	MD5_Init(&md5);
+	MD5_Update(&md5, abc, 3);
+	MD5_Final(d, &md5);
+	hex(out, d, 16);
+	TEST_ASSERT(!strcmp(out, "900150983cd24fb0d6963f7d28e17f72"));
+
+	sha1_csum((uint8_t *)abc, 3, d);
+	hex(out, d, 20);
+	TEST_ASSERT(!strcmp(out, "a9993e364706816aba3e25717850c26c9cd0d89d"));
+
+	sha256_csum(abc, 3, d);
+	hex(out, d, 32);
+	TEST_ASSERT(!strcmp(out, "ba7816bf8f01cfea414140de5dae2223"
+				 "b00361a396177a9cb410ff61f20015ad"));
+
+	/* two blocks, the length lands in the second one */
+	sha256_csum("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+		    56, d);
+	hex(out, d, 32);
+	TEST_ASSERT(!strcmp(out, "248d6a61d20638b8e5c026930c3e6039"
+				 "a33ce45964ff2167f6ecedd419db06c1"));
+}
+
+/* every length and alignment up to a few slices, then a large buffer */
+static void test_old_vs_new(const uint8_t *buf, size_t size)
+{
+	sha256_context ctx;
+	uint8_t d1[32], d2[32];
+	size_t off, len, i;
+
+	for (off = 0; off < 8; off++) {
+		for (len = 0; len < 64; len++) {
+			TEST_ASSERT(cyg_crc32_accumulate(0xffffffff, (void *)(buf + off), len) ==
+				    old_crc32(0xffffffff, buf + off, len));
+			TEST_ASSERT(cyg_posix_crc32((void *)(buf + off), len) ==
+				    old_posix_crc32(buf + off, len));
+		}
+	}
+
+	TEST_ASSERT(cyg_crc32_accumulate(0, (void *)buf, size) ==
+		    old_crc32(0, buf, size));
+	TEST_ASSERT(cyg_posix_crc32((void *)buf, size) ==
+		    old_posix_crc32(buf, size));
+
+	/* feeding SHA-256 in odd pieces must not change the digest */
+	sha256_csum(buf, size, d1);
+	sha256_starts(&ctx);
+	for (i = 0; i < size; i += len) {
+		len = (i * 7 + 13) % 200;
+		if (len > size - i)
+			len = size - i;
+		sha256_update(&ctx, buf + i, len);
+	}
+	sha256_finish(&ctx, d2);
+	TEST_ASSERT(!memcmp(d1, d2, 32));
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+enum {
+	ALG_OLD_CRC32,
+	ALG_CRC32,
+	ALG_OLD_POSIX_CRC32,
+	ALG_POSIX_CRC32,
+	ALG_CRC16,
+	ALG_MD5,
+	ALG_SHA1,
+	ALG_SHA256,
+	ALG_NUM
+};
+
+static const char *alg_name[ALG_NUM] = {
+	[ALG_OLD_CRC32]		= "crc32 (old, bytewise)",
+	[ALG_CRC32]		= "crc32",
+	[ALG_OLD_POSIX_CRC32]	= "posix crc32 (old, bytewise)",
+	[ALG_POSIX_CRC32]	= "posix crc32",
+	[ALG_CRC16]		= "crc16",
+	[ALG_MD5]		= "md5",
+	[ALG_SHA1]		= "sha1",
+	[ALG_SHA256]		= "sha256",
+};
+
+/* returns part of the result, which bench() keeps so nothing is optimized out */
+static uint32_t run(int alg, uint8_t *buf, size_t size)
+{
+	uint8_t d[32];
+	MD5_CTX md5;
+
+	switch (alg) {
+	case ALG_OLD_CRC32:
+		return old_crc32(0xffffffff, buf, size);
+	case ALG_CRC32:
+		return cyg_crc32_accumulate(0xffffffff, buf, size);
+	case ALG_OLD_POSIX_CRC32:
+		return old_posix_crc32(buf, size);
+	case ALG_POSIX_CRC32:
+		return cyg_posix_crc32(buf, size);
+	case ALG_CRC16:
+		return cyg_crc16(buf, size);
+	case ALG_MD5:
+		MD5_Init(&md5);
+		MD5_Update(&md5, buf, size);
+		MD5_Final(d, &md5);
+		break;
+	case ALG_SHA1:
+		sha1_csum(buf, size, d);
+		break;
+	case ALG_SHA256:
+		sha256_csum(buf, size, d);
+		break;
+	}
+
+	return d[0];
+}
+
+static void bench(uint8_t *buf, size_t size)
+{
+	volatile uint32_t sink = 0;
+	unsigned long i, loops;
+	double t;
+	int alg;
+
+	loops = BENCH_BYTES / size;
+	if (!loops)
+		loops = 1;
+
+	printf("%zu KiB buffer, MB/s:\n", size >> 10);
+	for (alg = 0; alg < ALG_NUM; alg++) {
+		/* the hashes are much slower, keep every run around a second */
+		unsigned long n = alg >= ALG_MD5 ? (loops + 3) / 4 : loops;
+
+		t = now();
+		for (i = 0; i < n; i++)
+			sink += run(alg, buf, size);
+		t = now() - t;
+
+		printf("  %-28s %8.1f\n", alg_name[alg], n * size / t / 1e6);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t size = 1 << 20, i;
+	uint8_t *buf;
+
+	if (argc > 1 && !strcmp(argv[1], "-b") && argc > 2)
+		size = strtoul(argv[2], NULL, 0) << 10;
+	TEST_ASSERT(size >= 1024);
+
+	buf = malloc(size + 8);
+	TEST_ASSERT(buf);
+	srand(1);
+	for (i = 0; i < size + 8; i++)
+		buf[i] = rand();
+
+	old_crc_init();
+
+	if (argc > 1 && !strcmp(argv[1], "-b")) {
+		bench(buf, size);
+	} else {
+		test_vectors();
+		test_old_vs_new(buf, size);
+		printf("hash: ok\n");
+	}
+
+	free(buf);
+	return 0;
+}